@@ -0,0 +1,116 @@
+#!python3
+from polyhedral_gravity import Polyhedron, PolyhedronIntegrity, GravityEvaluable, NumaGravityEvaluable
+import polyhedral_gravity
+import numpy as np
+import timeit
+import argparse
+import json
+import shutil
+import subprocess
+import sys
+from loguru import logger
+from typing import Dict, List
+
+
+def measure(evaluable, computation_points: np.ndarray, repetitions: int) -> float:
+    """Returns the best runtime per point in microseconds of evaluating all points with the evaluable."""
+    # The first call warms up the caches and the threads
+    evaluable(computation_points, as_numpy=True)
+    total_time = min(timeit.repeat(lambda: evaluable(computation_points, as_numpy=True), number=1, repeat=repetitions))
+    return total_time / len(computation_points) * 1e6
+
+
+def run_time_measurements(sample_size: int, mesh_files: List[str], repetitions: int,
+                          configurations: List[str]) -> Dict[str, float]:
+    """Returns the RuntimeMeasurements of the given configurations (default or numa) as mapping.
+
+    Returns:
+        a mapping from configuration name to runtime per point in microseconds
+    """
+    polyhedron = Polyhedron(
+        polyhedral_source=mesh_files,
+        density=1.0,
+        integrity_check=PolyhedronIntegrity.DISABLE,
+    )
+    computation_points = np.random.default_rng(42).uniform(-2, 2, (sample_size, 3))
+    results = dict()
+    if "default" in configurations:
+        results["GravityEvaluable"] = measure(GravityEvaluable(polyhedron), computation_points, repetitions)
+    if "numa" in configurations:
+        evaluable = NumaGravityEvaluable(polyhedron)
+        logger.info(f"NUMA nodes (index, CPUs): {evaluable.nodes}")
+        results["NumaGravityEvaluable"] = measure(evaluable, computation_points, repetitions)
+    return results
+
+
+def run_interleaved(args: argparse.Namespace) -> Dict[str, float]:
+    """Measures the GravityEvaluable in a child process whose memory is interleaved across all NUMA nodes."""
+    if shutil.which("numactl") is None:
+        logger.warning("numactl is not installed, skipping the interleaved measurement")
+        return dict()
+    command = ["numactl", "--interleave=all", sys.executable, __file__, "--sample-size", str(args.sample_size),
+               "--repetitions", str(args.repetitions), "--configurations", "default", "--json", "--mesh-files",
+               *args.mesh_files]
+    output = subprocess.run(command, check=True, capture_output=True, text=True).stdout
+    return {f"{name} (interleaved)": runtime for name, runtime in json.loads(output.splitlines()[-1]).items()}
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Compares the runtime of the GravityEvaluable with the NUMA-aware NumaGravityEvaluable "
+                    "on a multi-socket machine.",
+    )
+    parser.add_argument(
+        '-s', '--sample-size',
+        type=int,
+        default=100000,
+        help="Specify the number of computation points. Defaults to 100000",
+    )
+    parser.add_argument(
+        '-m', '--mesh-files',
+        type=str,
+        nargs='+',
+        default=["mesh/Eros.node", "mesh/Eros.face"],
+        help="Input mesh file(s). Provide one or more file paths separated by a space.",
+    )
+    parser.add_argument(
+        '-r', '--repetitions',
+        type=int,
+        default=5,
+        help="Number of repetitions, the best one is reported. Defaults to 5",
+    )
+    parser.add_argument(
+        '-c', '--configurations',
+        type=str,
+        nargs='+',
+        default=["default", "interleaved", "numa"],
+        choices=["default", "interleaved", "numa"],
+        help="The configurations to measure. 'interleaved' runs the GravityEvaluable under numactl --interleave=all.",
+    )
+    parser.add_argument(
+        '--json',
+        action='store_true',
+        help="Prints the results as JSON object on the last line (used for the interleaved child process).",
+    )
+    args = parser.parse_args()
+
+    results = run_time_measurements(args.sample_size, args.mesh_files, args.repetitions, args.configurations)
+    if "interleaved" in args.configurations:
+        results.update(run_interleaved(args))
+    if args.json:
+        print(json.dumps(results))
+        return
+
+    logger.info("##########################################################")
+    logger.info(f"Sample Size:       {args.sample_size}")
+    logger.info(f"Mesh files:        {args.mesh_files}")
+    logger.info(f"Parallelization:   {polyhedral_gravity.__parallelization__}")
+    logger.info("##########################################################")
+    baseline = results.get("GravityEvaluable (interleaved)", results.get("GravityEvaluable"))
+    for name, runtime in results.items():
+        speed_up = f", speed-up {baseline / runtime:.2f}x" if baseline is not None else ""
+        logger.info(f"{name:35s} {runtime:8.3f} microseconds per point{speed_up}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,104 @@
+#!python3
+from polyhedral_gravity import Polyhedron, PolyhedronIntegrity, GravityEvaluable
+import polyhedral_gravity
+import numpy as np
+import timeit
+import argparse
+from loguru import logger
+from typing import Dict, List
+
+
+def measure(evaluable, computation_points: np.ndarray, repetitions: int, parallel: bool) -> float:
+    """Returns the best latency of a single-point call in microseconds, evaluating one point after another."""
+    def evaluate_one_by_one():
+        for point in computation_points:
+            evaluable(point, parallel)
+
+    # The first call warms up the caches and the threads
+    evaluate_one_by_one()
+    total_time = min(timeit.repeat(evaluate_one_by_one, number=1, repeat=repetitions))
+    return total_time / len(computation_points) * 1e6
+
+
+def run_time_measurements(sample_size: int, mesh_files: List[str], repetitions: int, threads: int,
+                          configurations: List[str]) -> Dict[str, float]:
+    """Returns the single-point latencies of the given configurations (serial, default, or worker_team) as mapping.
+
+    Returns:
+        a mapping from configuration name to latency per point in microseconds
+    """
+    polyhedron = Polyhedron(
+        polyhedral_source=mesh_files,
+        density=1.0,
+        integrity_check=PolyhedronIntegrity.DISABLE,
+    )
+    computation_points = np.random.default_rng(42).uniform(-2, 2, (sample_size, 3))
+    evaluable = GravityEvaluable(polyhedron)
+    results = dict()
+    if "serial" in configurations:
+        results["GravityEvaluable (serial)"] = measure(evaluable, computation_points, repetitions, False)
+    if "default" in configurations:
+        results["GravityEvaluable"] = measure(evaluable, computation_points, repetitions, True)
+    if "worker_team" in configurations:
+        latency_evaluable = evaluable.with_worker_team(threads=threads)
+        results[f"GravityEvaluable (worker team, threads={threads})"] = measure(
+            latency_evaluable, computation_points, repetitions, True)
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Compares the latency of single-point calls of the GravityEvaluable with the default parallel "
+                    "loop (transform_reduce over the faces) and with a persistent worker team.",
+    )
+    parser.add_argument(
+        '-s', '--sample-size',
+        type=int,
+        default=1000,
+        help="Specify the number of computation points, evaluated one after another. Defaults to 1000",
+    )
+    parser.add_argument(
+        '-m', '--mesh-files',
+        type=str,
+        nargs='+',
+        default=["mesh/Eros.node", "mesh/Eros.face"],
+        help="Input mesh file(s). Provide one or more file paths separated by a space.",
+    )
+    parser.add_argument(
+        '-r', '--repetitions',
+        type=int,
+        default=5,
+        help="Number of repetitions, the best one is reported. Defaults to 5",
+    )
+    parser.add_argument(
+        '-t', '--threads',
+        type=int,
+        default=0,
+        help="Number of threads of the worker team including the calling one, zero is one per core. Defaults to 0",
+    )
+    parser.add_argument(
+        '-c', '--configurations',
+        type=str,
+        nargs='+',
+        default=["serial", "default", "worker_team"],
+        choices=["serial", "default", "worker_team"],
+        help="The configurations to measure. 'serial' evaluates the points with parallel=False.",
+    )
+    args = parser.parse_args()
+
+    results = run_time_measurements(args.sample_size, args.mesh_files, args.repetitions, args.threads,
+                                    args.configurations)
+
+    logger.info("##########################################################")
+    logger.info(f"Sample Size:       {args.sample_size}")
+    logger.info(f"Mesh files:        {args.mesh_files}")
+    logger.info(f"Parallelization:   {polyhedral_gravity.__parallelization__}")
+    logger.info("##########################################################")
+    baseline = results.get("GravityEvaluable")
+    for name, latency in results.items():
+        speed_up = f", speed-up {baseline / latency:.2f}x" if baseline is not None else ""
+        logger.info(f"{name:50s} {latency:8.3f} microseconds per point{speed_up}")
+
+
+if __name__ == "__main__":
+    main()
@@ -17,6 +17,8 @@ CMAKE_OPTIONS = {
     "CMAKE_BUILD_TYPE": "Release",
     # Modify to change the parallelization (Default value: TBB)
     "POLYHEDRAL_GRAVITY_PARALLELIZATION": "TBB",
+    # Further backends selectable at runtime, e.g. via POLYHEDRAL_GRAVITY_BACKEND (skipped if OpenMP is not found)
+    "POLYHEDRAL_GRAVITY_ADDITIONAL_PARALLELIZATION": "OMP",
     # Default value (INFO=2)
     "POLYHEDRAL_GRAVITY_LOGGING_LEVEL": "INFO",
     # Not required for the python interface (--> OFF)
@@ -1,12 +1,18 @@
 #include "polyhedralGravity/Info.h"
 #include "polyhedralGravity/input/ConfigSource.h"
 #include "polyhedralGravity/input/YAMLConfigReader.h"
-#include "polyhedralGravity/model/GravityModel.h"
+#include "polyhedralGravity/model/GravityEvaluable.h"
 #include "polyhedralGravity/model/PolyhedronDefinitions.h"
 #include "polyhedralGravity/model/Polyhedron.h"
-#include "polyhedralGravity/output/CSVWriter.h"
+#include "polyhedralGravity/model/Pipeline.h"
+#include "polyhedralGravity/model/Snapshot.h"
+#include "polyhedralGravity/output/ResultWriter.h"
 #include "polyhedralGravity/output/Logging.h"
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <filesystem>
+#include <memory>
 #include <sstream>
 
 int main(const int argc, char *argv[]) {
@@ -26,16 +32,44 @@ int main(const int argc, char *argv[]) {
 
     try {
         const std::shared_ptr<ConfigSource> config = std::make_shared<YAMLConfigReader>(argv[1]);
-        const auto polyhedralSource = config->getPolyhedralSource();
         const auto density = config->getDensity();
-        const auto computationPoints = config->getPointsOfInterest();
+        const auto pointSource = config->getPointSource();
+        const auto chunkSize = config->getChunkSize();
         const auto outputFileName = config->getOutputFileName();
         const auto metricUnit = config->getMeshUnit();
+        const auto snapshotFileName = config->getSnapshotFileName();
         const PolyhedronIntegrity checkPolyhedralInput = config->getMeshInputCheckStatus() ? PolyhedronIntegrity::HEAL : PolyhedronIntegrity::DISABLE;
 
         POLYHEDRAL_GRAVITY_LOG_INFO("Polyhedron creation and check (if enabled) started.");
         const auto startPolyhedron = std::chrono::high_resolution_clock::now();
-        const Polyhedron polyhedron{polyhedralSource, density, NormalOrientation::OUTWARDS, checkPolyhedralInput, metricUnit};
+        // An existing snapshot of the same mesh source replaces reading the mesh, the mesh check, and the computation
+        // of the caches. A stale snapshot (other mesh files, mesh check, density, or metric unit) is created anew.
+        const uint64_t sourceDigest = snapshotFileName.empty()
+                ? 0 : Snapshot::digestSource(config->getPolyhedronFileNames(), config->getWeldTolerance(), checkPolyhedralInput);
+        bool restoreSnapshot = !snapshotFileName.empty() && std::filesystem::exists(snapshotFileName);
+        if (restoreSnapshot) {
+            try {
+                const Snapshot::Header header = Snapshot::readHeader(MappedFile{snapshotFileName}, snapshotFileName);
+                restoreSnapshot = header.sourceDigest == sourceDigest && header.density == density && header.metricUnit == metricUnit;
+                if (!restoreSnapshot) {
+                    POLYHEDRAL_GRAVITY_LOG_INFO("The snapshot {} was created from another mesh, mesh check, density, or metric unit "
+                                                "than configured, it is created anew", snapshotFileName);
+                }
+            } catch (const std::runtime_error &error) {
+                POLYHEDRAL_GRAVITY_LOG_WARN("The snapshot {} is created anew: {}", snapshotFileName, error.what());
+                restoreSnapshot = false;
+            }
+        }
+        const GravityEvaluable evaluable = restoreSnapshot
+                ? Snapshot::readGravityEvaluable(snapshotFileName)
+                : GravityEvaluable{Polyhedron{config->getPolyhedralSource(), density, NormalOrientation::OUTWARDS, checkPolyhedralInput, metricUnit}};
+        const Polyhedron &polyhedron = evaluable.getPolyhedron();
+        if (restoreSnapshot) {
+            POLYHEDRAL_GRAVITY_LOG_INFO("Polyhedron restored from the snapshot {}", snapshotFileName);
+        } else if (!snapshotFileName.empty()) {
+            Snapshot::write(snapshotFileName, evaluable, sourceDigest);
+            POLYHEDRAL_GRAVITY_LOG_INFO("Polyhedron written to the snapshot {}", snapshotFileName);
+        }
         const auto endPolyhedron = std::chrono::high_resolution_clock::now();
         const auto durationPolyhedron = endPolyhedron - startPolyhedron;
         const auto msPolyhedron = std::chrono::duration_cast<std::chrono::microseconds>(durationPolyhedron).count();
@@ -44,7 +78,11 @@ int main(const int argc, char *argv[]) {
         POLYHEDRAL_GRAVITY_LOG_INFO("####################################################################################");
         POLYHEDRAL_GRAVITY_LOG_INFO("Number of Vertices:                               {}", polyhedron.countVertices());
         POLYHEDRAL_GRAVITY_LOG_INFO("Number of Faces:                                  {}", polyhedron.countFaces());
-        POLYHEDRAL_GRAVITY_LOG_INFO("Number of Computation Points:                     {}", computationPoints.size());
+        if (const auto pointCount = pointSource->size()) {
+            POLYHEDRAL_GRAVITY_LOG_INFO("Number of Computation Points:                     {}", *pointCount);
+        } else {
+            POLYHEDRAL_GRAVITY_LOG_INFO("Number of Computation Points:                     unknown in advance");
+        }
         POLYHEDRAL_GRAVITY_LOG_INFO("Mesh Check Enabled:                               {}", config->getMeshInputCheckStatus());
         POLYHEDRAL_GRAVITY_LOG_INFO("Mesh Unit:                                        {}", polyhedron.getMeshUnitAsString());
         POLYHEDRAL_GRAVITY_LOG_INFO("Density:                                          {} {}", polyhedron.getDensity(), polyhedron.getDensityUnit());
@@ -52,26 +90,62 @@ int main(const int argc, char *argv[]) {
         POLYHEDRAL_GRAVITY_LOG_INFO("####################################################################################");
 
         POLYHEDRAL_GRAVITY_LOG_INFO("Gravity Evaluation has started!");
-        const auto startCalc = std::chrono::high_resolution_clock::now();
-
-        const auto result = GravityModel::evaluate(polyhedron, computationPoints, true);
-
-        const auto endCalc = std::chrono::high_resolution_clock::now();
-        const auto durationCalc = endCalc - startCalc;
-        const auto msCalc = std::chrono::duration_cast<std::chrono::microseconds>(durationCalc).count();
-        POLYHEDRAL_GRAVITY_LOG_INFO("The calculation of the Gravity Model has finished. It took {} microseconds or on average {} microseconds/point",
-            msCalc, static_cast<double>(msCalc) / static_cast<double>(computationPoints.size()));
-        POLYHEDRAL_GRAVITY_LOG_INFO("####################################################################################");
-
-        //The results
-        if (!outputFileName.empty()) {
+        if (outputFileName.empty()) {
+            POLYHEDRAL_GRAVITY_LOG_WARN("No output filename was specified!");
+        } else {
             POLYHEDRAL_GRAVITY_LOG_INFO("Writing results to specified output file {}", outputFileName);
-            const CSVWriter csvWriter{outputFileName};
-            csvWriter.printResult(computationPoints, result);
-            POLYHEDRAL_GRAVITY_LOG_INFO("Writing finished!");
+        }
+        const auto resultWriter = outputFileName.empty() ? nullptr : ResultWriter::fromFile(outputFileName, config->getOutputSeparateArrays());
+        const auto queueCapacity = config->getPipelineQueueCapacity();
+        if (queueCapacity) {
+            // Reading, evaluating, and writing run concurrently, so that the disk I/O is hidden behind the computation
+            POLYHEDRAL_GRAVITY_LOG_INFO("Reading, evaluating, and writing are pipelined with queues of {} chunks", *queueCapacity);
+            const Pipeline::Statistics statistics = Pipeline::run(*pointSource, evaluable, resultWriter.get(), chunkSize, *queueCapacity);
+            if (resultWriter) {
+                resultWriter->close();
+            }
+            POLYHEDRAL_GRAVITY_LOG_INFO("The pipeline processed {} computation points in {} seconds", statistics.write.points, statistics.totalSeconds);
+            const std::array<std::pair<const char *, const Pipeline::StageStatistics *>, 3> stages{{
+                    {"Read", &statistics.read}, {"Evaluate", &statistics.evaluate}, {"Write", &statistics.write}}};
+            for (const auto &[name, stage]: stages) {
+                POLYHEDRAL_GRAVITY_LOG_INFO("Stage {:<8} {} chunks, busy {:.3f} s, waiting {:.3f} s, {:.0f} points/s",
+                                            name, stage->chunks, stage->busySeconds, stage->waitingSeconds, stage->throughput());
+            }
+            POLYHEDRAL_GRAVITY_LOG_INFO("Queue Read -> Evaluate:  mean occupancy {:.2f} of {}, maximum {}",
+                                        statistics.readQueue.mean, statistics.readQueue.capacity, statistics.readQueue.maximum);
+            POLYHEDRAL_GRAVITY_LOG_INFO("Queue Evaluate -> Write: mean occupancy {:.2f} of {}, maximum {}",
+                                        statistics.writeQueue.mean, statistics.writeQueue.capacity, statistics.writeQueue.maximum);
+            const auto limitingStage = std::max_element(stages.cbegin(), stages.cend(), [](const auto &lhs, const auto &rhs) {
+                return lhs.second->busySeconds < rhs.second->busySeconds;
+            });
+            POLYHEDRAL_GRAVITY_LOG_INFO("The limiting stage is: {}", limitingStage->first);
         } else {
-            POLYHEDRAL_GRAVITY_LOG_WARN("No output filename was specified!");
+            long long msCalc{0}, msWrite{0};
+            size_t pointCount{0};
+            // Only one chunk of points and its results resides in memory at a time
+            std::vector<Array3> computationPoints{};
+            while (pointSource->read(computationPoints, chunkSize) > 0) {
+                const auto startCalc = std::chrono::high_resolution_clock::now();
+                const auto result = std::get<std::vector<GravityModelResult>>(evaluable(computationPoints, true));
+                const auto endCalc = std::chrono::high_resolution_clock::now();
+                if (resultWriter) {
+                    resultWriter->write(computationPoints, result);
+                }
+                const auto endWrite = std::chrono::high_resolution_clock::now();
+                msCalc += std::chrono::duration_cast<std::chrono::microseconds>(endCalc - startCalc).count();
+                msWrite += std::chrono::duration_cast<std::chrono::microseconds>(endWrite - endCalc).count();
+                pointCount += computationPoints.size();
+                POLYHEDRAL_GRAVITY_LOG_DEBUG("Evaluated and written {} computation points so far", pointCount);
+            }
+
+            POLYHEDRAL_GRAVITY_LOG_INFO("The calculation of the Gravity Model has finished. It took {} microseconds or on average {} microseconds/point",
+                msCalc, static_cast<double>(msCalc) / static_cast<double>(pointCount));
+            if (resultWriter) {
+                resultWriter->close();
+                POLYHEDRAL_GRAVITY_LOG_INFO("Writing the results of {} computation points finished! It took {} microseconds.", pointCount, msWrite);
+            }
         }
+        POLYHEDRAL_GRAVITY_LOG_INFO("####################################################################################");
 
         return 0;
 
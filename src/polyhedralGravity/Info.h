@@ -0,0 +1,37 @@
+#pragma once
+
+#include <string_view>
+
+// ##########################################################################################
+// Please note! The content of this file is automatically modified by the CMake build system
+// which replaces the variables
+// ##########################################################################################
+
+namespace polyhedralGravity {
+
+    /**
+     * The API's version of the polyhedral gravity model's interface.
+     * The value is set by the CMake configuration.
+     */
+    constexpr std::string_view POLYHEDRAL_GRAVITY_VERSION = "3.3.1";
+
+    /**
+     * The API's parallelization backend of the polyhedral gravity model's interface.
+     * The value is set by the CMake configuration.
+     */
+    constexpr std::string_view POLYHEDRAL_GRAVITY_PARALLELIZATION = "CPP";
+
+    /**
+     * The commit hash of the currently compiled version.
+     * This is appended with '+modified' in case the working tree is not clean.
+     * The value is set by the CMake configuration.
+     */
+    constexpr std::string_view POLYHEDRAL_GRAVITY_COMMIT_HASH = "8ce11426";
+
+    /**
+     * The API's Logging Level. Determines the amount of output.
+     * The value is set by the CMake configuration.
+     */
+    constexpr std::string_view POLYHEDRAL_GRAVITY_LOGGING_LEVEL = "INFO";
+
+}// namespace polyhedralGravity
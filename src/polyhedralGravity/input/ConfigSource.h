@@ -4,6 +4,9 @@
 #include <tuple>
 #include <vector>
 #include <array>
+#include <memory>
+#include <optional>
+#include "PointSource.h"
 #include "polyhedralGravity/model/PolyhedronDefinitions.h"
 
 namespace polyhedralGravity {
@@ -25,6 +28,13 @@ namespace polyhedralGravity {
          */
         virtual std::string getOutputFileName() = 0;
 
+        /**
+         * Returns whether a .npy output should consist of separate arrays for the points, potentials, accelerations,
+         * and tensors instead of one structured array.
+         * @return true if separate arrays are written
+         */
+        virtual bool getOutputSeparateArrays() = 0;
+
         /**
          * Returns the constant density rho of the given polyhedron.
          * The unit must match to the mesh, e.g., mesh in @f$[m]@f$ requires density in @f$[kg/m^3]@f$.
@@ -40,6 +50,26 @@ namespace polyhedralGravity {
          */
         virtual std::vector<std::array<double, 3>> getPointsOfInterest() = 0;
 
+        /**
+         * Returns a source reading the points for which the polyhedral gravity model should be evaluated
+         * in bounded chunks, so that an arbitrary number of points can be processed with constant memory.
+         * @return the point source
+         */
+        virtual std::unique_ptr<PointSource> getPointSource() = 0;
+
+        /**
+         * Returns the maximal number of computation points which are read, evaluated, and written at once.
+         * @return the chunk size
+         */
+        virtual size_t getChunkSize() = 0;
+
+        /**
+         * Returns the capacity of the queues between the stages if reading, evaluating, and writing the chunks
+         * of computation points should be pipelined, i.e. run concurrently.
+         * @return the number of chunks per queue or std::nullopt if the chunks are processed one after another
+         */
+        virtual std::optional<size_t> getPipelineQueueCapacity() = 0;
+
         /**
          * Returns the activation status of the input polyhedron mesh sanity check.
          * @return true if enabled
@@ -52,6 +82,18 @@ namespace polyhedralGravity {
          */
         virtual PolyhedralSource getPolyhedralSource() = 0;
 
+        /**
+         * Returns the names of the files specifying the polyhedron, e.g. to identify the mesh of a snapshot.
+         * @return the file names
+         */
+        virtual std::vector<std::string> getPolyhedronFileNames() = 0;
+
+        /**
+         * Returns the tolerance for welding the vertices of binary STL and PLY files (see {@link MeshReader::weldVertices}).
+         * @return the tolerance
+         */
+        virtual double getWeldTolerance() = 0;
+
         /**
          * Returns the unit of measurement used for the polyhedron mesh.
          * This specifies the physical unit in which the mesh dimensions are defined.
@@ -60,6 +102,13 @@ namespace polyhedralGravity {
          */
         virtual MetricUnit getMeshUnit() = 0;
 
+        /**
+         * Returns the name of the binary snapshot file of the polyhedron and its precomputed caches.
+         * If the file exists, it replaces reading and checking the mesh, otherwise it is created.
+         * @return a std::string with the filename or an empty string if no snapshot is specified
+         */
+        virtual std::string getSnapshotFileName() = 0;
+
     };
 
 }
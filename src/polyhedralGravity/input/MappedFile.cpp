@@ -0,0 +1,70 @@
+#include "MappedFile.h"
+
+namespace polyhedralGravity {
+
+    MappedFile::MappedFile(const std::string &filename) {
+#ifdef POLYHEDRAL_GRAVITY_MMAP
+        const int fileDescriptor = ::open(filename.c_str(), O_RDONLY);
+        if (fileDescriptor < 0) {
+            throw std::runtime_error("Could not open file " + filename + " for reading.");
+        }
+        this->map(fileDescriptor, filename, MAP_PRIVATE);
+#else
+        std::ifstream file(filename, std::ios::binary | std::ios::ate);
+        if (!file) {
+            throw std::runtime_error("Could not open file " + filename + " for reading.");
+        }
+        _size = static_cast<size_t>(file.tellg());
+        _buffer.resize(_size);
+        file.seekg(0);
+        file.read(_buffer.data(), static_cast<std::streamsize>(_size));
+        _data = _buffer.data();
+#endif
+    }
+
+    std::unique_ptr<MappedFile> MappedFile::openSharedMemory(const std::string &name) {
+#ifdef POLYHEDRAL_GRAVITY_MMAP
+        const int fileDescriptor = ::shm_open(name.c_str(), O_RDONLY, 0);
+        if (fileDescriptor < 0) {
+            throw std::runtime_error("Could not open the shared-memory object " + name + ".");
+        }
+        std::unique_ptr<MappedFile> file{new MappedFile{}};
+        file->map(fileDescriptor, name, MAP_SHARED);
+        return file;
+#else
+        throw std::runtime_error("Could not open the shared-memory object " + name + ", shared memory is not supported on this system.");
+#endif
+    }
+
+#ifdef POLYHEDRAL_GRAVITY_MMAP
+    void MappedFile::map(int fileDescriptor, const std::string &name, int flags) {
+        struct stat fileStatus{};
+        if (::fstat(fileDescriptor, &fileStatus) != 0) {
+            ::close(fileDescriptor);
+            throw std::runtime_error("Could not determine the size of file " + name + ".");
+        }
+        _size = static_cast<size_t>(fileStatus.st_size);
+        // Mapping a file of size zero fails, an empty view is returned instead
+        if (_size > 0) {
+            void *mapping = ::mmap(nullptr, _size, PROT_READ, flags, fileDescriptor, 0);
+            if (mapping == MAP_FAILED) {
+                ::close(fileDescriptor);
+                throw std::runtime_error("Could not memory-map file " + name + ".");
+            }
+            ::madvise(mapping, _size, MADV_WILLNEED);
+            _data = static_cast<const char *>(mapping);
+        }
+        // The mapping stays valid after closing the file descriptor
+        ::close(fileDescriptor);
+    }
+#endif
+
+    MappedFile::~MappedFile() {
+#ifdef POLYHEDRAL_GRAVITY_MMAP
+        if (_data != nullptr) {
+            ::munmap(const_cast<char *>(_data), _size);
+        }
+#endif
+    }
+
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+#include <algorithm>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define POLYHEDRAL_GRAVITY_MMAP
+#endif
+
+namespace polyhedralGravity {
+
+    /**
+     * Read-only view of a file's content.
+     * On POSIX systems, the file is memory-mapped, so that no copy of the file exists in user-space and multiple
+     * threads can parse different parts of the file concurrently. On other systems, the file is read into memory.
+     * Alternatively, a POSIX shared-memory object can be mapped (see {@link openSharedMemory}).
+     */
+    class MappedFile {
+
+        /** Pointer to the beginning of the file's content */
+        const char *_data{nullptr};
+
+        /** The size of the file in bytes */
+        size_t _size{0};
+
+        /** The content of the file if memory-mapping is not available */
+        std::vector<char> _buffer{};
+
+    public:
+        /**
+         * Maps the file into memory.
+         * @param filename the file's name
+         * @throws std::runtime_error if the file cannot be opened or mapped
+         */
+        explicit MappedFile(const std::string &filename);
+
+        /**
+         * Maps the POSIX shared-memory object with the given name read-only into memory.
+         * Every process mapping the object shares the same physical pages.
+         * @param name the name of the shared-memory object (e.g. "/polyhedron")
+         * @return the mapping
+         * @throws std::runtime_error if the object does not exist or shared memory is not supported on this system
+         */
+        static std::unique_ptr<MappedFile> openSharedMemory(const std::string &name);
+
+        MappedFile(const MappedFile &) = delete;
+
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        /**
+         * Unmaps the file.
+         */
+        ~MappedFile();
+
+        /**
+         * Returns the content of the file.
+         * @return the content as string_view, valid as long as the MappedFile lives
+         */
+        [[nodiscard]] std::string_view view() const {
+            return {_data, _size};
+        }
+
+        /**
+         * Returns a pointer to the content of the file.
+         * @return pointer to the first byte
+         */
+        [[nodiscard]] const char *data() const {
+            return _data;
+        }
+
+        /**
+         * Returns the size of the file.
+         * @return the size in bytes
+         */
+        [[nodiscard]] size_t size() const {
+            return _size;
+        }
+
+        /**
+         * Returns the number of chunks a file of this size should be split into for parsing it in parallel.
+         * Every chunk has at least one MiB, so that small files are parsed by one thread.
+         * @return the number of chunks
+         */
+        [[nodiscard]] size_t parallelChunkCount() const {
+            constexpr size_t MIN_CHUNK_SIZE = 1 << 20;
+            const size_t threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+            return std::clamp<size_t>(_size / MIN_CHUNK_SIZE, 1, 4 * threads);
+        }
+
+    private:
+
+        MappedFile() = default;
+
+#ifdef POLYHEDRAL_GRAVITY_MMAP
+        /**
+         * Maps the opened file read-only into memory and closes the file descriptor.
+         * @param fileDescriptor the opened file
+         * @param name the file's name (for error messages)
+         * @param flags the flags of the mapping, i.e. MAP_PRIVATE or MAP_SHARED
+         * @throws std::runtime_error if the file cannot be mapped
+         */
+        void map(int fileDescriptor, const std::string &name, int flags);
+#endif
+    };
+
+}
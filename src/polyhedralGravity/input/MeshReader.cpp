@@ -1,11 +1,15 @@
 #include "MeshReader.h"
 
+#include "MappedFile.h"
 #include "TetgenAdapter.h"
 #include "polyhedralGravity/util/UtilityString.h"
 
 namespace polyhedralGravity {
 
-    PolyhedralSource MeshReader::getPolyhedralSource(const std::vector<std::string> &fileNames) {
+    PolyhedralSource MeshReader::getPolyhedralSource(const std::vector<std::string> &fileNames, double weldTolerance) {
+        if (weldTolerance < 0.0 || std::isnan(weldTolerance)) {
+            throw std::invalid_argument("The welding tolerance must not be negative.");
+        }
         // Input Sanity Check if the files exists
         for (const auto &fileName: fileNames) {
             if (!std::filesystem::exists(fileName)) {
@@ -18,12 +22,20 @@ namespace polyhedralGravity {
             case 1:
                 if (util::ends_with(fileNames[0], ".obj", ".tab")) {
                     return readObj(fileNames[0]);
+                } else if (util::ends_with(fileNames[0], ".stl")) {
+                    return readStl(fileNames[0], weldTolerance);
+                } else if (util::ends_with(fileNames[0], ".ply")) {
+                    return readPly(fileNames[0], weldTolerance);
                 } else {
                     // The TetGen Adapter complains if the suffix is unknown
                     // No need to check for suffices here, as this happens later anyway
                     return readTetgenFormat(fileNames);
                 }
             case 2:
+                if ((util::ends_with(fileNames[0], ".node") && util::ends_with(fileNames[1], ".face")) ||
+                    (util::ends_with(fileNames[0], ".face") && util::ends_with(fileNames[1], ".node"))) {
+                    return readNodeFace(fileNames);
+                }
                 // The TetGen Adapter complains if the suffix is unknown
                 // No need to check for suffices here, as this happens later anyway
                 return readTetgenFormat(fileNames);
@@ -37,33 +49,581 @@ namespace polyhedralGravity {
         return TetgenAdapter{fileNames}.getPolyhedralSource();
     }
 
+    PolyhedralSource MeshReader::readNodeFace(const std::vector<std::string> &fileNames) {
+        const bool nodeFirst = util::ends_with(fileNames[0], ".node");
+        const auto [vertices, firstIndex] = readNode(fileNames[nodeFirst ? 0 : 1]);
+        std::vector<IndexArray3> faces = readFace(fileNames[nodeFirst ? 1 : 0]);
+        if (std::any_of(faces.cbegin(), faces.cend(), [&vertices = vertices, firstIndex = firstIndex](const IndexArray3 &face) {
+                return std::any_of(face.cbegin(), face.cend(), [&](size_t index) {
+                    return index < firstIndex || index >= vertices.size() + firstIndex;
+                });
+            })) {
+            throw std::runtime_error("The file " + fileNames[nodeFirst ? 1 : 0] + " contains a face referring to a non-existing node.");
+        }
+        return {vertices, faces};
+    }
+
+    std::tuple<std::vector<Array3>, size_t> MeshReader::readNode(const std::string &filename) {
+        POLYHEDRAL_GRAVITY_LOG_DEBUG("Reading the file {}", filename);
+        const MappedFile file{filename};
+        const auto [header, body] = splitTetgenHeader(file.view());
+        long long nodeCount{-1}, dimension{-1};
+        const char *cursor = util::parseNumber(header.data(), header.data() + header.size(), nodeCount);
+        cursor = cursor != nullptr ? util::parseNumber(cursor, header.data() + header.size(), dimension) : nullptr;
+        if (cursor == nullptr || nodeCount < 0 || dimension != 3) {
+            throw std::runtime_error("The file " + filename + " has no valid header for three-dimensional nodes.");
+        }
+
+        const std::vector<std::string_view> chunks = util::splitIntoLineChunks(body, file.parallelChunkCount());
+        const std::vector<size_t> offsets = countTetgenDataLines(chunks);
+        const auto count = static_cast<size_t>(nodeCount);
+        if (offsets.back() < count) {
+            throw std::runtime_error("The file " + filename + " contains fewer nodes than announced in its header.");
+        }
+
+        std::vector<Array3> vertices(count);
+        size_t firstIndex{0};
+        std::vector<char> malformed(chunks.size(), false);
+        auto countingIterator = thrust::make_counting_iterator<size_t>(0);
+        thrust::for_each(thrust::device, countingIterator, countingIterator + chunks.size(), [&](const size_t chunk) {
+            size_t index = offsets[chunk];
+            util::forEachLine(chunks[chunk], [&](std::string_view line) {
+                if (index >= count || !isTetgenDataLine(line)) {
+                    return;
+                }
+                const char *last = line.data() + line.size();
+                long long nodeIndex{0};
+                const char *first = util::parseNumber(line.data(), last, nodeIndex);
+                // Only the coordinates are of interest, the attributes and the boundary marker are skipped
+                for (double &coordinate: vertices[index]) {
+                    first = first != nullptr ? util::parseNumber(first, last, coordinate) : nullptr;
+                }
+                malformed[chunk] |= first == nullptr || nodeIndex < 0;
+                // The index of the first node determines whether the indexing starts with zero or one
+                if (index == 0 && nodeIndex >= 0) {
+                    firstIndex = static_cast<size_t>(nodeIndex);
+                }
+                ++index;
+            });
+        });
+        if (std::find(malformed.cbegin(), malformed.cend(), true) != malformed.cend()) {
+            throw std::runtime_error("The file " + filename + " contains a malformed node.");
+        }
+        return {vertices, firstIndex};
+    }
+
+    std::vector<IndexArray3> MeshReader::readFace(const std::string &filename) {
+        POLYHEDRAL_GRAVITY_LOG_DEBUG("Reading the file {}", filename);
+        const MappedFile file{filename};
+        const auto [header, body] = splitTetgenHeader(file.view());
+        long long faceCount{-1};
+        if (util::parseNumber(header.data(), header.data() + header.size(), faceCount) == nullptr || faceCount < 0) {
+            throw std::runtime_error("The file " + filename + " has no valid header.");
+        }
+
+        const std::vector<std::string_view> chunks = util::splitIntoLineChunks(body, file.parallelChunkCount());
+        const std::vector<size_t> offsets = countTetgenDataLines(chunks);
+        const auto count = static_cast<size_t>(faceCount);
+        if (offsets.back() < count) {
+            throw std::runtime_error("The file " + filename + " contains fewer faces than announced in its header.");
+        }
+
+        std::vector<IndexArray3> faces(count);
+        std::vector<char> malformed(chunks.size(), false);
+        auto countingIterator = thrust::make_counting_iterator<size_t>(0);
+        thrust::for_each(thrust::device, countingIterator, countingIterator + chunks.size(), [&](const size_t chunk) {
+            size_t index = offsets[chunk];
+            util::forEachLine(chunks[chunk], [&](std::string_view line) {
+                if (index >= count || !isTetgenDataLine(line)) {
+                    return;
+                }
+                const char *last = line.data() + line.size();
+                long long value{0};
+                // The face's index is skipped, as is the boundary marker following the three nodes
+                const char *first = util::parseNumber(line.data(), last, value);
+                for (size_t &node: faces[index]) {
+                    first = first != nullptr ? util::parseNumber(first, last, value) : nullptr;
+                    malformed[chunk] |= value < 0;
+                    node = static_cast<size_t>(value);
+                }
+                malformed[chunk] |= first == nullptr;
+                ++index;
+            });
+        });
+        if (std::find(malformed.cbegin(), malformed.cend(), true) != malformed.cend()) {
+            throw std::runtime_error("The file " + filename + " contains a malformed face.");
+        }
+        return faces;
+    }
+
+    bool MeshReader::isTetgenDataLine(std::string_view line) {
+        const char *first = util::skipBlanks(line.data(), line.data() + line.size());
+        return first != line.data() + line.size() && *first != '#';
+    }
+
+    std::tuple<std::string_view, std::string_view> MeshReader::splitTetgenHeader(std::string_view content) {
+        size_t begin = 0;
+        while (begin < content.size()) {
+            size_t end = content.find('\n', begin);
+            end = end == std::string_view::npos ? content.size() : end;
+            const std::string_view line = content.substr(begin, end - begin);
+            if (isTetgenDataLine(line)) {
+                return {line, content.substr(std::min(end + 1, content.size()))};
+            }
+            begin = end + 1;
+        }
+        return {std::string_view{}, std::string_view{}};
+    }
+
+    std::vector<size_t> MeshReader::countTetgenDataLines(const std::vector<std::string_view> &chunks) {
+        std::vector<size_t> offsets(chunks.size() + 1, 0);
+        auto countingIterator = thrust::make_counting_iterator<size_t>(0);
+        thrust::for_each(thrust::device, countingIterator, countingIterator + chunks.size(), [&](const size_t chunk) {
+            util::forEachLine(chunks[chunk], [&](std::string_view line) {
+                offsets[chunk + 1] += isTetgenDataLine(line) ? 1 : 0;
+            });
+        });
+        std::partial_sum(offsets.cbegin(), offsets.cend(), offsets.begin());
+        return offsets;
+    }
+
     PolyhedralSource MeshReader::readObj(const std::string &filename) {
+        POLYHEDRAL_GRAVITY_LOG_DEBUG("Reading the file {}", filename);
+        const MappedFile file{filename};
+        const std::vector<std::string_view> chunks = util::splitIntoLineChunks(file.view(), file.parallelChunkCount());
+
+        // 1. Step: Count the vertices and triangles per chunk, so that every chunk knows where to write its output
+        // and how many vertices precede it (required for resolving negative indices)
+        std::vector<ObjChunk> objChunks(chunks.size());
+        auto countingIterator = thrust::make_counting_iterator<size_t>(0);
+        thrust::for_each(thrust::device, countingIterator, countingIterator + chunks.size(), [&](const size_t index) {
+            ObjChunk &chunk = objChunks[index];
+            util::forEachLine(chunks[index], [&chunk](std::string_view line) {
+                const char *first = util::skipBlanks(line.data(), line.data() + line.size());
+                const char *last = line.data() + line.size();
+                if (isObjStatement(first, last, 'v')) {
+                    ++chunk.vertexCount;
+                } else if (isObjStatement(first, last, 'f')) {
+                    size_t corners = 0;
+                    for (first = util::skipBlanks(first + 1, last); first != last; first = util::skipBlanks(util::skipToken(first, last), last)) {
+                        ++corners;
+                    }
+                    // A polygon with n corners is triangulated into n - 2 triangles
+                    chunk.faceCount += corners >= 3 ? corners - 2 : 0;
+                    chunk.malformed |= corners < 3;
+                }
+            });
+        });
+        size_t vertexCount = 0, faceCount = 0;
+        for (ObjChunk &chunk: objChunks) {
+            if (chunk.malformed) {
+                throw std::runtime_error("The file " + filename + " contains a face with less than three vertices.");
+            }
+            chunk.vertexOffset = vertexCount;
+            chunk.faceOffset = faceCount;
+            vertexCount += chunk.vertexCount;
+            faceCount += chunk.faceCount;
+        }
+
+        // 2. Step: Parse the chunks directly into the preallocated output
+        std::vector<Array3> vertices(vertexCount);
+        std::vector<IndexArray3> faces(faceCount);
+        thrust::for_each(thrust::device, countingIterator, countingIterator + chunks.size(), [&](const size_t index) {
+            ObjChunk &chunk = objChunks[index];
+            size_t vertexIndex = chunk.vertexOffset;
+            size_t faceIndex = chunk.faceOffset;
+            util::forEachLine(chunks[index], [&](std::string_view line) {
+                const char *last = line.data() + line.size();
+                const char *first = util::skipBlanks(line.data(), last);
+                if (isObjStatement(first, last, 'v')) {
+                    Array3 &vertex = vertices[vertexIndex++];
+                    ++first;
+                    for (double &coordinate: vertex) {
+                        first = first != nullptr ? util::parseNumber(first, last, coordinate) : nullptr;
+                    }
+                    chunk.malformed |= first == nullptr;
+                } else if (isObjStatement(first, last, 'f')) {
+                    // The corners of a polygon are triangulated as fan around the first corner
+                    size_t corner = 0;
+                    size_t firstCorner = 0, previousCorner = 0;
+                    for (first = util::skipBlanks(first + 1, last); first != last; first = util::skipBlanks(util::skipToken(first, last), last)) {
+                        long long rawIndex{0};
+                        // Only the vertex index is of interest, texture and normal indices (v/vt/vn) are skipped
+                        if (util::parseNumber(first, last, rawIndex) == nullptr) {
+                            chunk.malformed = true;
+                            return;
+                        }
+                        // Negative indices refer to the vertices defined so far (-1 is the last one),
+                        // they are resolved to the one-based indices of the OBJ format
+                        if (rawIndex < 0) {
+                            rawIndex += static_cast<long long>(vertexIndex) + 1;
+                            if (rawIndex < 1) {
+                                chunk.malformed = true;
+                                return;
+                            }
+                        }
+                        const auto vertex = static_cast<size_t>(rawIndex);
+                        if (corner == 0) {
+                            firstCorner = vertex;
+                        } else if (corner >= 2) {
+                            faces[faceIndex++] = {firstCorner, previousCorner, vertex};
+                        }
+                        previousCorner = vertex;
+                        ++corner;
+                    }
+                }
+            });
+        });
+        if (std::any_of(objChunks.cbegin(), objChunks.cend(), [](const ObjChunk &chunk) { return chunk.malformed; })) {
+            throw std::runtime_error("The file " + filename + " contains a malformed vertex or face.");
+        }
+        return {vertices, faces};
+    }
+
+    bool MeshReader::isObjStatement(const char *first, const char *last, char keyword) {
+        return first != last && *first == keyword && (first + 1 == last || util::isBlank(*(first + 1)));
+    }
+
+    PolyhedralSource MeshReader::readStl(const std::string &filename, double tolerance) {
+        POLYHEDRAL_GRAVITY_LOG_DEBUG("Reading the file {}", filename);
+        // A binary STL consists of an 80 byte header, the number of triangles, and 50 bytes per triangle:
+        // the normal and the three vertices as float32 followed by a two byte attribute
+        constexpr size_t HEADER_SIZE = 84;
+        constexpr size_t TRIANGLE_SIZE = 50;
+        const MappedFile file{filename};
+        const size_t triangleCount = file.size() >= HEADER_SIZE
+                ? util::readBinary<uint32_t>(file.data() + 80, util::ByteOrder::LITTLE) : 0;
+        if (file.size() < HEADER_SIZE || file.size() != HEADER_SIZE + TRIANGLE_SIZE * triangleCount) {
+            POLYHEDRAL_GRAVITY_LOG_DEBUG("The file {} is no binary STL, delegating to TetGen", filename);
+            return readTetgenFormat({filename});
+        }
+
+        std::vector<Array3> vertices(3 * triangleCount);
+        std::vector<IndexArray3> faces(triangleCount);
+        auto countingIterator = thrust::make_counting_iterator<size_t>(0);
+        thrust::for_each(thrust::device, countingIterator, countingIterator + triangleCount, [&](const size_t index) {
+            // The facet normal is skipped as it is recomputed from the vertices anyway
+            const char *triangle = file.data() + HEADER_SIZE + TRIANGLE_SIZE * index + 3 * sizeof(float);
+            for (size_t corner = 0; corner < 3; ++corner) {
+                for (size_t axis = 0; axis < 3; ++axis) {
+                    vertices[3 * index + corner][axis] = util::readBinary<float>(
+                            triangle + (3 * corner + axis) * sizeof(float), util::ByteOrder::LITTLE);
+                }
+            }
+            faces[index] = {3 * index, 3 * index + 1, 3 * index + 2};
+        });
+        return weldVertices(vertices, faces, tolerance);
+    }
+
+    PolyhedralSource MeshReader::readPly(const std::string &filename, double tolerance) {
+        POLYHEDRAL_GRAVITY_LOG_DEBUG("Reading the file {}", filename);
+        const MappedFile file{filename};
+        const std::string_view content = file.view();
+        const size_t headerEnd = content.find("end_header");
+        if (content.substr(0, 3) != "ply" || headerEnd == std::string_view::npos) {
+            throw std::runtime_error("The file " + filename + " is no valid PLY file.");
+        }
+
+        // 1. Step: Parse the header consisting of the format and the elements with their properties
+        std::istringstream header{std::string{content.substr(0, headerEnd)}};
+        std::string line{}, format{};
+        std::vector<PlyElement> elements{};
+        while (std::getline(header, line)) {
+            std::istringstream lineStream{line};
+            // A fresh keyword per line, so that a blank line does not repeat the previous statement
+            std::string keyword{};
+            lineStream >> keyword;
+            if (keyword == "format") {
+                lineStream >> format;
+            } else if (keyword == "element") {
+                PlyElement element{};
+                lineStream >> element.name >> element.count;
+                elements.push_back(element);
+            } else if (keyword == "property" && !elements.empty()) {
+                PlyProperty property{};
+                std::string type{};
+                lineStream >> type;
+                if (type == "list") {
+                    std::string countType{};
+                    lineStream >> countType >> type;
+                    property.list = true;
+                    property.countType = readPlyType(countType);
+                }
+                property.type = readPlyType(type);
+                lineStream >> property.name;
+                elements.back().properties.push_back(property);
+            }
+        }
+        if (format == "ascii") {
+            POLYHEDRAL_GRAVITY_LOG_DEBUG("The file {} is an ASCII PLY, delegating to TetGen", filename);
+            return readTetgenFormat({filename});
+        } else if (format != "binary_little_endian" && format != "binary_big_endian") {
+            throw std::runtime_error("The file " + filename + " has the unknown PLY format '" + format + "'.");
+        }
+        const util::ByteOrder byteOrder = format == "binary_little_endian" ? util::ByteOrder::LITTLE : util::ByteOrder::BIG;
+
+        // 2. Step: Parse the elements' data following the header
+        const char *cursor = content.data() + content.find('\n', headerEnd) + 1;
+        const char *end = content.data() + content.size();
+        // Checks that count items of the given size follow the cursor (without the product overflowing)
+        const auto requireBytes = [&](size_t count, size_t size) {
+            if (size != 0 && count > static_cast<size_t>(end - cursor) / size) {
+                throw std::runtime_error("The file " + filename + " is truncated.");
+            }
+        };
+        // The faces are validated against the declared number of vertices, as the elements may come in any order
+        const auto vertexElement = std::find_if(elements.cbegin(), elements.cend(),
+                                                [](const PlyElement &element) { return element.name == "vertex"; });
+        const size_t vertexCount = vertexElement != elements.cend() ? vertexElement->count : 0;
         std::vector<Array3> vertices{};
         std::vector<IndexArray3> faces{};
-        POLYHEDRAL_GRAVITY_LOG_DEBUG("Reading the file {}", filename);
-        std::ifstream file(filename);
-        if (!file) {
-            throw std::runtime_error("Could not open file " + filename + " for reading.");
-        }
-        std::string line;
-        char prefix;
-        std::array<double, 3> vertex{};
-        std::array<size_t, 3> face{};
-        while (std::getline(file, line)) {
-            std::stringstream ss(line);
-            if (line.empty() || line[0] == '#') {
-                continue;
+        for (const PlyElement &element: elements) {
+            const bool fixedSize = std::none_of(element.properties.cbegin(), element.properties.cend(),
+                                                [](const PlyProperty &property) { return property.list; });
+            if (fixedSize) {
+                // Every item has the same size, so the items are located without parsing the preceding ones
+                std::vector<size_t> offsets{};
+                size_t stride = 0;
+                std::array<std::optional<size_t>, 3> coordinates{};
+                for (const PlyProperty &property: element.properties) {
+                    const auto axis = std::string{"xyz"}.find(property.name);
+                    if (element.name == "vertex" && property.name.size() == 1 && axis != std::string::npos) {
+                        coordinates[axis] = offsets.size();
+                    }
+                    offsets.push_back(stride);
+                    stride += plyTypeSize(property.type);
+                }
+                requireBytes(element.count, stride);
+                if (element.name == "vertex") {
+                    if (!coordinates[0] || !coordinates[1] || !coordinates[2]) {
+                        throw std::runtime_error("The vertices in file " + filename + " lack the x, y, or z property.");
+                    }
+                    vertices.resize(element.count);
+                    auto countingIterator = thrust::make_counting_iterator<size_t>(0);
+                    thrust::for_each(thrust::device, countingIterator, countingIterator + element.count, [&](const size_t index) {
+                        for (size_t axis = 0; axis < 3; ++axis) {
+                            const size_t property = *coordinates[axis];
+                            vertices[index][axis] = readPlyScalar(cursor + stride * index + offsets[property],
+                                                                  element.properties[property].type, byteOrder);
+                        }
+                    });
+                }
+                cursor += stride * element.count;
+            } else {
+                // Items of variable size (lists) are parsed one by one, polygonal faces are triangulated as fan
+                const bool isFace = element.name == "face";
+                if (isFace) {
+                    faces.reserve(element.count);
+                }
+                for (size_t index = 0; index < element.count; ++index) {
+                    for (const PlyProperty &property: element.properties) {
+                        const size_t size = plyTypeSize(property.type);
+                        if (!property.list) {
+                            requireBytes(1, size);
+                            cursor += size;
+                            continue;
+                        }
+                        requireBytes(1, plyTypeSize(property.countType));
+                        const double countValue = readPlyScalar(cursor, property.countType, byteOrder);
+                        cursor += plyTypeSize(property.countType);
+                        // The count is validated before converting it, a negative or huge count would otherwise wrap
+                        if (!(countValue >= 0.0) || countValue > static_cast<double>(end - cursor)) {
+                            throw std::runtime_error("The file " + filename + " contains a list with an invalid size.");
+                        }
+                        const auto count = static_cast<size_t>(countValue);
+                        requireBytes(count, size);
+                        if (isFace && (property.name == "vertex_indices" || property.name == "vertex_index")) {
+                            if (count < 3) {
+                                throw std::runtime_error("The file " + filename + " contains a face with less than three vertices.");
+                            }
+                            // Like the count, every corner is validated before converting it
+                            std::vector<size_t> corners(count);
+                            for (size_t k = 0; k < count; ++k) {
+                                const double cornerValue = readPlyScalar(cursor + k * size, property.type, byteOrder);
+                                if (!(cornerValue >= 0.0) || cornerValue >= static_cast<double>(vertexCount)) {
+                                    throw std::runtime_error("The file " + filename + " contains a face referring to a non-existing vertex.");
+                                }
+                                corners[k] = static_cast<size_t>(cornerValue);
+                            }
+                            for (size_t k = 2; k < count; ++k) {
+                                faces.push_back({corners[0], corners[k - 1], corners[k]});
+                            }
+                        }
+                        cursor += count * size;
+                    }
+                }
             }
+        }
+        if (std::any_of(faces.cbegin(), faces.cend(), [&vertices](const IndexArray3 &face) {
+                return std::any_of(face.cbegin(), face.cend(), [&vertices](size_t index) { return index >= vertices.size(); });
+            })) {
+            throw std::runtime_error("The file " + filename + " contains a face referring to a non-existing vertex.");
+        }
+        return weldVertices(vertices, faces, tolerance);
+    }
+
+    PolyhedralSource MeshReader::weldVertices(const std::vector<Array3> &vertices, const std::vector<IndexArray3> &faces,
+                                              double tolerance) {
+        using Cell = std::array<int64_t, 3>;
+        if (tolerance < 0.0 || std::isnan(tolerance)) {
+            throw std::invalid_argument("The welding tolerance must not be negative.");
+        }
+        const size_t n = vertices.size();
+        // The cell indices (and their neighbours) must be representable, which excludes non-finite coordinates and
+        // coordinates exceeding 2^62 times the tolerance
+        if (tolerance > 0.0 && thrust::any_of(thrust::device, vertices.cbegin(), vertices.cend(), [tolerance](const Array3 &vertex) {
+                return std::any_of(vertex.cbegin(), vertex.cend(), [tolerance](double coordinate) {
+                    return !(std::abs(coordinate / tolerance) < 0x1p62);
+                });
+            })) {
+            throw std::invalid_argument("The vertices must be finite and not exceed 2^62 times the welding tolerance.");
+        }
 
-            if (line[0] == 'v') {
-                ss >> prefix >> vertex[0] >> vertex[1] >> vertex[2];
-                vertices.push_back(vertex);
-            } else if (line[0] == 'f') {
-                ss >> prefix >> face[0] >> face[1] >> face[2];
-                faces.push_back(face);
+        // 1. Step: Hash every vertex to its cell. Without tolerance, the cell is the bit pattern of the coordinates
+        // (adding zero turns -0.0 into 0.0, so that both are merged)
+        std::vector<Cell> cells(n);
+        thrust::transform(thrust::device, vertices.cbegin(), vertices.cend(), cells.begin(), [tolerance](const Array3 &vertex) {
+            Cell cell{};
+            for (size_t axis = 0; axis < 3; ++axis) {
+                if (tolerance > 0.0) {
+                    cell[axis] = static_cast<int64_t>(std::floor(vertex[axis] / tolerance));
+                } else {
+                    const double coordinate = vertex[axis] + 0.0;
+                    std::memcpy(&cell[axis], &coordinate, sizeof(double));
+                }
+            }
+            return cell;
+        });
+
+        // 2. Step: Sort the vertices by their cell, ties are broken by the index
+        std::vector<size_t> order(n);
+        thrust::sequence(thrust::device, order.begin(), order.end());
+        thrust::sort(thrust::device, order.begin(), order.end(), [&cells](const size_t lhs, const size_t rhs) {
+            return std::tie(cells[lhs], lhs) < std::tie(cells[rhs], rhs);
+        });
+        std::vector<size_t> representative(n);
+        if (tolerance == 0.0) {
+            // Identical vertices share their cell, the first vertex of every cell is its representative
+            for (size_t begin = 0, end = 0; begin < n; begin = end) {
+                while (end < n && cells[order[end]] == cells[order[begin]]) {
+                    representative[order[end++]] = order[begin];
+                }
+            }
+        } else {
+            // Vertices within the tolerance lie in the same or in one of the 26 neighbouring cells (as the cells'
+            // edge length is the tolerance). Every vertex is merged into the first preceding representative within
+            // the tolerance, otherwise it becomes a representative itself. This loop is serial, as every vertex
+            // depends on the merges of the preceding ones
+            using util::operator-;
+            const auto lessCell = [&cells](size_t lhs, const Cell &rhs) { return cells[lhs] < rhs; };
+            for (size_t index = 0; index < n; ++index) {
+                representative[index] = index;
+                const Cell &cell = cells[index];
+                for (int64_t dx = -1; dx <= 1; ++dx) {
+                    for (int64_t dy = -1; dy <= 1; ++dy) {
+                        for (int64_t dz = -1; dz <= 1; ++dz) {
+                            const Cell neighbour{cell[0] + dx, cell[1] + dy, cell[2] + dz};
+                            // The vertices of a cell are sorted by their index, only preceding ones are candidates
+                            for (auto candidate = std::lower_bound(order.cbegin(), order.cend(), neighbour, lessCell);
+                                 candidate != order.cend() && cells[*candidate] == neighbour && *candidate < representative[index];
+                                 ++candidate) {
+                                if (representative[*candidate] == *candidate &&
+                                    util::euclideanNorm(vertices[*candidate] - vertices[index]) <= tolerance) {
+                                    representative[index] = *candidate;
+                                    break;
+                                }
+                            }
+                        }
+                    }
+                }
             }
         }
-        file.close();
-        return {vertices, faces};
+
+        // 3. Step: Assign the new indices in order of the first occurrence (a representative precedes its duplicates)
+        std::vector<size_t> newIndex(n);
+        std::vector<Array3> weldedVertices{};
+        weldedVertices.reserve(n);
+        for (size_t index = 0; index < n; ++index) {
+            if (representative[index] == index) {
+                newIndex[index] = weldedVertices.size();
+                weldedVertices.push_back(vertices[index]);
+            } else {
+                newIndex[index] = newIndex[representative[index]];
+            }
+        }
+
+        // 4. Step: Update the faces and remove those which collapsed
+        std::vector<IndexArray3> weldedFaces(faces.size());
+        thrust::transform(thrust::device, faces.cbegin(), faces.cend(), weldedFaces.begin(), [&newIndex](const IndexArray3 &face) {
+            return IndexArray3{newIndex[face[0]], newIndex[face[1]], newIndex[face[2]]};
+        });
+        const auto collapsed = std::remove_if(weldedFaces.begin(), weldedFaces.end(), [](const IndexArray3 &face) {
+            return face[0] == face[1] || face[1] == face[2] || face[0] == face[2];
+        });
+        if (collapsed != weldedFaces.end()) {
+            POLYHEDRAL_GRAVITY_LOG_WARN("Welding the vertices collapsed {} faces, which are removed", std::distance(collapsed, weldedFaces.end()));
+            weldedFaces.erase(collapsed, weldedFaces.end());
+        }
+        POLYHEDRAL_GRAVITY_LOG_DEBUG("Welded {} vertices into {} vertices", n, weldedVertices.size());
+        return {weldedVertices, weldedFaces};
+    }
+
+    MeshReader::PlyType MeshReader::readPlyType(const std::string &name) {
+        if (name == "char" || name == "int8") {
+            return PlyType::INT8;
+        } else if (name == "uchar" || name == "uint8") {
+            return PlyType::UINT8;
+        } else if (name == "short" || name == "int16") {
+            return PlyType::INT16;
+        } else if (name == "ushort" || name == "uint16") {
+            return PlyType::UINT16;
+        } else if (name == "int" || name == "int32") {
+            return PlyType::INT32;
+        } else if (name == "uint" || name == "uint32") {
+            return PlyType::UINT32;
+        } else if (name == "float" || name == "float32") {
+            return PlyType::FLOAT32;
+        } else if (name == "double" || name == "float64") {
+            return PlyType::FLOAT64;
+        }
+        throw std::runtime_error("The PLY data type '" + name + "' is unknown.");
+    }
+
+    size_t MeshReader::plyTypeSize(PlyType type) {
+        switch (type) {
+            case PlyType::INT8:
+            case PlyType::UINT8:
+                return 1;
+            case PlyType::INT16:
+            case PlyType::UINT16:
+                return 2;
+            case PlyType::INT32:
+            case PlyType::UINT32:
+            case PlyType::FLOAT32:
+                return 4;
+            default:
+                return 8;
+        }
+    }
+
+    double MeshReader::readPlyScalar(const char *data, PlyType type, util::ByteOrder byteOrder) {
+        switch (type) {
+            case PlyType::INT8:
+                return util::readBinary<int8_t>(data, byteOrder);
+            case PlyType::UINT8:
+                return util::readBinary<uint8_t>(data, byteOrder);
+            case PlyType::INT16:
+                return util::readBinary<int16_t>(data, byteOrder);
+            case PlyType::UINT16:
+                return util::readBinary<uint16_t>(data, byteOrder);
+            case PlyType::INT32:
+                return util::readBinary<int32_t>(data, byteOrder);
+            case PlyType::UINT32:
+                return util::readBinary<uint32_t>(data, byteOrder);
+            case PlyType::FLOAT32:
+                return util::readBinary<float>(data, byteOrder);
+            default:
+                return util::readBinary<double>(data, byteOrder);
+        }
     }
-}
\ No newline at end of file
+}
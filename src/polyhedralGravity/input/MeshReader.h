@@ -5,10 +5,26 @@
 #include <array>
 #include <fstream>
 #include <sstream>
+#include <cmath>
+#include <cstdint>
+#include <tuple>
+#include <optional>
+#include <algorithm>
+#include <cstring>
+#include <numeric>
 
 #include "polyhedralGravity/model/PolyhedronDefinitions.h"
 #include "polyhedralGravity/output/Logging.h"
 #include "polyhedralGravity/util/UtilityContainer.h"
+#include "polyhedralGravity/util/UtilityString.h"
+#include "polyhedralGravity/util/UtilityBinary.h"
+#include "thrust/for_each.h"
+#include "thrust/logical.h"
+#include "thrust/execution_policy.h"
+#include "thrust/iterator/counting_iterator.h"
+#include "thrust/sequence.h"
+#include "thrust/sort.h"
+#include "thrust/transform.h"
 #include <exception>
 #include <stdexcept>
 #include <filesystem>
@@ -23,24 +39,213 @@ namespace polyhedralGravity {
         /**
          * Returns a polyhedral source consisting of vertices and faces by reading mesh input files.
          * @param fileNames files specifying a polyhedron
+         * @param weldTolerance the tolerance for welding the vertices of binary STL and PLY files,
+         *          see {@link weldVertices} (default: zero, i.e. only identical vertices are merged)
          * @return polyhedral source consisting of vertices and faces
-         * @throws std::invalid_argument if the file type is unsupported by the implementation
+         * @throws std::invalid_argument if the file type is unsupported by the implementation or the tolerance is negative
          * @throws std::runtime_error if the provided files do not exist
          */
-        PolyhedralSource getPolyhedralSource(const std::vector<std::string> &fileNames);
+        PolyhedralSource getPolyhedralSource(const std::vector<std::string> &fileNames, double weldTolerance = 0.0);
 
         /**
          * Reads elements from a .obj file (Wavefront OBJ file format)
-         * This method only supports vertex (v) and faces (f) as input.
+         * This method only supports vertex (v) and faces (f) as input. Other statements (e.g. vt, vn) are skipped.
+         * The face's indices can be given as v, v/vt, v//vn, or v/vt/vn, where only the vertex index is read.
+         * Negative (relative) indices are resolved and polygons with more than three vertices are triangulated.
+         *
+         * The file is memory-mapped and split into chunks at line boundaries which are parsed in parallel.
+         * A first pass counts the vertices and faces per chunk, so that the second pass parses directly
+         * into the preallocated output without any per-line allocation.
          *
          * This is also the file format of polyhedrons in some datasets, e.g.,in
          * https://pds.nasa.gov/ds-view/pds/viewDataset.jsp?dsid=EAR-A-5-DDR-RADARSHAPE-MODELS-V2.0
          * However, the suffix for these files is .tab
          * @param filename of the input source without suffix
+         * @throws std::runtime_error if the file cannot be read or contains a malformed vertex or face
          * @see Refer to https://de.wikipedia.org/wiki/Wavefront_OBJ for further help with the format
          */
         PolyhedralSource readObj(const std::string &filename);
 
+        /**
+         * The per chunk bookkeeping of the parallel OBJ parser.
+         * @note This struct is basically a named tuple
+         */
+        struct ObjChunk {
+            /** The number of vertices in the chunk */
+            size_t vertexCount{0};
+            /** The number of (triangulated) faces in the chunk */
+            size_t faceCount{0};
+            /** The number of vertices in the preceding chunks */
+            size_t vertexOffset{0};
+            /** The number of faces in the preceding chunks */
+            size_t faceOffset{0};
+            /** True if the chunk contains a malformed vertex or face */
+            bool malformed{false};
+        };
+
+        /**
+         * Returns true if the line starting at first is an OBJ statement with the given single character keyword.
+         * @param first the first non-whitespace character of the line
+         * @param last the end of the line
+         * @param keyword the keyword, e.g. v or f
+         * @return true if the keyword is followed by whitespace (i.e. v matches, but vt does not)
+         */
+        bool isObjStatement(const char *first, const char *last, char keyword);
+
+        /**
+         * Reads a binary STL file (triangle soup) and welds its duplicated vertices.
+         * The triangles are parsed in parallel straight from the memory-mapped file.
+         * ASCII STL files are delegated to the TetgenAdapter.
+         * @param filename the STL file
+         * @param tolerance the welding tolerance, see {@link weldVertices}
+         * @return Polyhedral Source consisting of vertices and faces
+         * @throws std::runtime_error if the file cannot be read
+         */
+        PolyhedralSource readStl(const std::string &filename, double tolerance = 0.0);
+
+        /**
+         * Reads a binary (little or big endian) PLY file and welds its duplicated vertices.
+         * The vertices are parsed in parallel if the vertex element has a fixed size. Polygonal faces are triangulated.
+         * Further elements and properties are skipped. ASCII PLY files are delegated to the TetgenAdapter.
+         * @param filename the PLY file
+         * @param tolerance the welding tolerance, see {@link weldVertices}
+         * @return Polyhedral Source consisting of vertices and faces
+         * @throws std::runtime_error if the file cannot be read or is malformed
+         */
+        PolyhedralSource readPly(const std::string &filename, double tolerance = 0.0);
+
+        /**
+         * Merges duplicated vertices and updates the faces accordingly.
+         * Every vertex is merged into the first preceding vertex within the (Euclidean) tolerance which has not been
+         * merged itself. The candidates are found via a grid with the tolerance as edge length, which is sorted in
+         * parallel, by searching the vertex's cell and its 26 neighbouring cells. The search itself is serial, since
+         * every vertex depends on the merges of the preceding ones.
+         * A tolerance of zero merges only vertices with identical coordinates.
+         * The order of the first occurrences is retained, i.e. a mesh without duplicates is returned unchanged.
+         * Faces collapsing due to the merge are removed.
+         * @param vertices the vertices
+         * @param faces the faces (indexed starting with zero)
+         * @param tolerance the maximal distance of merged vertices
+         * @return Polyhedral Source consisting of the welded vertices and faces
+         * @throws std::invalid_argument if the tolerance is negative, or (given a positive tolerance) if a coordinate is
+         * non-finite or exceeds 2^62 times the tolerance
+         */
+        PolyhedralSource weldVertices(const std::vector<Array3> &vertices, const std::vector<IndexArray3> &faces,
+                                      double tolerance = 0.0);
+
+        /**
+         * The scalar data types of the PLY format.
+         */
+        enum class PlyType : char {
+            INT8, UINT8, INT16, UINT16, INT32, UINT32, FLOAT32, FLOAT64
+        };
+
+        /**
+         * A property of an element in a PLY file's header.
+         * @note This struct is basically a named tuple
+         */
+        struct PlyProperty {
+            /** The name of the property, e.g. x or vertex_indices */
+            std::string name;
+            /** The type of the property or of the items of a list */
+            PlyType type;
+            /** True if the property is a list */
+            bool list;
+            /** The type of the list's size */
+            PlyType countType;
+        };
+
+        /**
+         * An element (e.g. vertex or face) in a PLY file's header.
+         * @note This struct is basically a named tuple
+         */
+        struct PlyElement {
+            /** The name of the element */
+            std::string name;
+            /** The number of items of the element */
+            size_t count;
+            /** The properties of every item */
+            std::vector<PlyProperty> properties;
+        };
+
+        /**
+         * Converts the name of a PLY data type (e.g. uchar or uint8) to the PlyType.
+         * @param name the name of the type
+         * @return the type
+         * @throws std::runtime_error if the type is unknown
+         */
+        PlyType readPlyType(const std::string &name);
+
+        /**
+         * Returns the size of a PLY data type.
+         * @param type the type
+         * @return the size in bytes
+         */
+        size_t plyTypeSize(PlyType type);
+
+        /**
+         * Reads one binary PLY scalar.
+         * @param data pointer to the first byte of the scalar
+         * @param type the type of the scalar
+         * @param byteOrder the byte order of the file
+         * @return the value converted to double
+         */
+        double readPlyScalar(const char *data, PlyType type, util::ByteOrder byteOrder);
+
+        /**
+         * Reads a TetGen .node/.face file pair (given in any order) without the TetgenAdapter.
+         * Both files are memory-mapped and parsed in parallel chunks directly into the output.
+         * The face's indices are returned as given in the file, i.e. they start with the index of the first node.
+         * @param fileNames the .node and the .face file
+         * @return Polyhedral Source consisting of vertices and faces
+         * @throws std::runtime_error if a file is malformed or a face refers to a non-existing node
+         * @see Refer to https://wias-berlin.de/software/tetgen/fformats.html for further help with the format
+         */
+        PolyhedralSource readNodeFace(const std::vector<std::string> &fileNames);
+
+        /**
+         * Reads the nodes of a TetGen .node file.
+         * The header line is "<# of nodes> <dimension (3)> <# of attributes> <boundary markers (0 or 1)>",
+         * every following line is "<index> <x> <y> <z> [attributes] [boundary marker]".
+         * The attribute and boundary marker columns are skipped. Comments (starting with #) and blank lines are ignored.
+         * @param filename the .node file
+         * @return the nodes and the index of the first node (zero or one)
+         * @throws std::runtime_error if the file is malformed or contains fewer nodes than announced
+         */
+        std::tuple<std::vector<Array3>, size_t> readNode(const std::string &filename);
+
+        /**
+         * Reads the triangular faces of a TetGen .face file.
+         * The header line is "<# of faces> <boundary markers (0 or 1)>",
+         * every following line is "<index> <node> <node> <node> [boundary marker]".
+         * The boundary marker column is skipped. Comments (starting with #) and blank lines are ignored.
+         * @param filename the .face file
+         * @return the faces with the node indices as given in the file
+         * @throws std::runtime_error if the file is malformed or contains fewer faces than announced
+         */
+        std::vector<IndexArray3> readFace(const std::string &filename);
+
+        /**
+         * Returns true if the line is a data line of a TetGen file, i.e. neither blank nor a comment.
+         * @param line the line
+         * @return true if the line contains data
+         */
+        bool isTetgenDataLine(std::string_view line);
+
+        /**
+         * Splits the content of a TetGen file into its header, i.e. the first data line, and the lines following it.
+         * @param content the content of the file
+         * @return the header line and the remaining content
+         */
+        std::tuple<std::string_view, std::string_view> splitTetgenHeader(std::string_view content);
+
+        /**
+         * Counts the data lines of every chunk in parallel and returns the index of the first data line of every chunk.
+         * @param chunks the chunks of a TetGen file's content (consisting of complete lines)
+         * @return the prefix sum of the data line counts, the last element is the total count
+         */
+        std::vector<size_t> countTetgenDataLines(const std::vector<std::string_view> &chunks);
+
         /**
          * Reads elements from a file format supported by Tegen (.node/.face, .off, .ply, .stl, .mesh)
          *
@@ -0,0 +1,188 @@
+#include "PointSource.h"
+
+namespace polyhedralGravity {
+
+    std::unique_ptr<PointSource> PointSource::fromFile(const std::string &filename) {
+        if (!std::filesystem::exists(filename)) {
+            throw std::runtime_error("File '" + filename + "' does not exist.");
+        }
+        if (util::ends_with(filename, ".npy")) {
+            return std::make_unique<NpyPointSource>(filename);
+        } else if (util::ends_with(filename, ".csv", ".txt")) {
+            return std::make_unique<CSVPointSource>(filename);
+        } else {
+            return std::make_unique<BinaryPointSource>(filename);
+        }
+    }
+
+    size_t VectorPointSource::read(std::vector<Array3> &points, size_t maxCount) {
+        const size_t count = std::min(maxCount, _points.size() - _position);
+        points.assign(_points.cbegin() + _position, _points.cbegin() + _position + count);
+        _position += count;
+        return count;
+    }
+
+    std::optional<size_t> VectorPointSource::size() const {
+        return _points.size();
+    }
+
+    BinaryPointSource::BinaryPointSource(const std::string &filename)
+        : BinaryPointSource{filename, rawLayout(filename)} {
+    }
+
+    BinaryPointSource::BinaryPointSource(const std::string &filename, const Layout &layout)
+        : _layout{layout},
+          _stream{filename, std::ios::binary},
+          _remaining{layout.count} {
+        if (!_stream.is_open()) {
+            throw std::runtime_error("The file " + filename + " could not be opened.");
+        }
+        _stream.seekg(static_cast<std::streamoff>(_layout.offset));
+    }
+
+    size_t BinaryPointSource::read(std::vector<Array3> &points, size_t maxCount) {
+        const size_t count = std::min(maxCount, _remaining);
+        const size_t pointSize = 3 * _layout.coordinateSize;
+        _buffer.resize(count * pointSize);
+        points.resize(count);
+        if (count == 0) {
+            return 0;
+        }
+        // The whole chunk is read at once and then converted
+        if (!_stream.read(_buffer.data(), static_cast<std::streamsize>(_buffer.size()))) {
+            throw std::runtime_error("The binary point file ended unexpectedly.");
+        }
+        for (size_t i = 0; i < count; ++i) {
+            for (size_t j = 0; j < 3; ++j) {
+                const char *coordinate = _buffer.data() + i * pointSize + j * _layout.coordinateSize;
+                points[i][j] = _layout.coordinateSize == sizeof(double)
+                        ? util::readBinary<double>(coordinate, _layout.byteOrder)
+                        : static_cast<double>(util::readBinary<float>(coordinate, _layout.byteOrder));
+            }
+        }
+        _remaining -= count;
+        return count;
+    }
+
+    std::optional<size_t> BinaryPointSource::size() const {
+        return _layout.count;
+    }
+
+    BinaryPointSource::Layout BinaryPointSource::rawLayout(const std::string &filename) {
+        constexpr size_t POINT_SIZE = 3 * sizeof(double);
+        std::error_code error{};
+        const auto fileSize = static_cast<size_t>(std::filesystem::file_size(filename, error));
+        if (error || fileSize % POINT_SIZE != 0) {
+            throw std::runtime_error("The binary point file " + filename + " must consist of float64 triples, "
+                                     "but its size is no multiple of 24 bytes.");
+        }
+        return {0, fileSize / POINT_SIZE, sizeof(double), util::ByteOrder::LITTLE};
+    }
+
+    NpyPointSource::NpyPointSource(const std::string &filename)
+        : BinaryPointSource{filename, readHeader(filename)} {
+    }
+
+    BinaryPointSource::Layout NpyPointSource::readHeader(const std::string &filename) {
+        // The header consists of the magic string, the version, the length of the header, and a Python dict literal
+        // e.g. {'descr': '<f8', 'fortran_order': False, 'shape': (1000, 3), }
+        std::ifstream stream{filename, std::ios::binary};
+        char preamble[10]{};
+        if (!stream.read(preamble, sizeof(preamble)) || std::string_view{preamble, 6} != "\x93NUMPY") {
+            throw std::runtime_error("The file " + filename + " is no .npy file.");
+        }
+        const auto majorVersion = static_cast<uint8_t>(preamble[6]);
+        size_t headerLength = util::readBinary<uint16_t>(preamble + 8, util::ByteOrder::LITTLE);
+        size_t offset = sizeof(preamble);
+        if (majorVersion >= 2) {
+            // Version 2.0 and later use a four byte header length
+            char extension[2]{};
+            stream.read(extension, sizeof(extension));
+            char length[4]{preamble[8], preamble[9], extension[0], extension[1]};
+            headerLength = util::readBinary<uint32_t>(length, util::ByteOrder::LITTLE);
+            offset += sizeof(extension);
+        }
+        std::string header(headerLength, '\0');
+        if (!stream.read(header.data(), static_cast<std::streamsize>(headerLength))) {
+            throw std::runtime_error("The header of the .npy file " + filename + " is truncated.");
+        }
+        offset += headerLength;
+
+        const auto valueOf = [&header](const std::string &key) {
+            const size_t keyPosition = header.find("'" + key + "'");
+            const size_t colon = keyPosition == std::string::npos ? std::string::npos : header.find(':', keyPosition);
+            return colon == std::string::npos ? std::string_view{} : std::string_view{header}.substr(colon + 1);
+        };
+        const std::string_view descr = valueOf("descr");
+        const std::string_view fortranOrder = valueOf("fortran_order");
+        const std::string_view shape = valueOf("shape");
+        const size_t descrBegin = descr.find('\'');
+        const std::string_view type = descrBegin == std::string_view::npos ? std::string_view{} : descr.substr(descrBegin + 1, 3);
+        if (type.size() != 3 || (type[0] != '<' && type[0] != '>' && type[0] != '|' && type[0] != '=') ||
+            type[1] != 'f' || (type[2] != '8' && type[2] != '4')) {
+            throw std::runtime_error("The .npy file " + filename + " must contain float32 or float64 values.");
+        }
+        if (fortranOrder.size() < 6 || fortranOrder.substr(fortranOrder.find_first_not_of(' '), 5) != "False") {
+            throw std::runtime_error("The .npy file " + filename + " must be stored in C order.");
+        }
+        size_t count{0}, columns{0};
+        const size_t shapeBegin = shape.find('(');
+        const size_t shapeEnd = shape.find(')');
+        const char *first = nullptr;
+        if (shapeBegin != std::string_view::npos && shapeEnd != std::string_view::npos && shapeBegin < shapeEnd) {
+            const char *last = shape.data() + shapeEnd;
+            first = util::parseNumber(shape.data() + shapeBegin + 1, last, count);
+            first = first != nullptr && first != last && *first == ',' ? util::parseNumber(first + 1, last, columns) : nullptr;
+        }
+        if (first == nullptr || columns != 3) {
+            throw std::runtime_error("The .npy file " + filename + " must contain an array of shape (N, 3).");
+        }
+        const util::ByteOrder byteOrder = type[0] == '>' ? util::ByteOrder::BIG
+                : (type[0] == '<' ? util::ByteOrder::LITTLE : util::nativeByteOrder());
+        return {offset, count, static_cast<size_t>(type[2] - '0'), byteOrder};
+    }
+
+    CSVPointSource::CSVPointSource(const std::string &filename)
+        : _stream{filename},
+          _filename{filename} {
+        if (!_stream.is_open()) {
+            throw std::runtime_error("The file " + filename + " could not be opened.");
+        }
+    }
+
+    size_t CSVPointSource::read(std::vector<Array3> &points, size_t maxCount) {
+        points.clear();
+        while (points.size() < maxCount && std::getline(_stream, _line)) {
+            ++_lineNumber;
+            const char *last = _line.data() + _line.size();
+            const char *first = util::skipBlanks(_line.data(), last);
+            if (first == last || *first == '#') {
+                continue;
+            }
+            Array3 point{};
+            for (size_t i = 0; i < 3 && first != nullptr; ++i) {
+                first = util::parseNumber(first, last, point[i]);
+                // The coordinates are separated by whitespace and optionally a comma or semicolon
+                if (first != nullptr) {
+                    first = util::skipBlanks(first, last);
+                    first = first != last && (*first == ',' || *first == ';') ? first + 1 : first;
+                }
+            }
+            if (first == nullptr) {
+                // The first line may be a header naming the columns
+                if (_lineNumber == 1) {
+                    continue;
+                }
+                throw std::runtime_error("The file " + _filename + " contains a malformed point in line " +
+                                         std::to_string(_lineNumber) + ".");
+            }
+            points.push_back(point);
+        }
+        return points.size();
+    }
+
+    std::optional<size_t> CSVPointSource::size() const {
+        return std::nullopt;
+    }
+
+}
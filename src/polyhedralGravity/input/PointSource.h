@@ -0,0 +1,218 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "polyhedralGravity/model/PolyhedronDefinitions.h"
+#include "polyhedralGravity/output/Logging.h"
+#include "polyhedralGravity/util/UtilityBinary.h"
+#include "polyhedralGravity/util/UtilityString.h"
+
+namespace polyhedralGravity {
+
+    /**
+     * Interface for a sequential source of computation points which are read in bounded chunks.
+     * This enables evaluating an arbitrary number of points with constant memory, since only one chunk
+     * of points (and its results) resides in memory at a time.
+     */
+    class PointSource {
+
+    public:
+
+        /** Default Virtual Destructor */
+        virtual ~PointSource() = default;
+
+        /**
+         * Reads the next chunk of computation points.
+         * @param points the buffer the points are written to, it is cleared first (its capacity is retained)
+         * @param maxCount the maximal number of points to read
+         * @return the number of points read, zero if the source is exhausted
+         * @throws std::runtime_error if the source is malformed
+         */
+        virtual size_t read(std::vector<Array3> &points, size_t maxCount) = 0;
+
+        /**
+         * Returns the total number of points if it is known in advance.
+         * @return the number of points or std::nullopt if unknown (e.g. for a CSV file)
+         */
+        [[nodiscard]] virtual std::optional<size_t> size() const = 0;
+
+        /**
+         * Creates a point source reading the given file. The format is determined by the suffix:
+         * .npy (NumPy array of shape (N, 3)), .csv or .txt (one point per line), otherwise raw binary
+         * (float64 triples in little endian byte order).
+         * @param filename the file containing the points
+         * @return the point source
+         * @throws std::runtime_error if the file cannot be opened or has an invalid header
+         */
+        static std::unique_ptr<PointSource> fromFile(const std::string &filename);
+
+    };
+
+    /**
+     * Point source providing the points of an in-memory vector, e.g. read from the YAML configuration.
+     */
+    class VectorPointSource final : public PointSource {
+
+        /** The points */
+        const std::vector<Array3> _points;
+
+        /** The index of the next point to read */
+        size_t _position{0};
+
+    public:
+
+        /**
+         * Creates a new VectorPointSource.
+         * @param points the points
+         */
+        explicit VectorPointSource(std::vector<Array3> points) : _points{std::move(points)} {}
+
+        size_t read(std::vector<Array3> &points, size_t maxCount) override;
+
+        [[nodiscard]] std::optional<size_t> size() const override;
+
+    };
+
+    /**
+     * Point source reading consecutive (x, y, z) triples of floating point numbers from a binary file.
+     * This is the raw binary format and the data part of a .npy file.
+     */
+    class BinaryPointSource : public PointSource {
+
+    protected:
+
+        /**
+         * The layout of the points in a binary file.
+         * @note This struct is basically a named tuple
+         */
+        struct Layout {
+            /** The offset of the first point in bytes */
+            size_t offset;
+            /** The number of points */
+            size_t count;
+            /** The size of one coordinate in bytes, either 4 (float32) or 8 (float64) */
+            size_t coordinateSize;
+            /** The byte order of the coordinates */
+            util::ByteOrder byteOrder;
+        };
+
+    private:
+
+        /** The layout of the file */
+        const Layout _layout;
+
+        /** The input stream positioned at the next point */
+        std::ifstream _stream;
+
+        /** The number of remaining points */
+        size_t _remaining;
+
+        /** Buffer for the raw bytes of one chunk */
+        std::vector<char> _buffer{};
+
+    public:
+
+        /**
+         * Creates a new BinaryPointSource reading float64 triples in little endian byte order.
+         * @param filename the file containing the points
+         * @throws std::runtime_error if the file cannot be opened or its size is no multiple of 24 bytes
+         */
+        explicit BinaryPointSource(const std::string &filename);
+
+        size_t read(std::vector<Array3> &points, size_t maxCount) override;
+
+        [[nodiscard]] std::optional<size_t> size() const override;
+
+    protected:
+
+        /**
+         * Creates a new BinaryPointSource reading a file with the given layout.
+         * @param filename the file containing the points
+         * @param layout the layout of the points in the file
+         * @throws std::runtime_error if the file cannot be opened
+         */
+        BinaryPointSource(const std::string &filename, const Layout &layout);
+
+    private:
+
+        /**
+         * Determines the layout of a raw binary file of float64 triples in little endian byte order.
+         * @param filename the file containing the points
+         * @return the layout
+         * @throws std::runtime_error if the file cannot be read or its size is no multiple of 24 bytes
+         */
+        static Layout rawLayout(const std::string &filename);
+
+    };
+
+    /**
+     * Point source reading a NumPy .npy file containing a C-contiguous float32 or float64 array of shape (N, 3).
+     * @see Refer to https://numpy.org/doc/stable/reference/generated/numpy.lib.format.html for the format
+     */
+    class NpyPointSource final : public BinaryPointSource {
+
+    public:
+
+        /**
+         * Creates a new NpyPointSource.
+         * @param filename the .npy file
+         * @throws std::runtime_error if the file cannot be opened, has an invalid header, or an unsupported data type/ shape
+         */
+        explicit NpyPointSource(const std::string &filename);
+
+    private:
+
+        /**
+         * Parses the header of a .npy file.
+         * @param filename the .npy file
+         * @return the layout of the points
+         * @throws std::runtime_error if the header is invalid or the data type/ shape is unsupported
+         */
+        static Layout readHeader(const std::string &filename);
+
+    };
+
+    /**
+     * Point source reading a text file with one point per line, the coordinates separated by commas, semicolons, or
+     * whitespace. Blank lines, comments (starting with #), and a leading header line (e.g. x,y,z) are skipped.
+     */
+    class CSVPointSource final : public PointSource {
+
+        /** The input stream */
+        std::ifstream _stream;
+
+        /** The name of the file (for error messages) */
+        const std::string _filename;
+
+        /** The current line number (for error messages) */
+        size_t _lineNumber{0};
+
+        /** Buffer for the current line */
+        std::string _line{};
+
+    public:
+
+        /**
+         * Creates a new CSVPointSource.
+         * @param filename the file containing the points
+         * @throws std::runtime_error if the file cannot be opened
+         */
+        explicit CSVPointSource(const std::string &filename);
+
+        size_t read(std::vector<Array3> &points, size_t maxCount) override;
+
+        [[nodiscard]] std::optional<size_t> size() const override;
+
+    };
+
+}
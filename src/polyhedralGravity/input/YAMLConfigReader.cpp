@@ -13,6 +13,15 @@ namespace polyhedralGravity {
         }
     }
 
+    bool YAMLConfigReader::getOutputSeparateArrays() {
+        POLYHEDRAL_GRAVITY_LOG_DEBUG("Reading the output layout from the configuration file.");
+        if (_file[ROOT][OUTPUT] && _file[ROOT][OUTPUT][OUTPUT_SEPARATE_ARRAYS]) {
+            return _file[ROOT][OUTPUT][OUTPUT_SEPARATE_ARRAYS].as<bool>();
+        } else {
+            return false;
+        }
+    }
+
     double YAMLConfigReader::getDensity() {
         POLYHEDRAL_GRAVITY_LOG_DEBUG("Reading the density from the configuration file.");
         if (_file[ROOT][INPUT] && _file[ROOT][INPUT][INPUT_DENSITY]) {
@@ -24,13 +33,57 @@ namespace polyhedralGravity {
 
     std::vector<std::array<double, 3>> YAMLConfigReader::getPointsOfInterest() {
         POLYHEDRAL_GRAVITY_LOG_DEBUG("Reading the computation points from the configuration file.");
-        if (_file[ROOT][INPUT] && _file[ROOT][INPUT][INPUT_POINTS]) {
+        if (_file[ROOT][INPUT] && _file[ROOT][INPUT][INPUT_POINTS] && _file[ROOT][INPUT][INPUT_POINTS].IsScalar()) {
+            std::vector<Array3> points{}, chunk{};
+            const auto pointSource = getPointSource();
+            while (pointSource->read(chunk, getChunkSize()) > 0) {
+                points.insert(points.end(), chunk.cbegin(), chunk.cend());
+            }
+            return points;
+        } else if (_file[ROOT][INPUT] && _file[ROOT][INPUT][INPUT_POINTS]) {
             return _file[ROOT][INPUT][INPUT_POINTS].as<std::vector<std::array<double, 3>>>();
         } else {
             throw std::runtime_error{"There happened an error parsing the points of interest from the YAML config file!"};
         }
     }
 
+    std::unique_ptr<PointSource> YAMLConfigReader::getPointSource() {
+        if (_file[ROOT][INPUT] && _file[ROOT][INPUT][INPUT_POINTS] && _file[ROOT][INPUT][INPUT_POINTS].IsScalar()) {
+            POLYHEDRAL_GRAVITY_LOG_DEBUG("Reading the computation points' file name from the configuration file.");
+            return PointSource::fromFile(_file[ROOT][INPUT][INPUT_POINTS].as<std::string>());
+        } else {
+            return std::make_unique<VectorPointSource>(getPointsOfInterest());
+        }
+    }
+
+    size_t YAMLConfigReader::getChunkSize() {
+        POLYHEDRAL_GRAVITY_LOG_DEBUG("Reading the chunk size from the configuration file.");
+        if (_file[ROOT][INPUT] && _file[ROOT][INPUT][INPUT_CHUNK_SIZE]) {
+            const auto chunkSize = _file[ROOT][INPUT][INPUT_CHUNK_SIZE].as<size_t>();
+            if (chunkSize == 0) {
+                throw std::runtime_error{"The chunk size in the YAML config file must be positive!"};
+            }
+            return chunkSize;
+        } else {
+            return DEFAULT_CHUNK_SIZE;
+        }
+    }
+
+    std::optional<size_t> YAMLConfigReader::getPipelineQueueCapacity() {
+        POLYHEDRAL_GRAVITY_LOG_DEBUG("Reading the pipeline configuration from the configuration file.");
+        if (!_file[ROOT][PIPELINE]) {
+            return std::nullopt;
+        } else if (_file[ROOT][PIPELINE].IsMap() && _file[ROOT][PIPELINE][PIPELINE_QUEUE_CAPACITY]) {
+            const auto queueCapacity = _file[ROOT][PIPELINE][PIPELINE_QUEUE_CAPACITY].as<size_t>();
+            if (queueCapacity == 0) {
+                throw std::runtime_error{"The queue capacity of the pipeline in the YAML config file must be positive!"};
+            }
+            return queueCapacity;
+        } else {
+            return DEFAULT_QUEUE_CAPACITY;
+        }
+    }
+
     bool YAMLConfigReader::getMeshInputCheckStatus() {
         POLYHEDRAL_GRAVITY_LOG_DEBUG("Reading the activation of the input mesh sanity check from the configuration file.");
         if (_file[ROOT][INPUT] && _file[ROOT][INPUT][INPUT_CHECK]) {
@@ -41,15 +94,27 @@ namespace polyhedralGravity {
     }
 
     std::tuple<std::vector<Array3>, std::vector<IndexArray3>> YAMLConfigReader::getPolyhedralSource() {
+        return MeshReader::getPolyhedralSource(getPolyhedronFileNames(), getWeldTolerance());
+    }
+
+    std::vector<std::string> YAMLConfigReader::getPolyhedronFileNames() {
         POLYHEDRAL_GRAVITY_LOG_DEBUG("Reading the data sources (file names) from the configuration file.");
         if (_file[ROOT][INPUT] && _file[ROOT][INPUT][INPUT_POLYHEDRON]) {
-            const auto vectorOfFiles = _file[ROOT][INPUT][INPUT_POLYHEDRON].as<std::vector<std::string>>();
-            return MeshReader::getPolyhedralSource(vectorOfFiles);
+            return _file[ROOT][INPUT][INPUT_POLYHEDRON].as<std::vector<std::string>>();
         } else {
             throw std::runtime_error{"There happened an error parsing the DataSource of the Polyhedron from the config file"};
         }
     }
 
+    double YAMLConfigReader::getWeldTolerance() {
+        POLYHEDRAL_GRAVITY_LOG_DEBUG("Reading the welding tolerance from the configuration file.");
+        if (_file[ROOT][INPUT] && _file[ROOT][INPUT][INPUT_WELD_TOLERANCE]) {
+            return _file[ROOT][INPUT][INPUT_WELD_TOLERANCE].as<double>();
+        } else {
+            return 0.0;
+        }
+    }
+
     MetricUnit YAMLConfigReader::getMeshUnit() {
         POLYHEDRAL_GRAVITY_LOG_DEBUG("Reading the unit of the polyhedral mesh.");
         if (_file[ROOT][INPUT] && _file[ROOT][INPUT][INPUT_METRIC_UNIT]) {
@@ -60,5 +125,13 @@ namespace polyhedralGravity {
         }
     }
 
+    std::string YAMLConfigReader::getSnapshotFileName() {
+        POLYHEDRAL_GRAVITY_LOG_DEBUG("Reading the snapshot filename from the configuration file.");
+        if (_file[ROOT][INPUT] && _file[ROOT][INPUT][INPUT_SNAPSHOT]) {
+            return _file[ROOT][INPUT][INPUT_SNAPSHOT].as<std::string>();
+        } else {
+            return "";
+        }
+    }
 
 }
\ No newline at end of file
@@ -29,8 +29,20 @@ namespace polyhedralGravity {
         static constexpr char INPUT_POINTS[] = "points";
         static constexpr char INPUT_CHECK[] = "check_mesh";
         static constexpr char INPUT_METRIC_UNIT[] = "metric_unit";
+        static constexpr char INPUT_SNAPSHOT[] = "snapshot";
+        static constexpr char INPUT_WELD_TOLERANCE[] = "weld_tolerance";
+        static constexpr char INPUT_CHUNK_SIZE[] = "chunk_size";
         static constexpr char OUTPUT[] = "output";
         static constexpr char OUTPUT_FILENAME[] = "filename";
+        static constexpr char OUTPUT_SEPARATE_ARRAYS[] = "separate_arrays";
+        static constexpr char PIPELINE[] = "pipeline";
+        static constexpr char PIPELINE_QUEUE_CAPACITY[] = "queue_capacity";
+
+        /** The default number of computation points read, evaluated, and written at once */
+        static constexpr size_t DEFAULT_CHUNK_SIZE = 1 << 20;
+
+        /** The default number of chunks waiting between two stages of the pipeline */
+        static constexpr size_t DEFAULT_QUEUE_CAPACITY = 2;
 
 
         /**
@@ -71,6 +83,12 @@ namespace polyhedralGravity {
          */
         std::string getOutputFileName() override;
 
+        /**
+         * Reads whether a .npy output consists of separate arrays from the yaml configuration file.
+         * @return true if separate arrays are written, if not present defaults to false
+         */
+        bool getOutputSeparateArrays() override;
+
         /**
          * Reads the density from the yaml configuration file.
          * @return density as double
@@ -79,10 +97,31 @@ namespace polyhedralGravity {
 
         /**
          * Reads the computation points from the yaml configuration file.
+         * If the points are given as file name, the whole file is read.
          * @return vector of computation points
          */
         std::vector<std::array<double, 3>> getPointsOfInterest() override;
 
+        /**
+         * Returns the source of the computation points. The points are either given as list in the yaml configuration
+         * file or as the name of a file (.npy, .csv/.txt, or raw binary float64 triples).
+         * @return the point source
+         */
+        std::unique_ptr<PointSource> getPointSource() override;
+
+        /**
+         * Reads the number of computation points processed at once from the yaml configuration file.
+         * @return the chunk size, if not present defaults to 2^20
+         */
+        size_t getChunkSize() override;
+
+        /**
+         * Reads the pipeline configuration from the yaml configuration file. The pipeline is enabled by the presence
+         * of the pipeline node, which optionally contains the queue capacity.
+         * @return the queue capacity (defaults to 2) or std::nullopt if the pipeline node is not present
+         */
+        std::optional<size_t> getPipelineQueueCapacity() override;
+
         /**
          * Reads the enablement of the input sanity check from the yaml file.
          * @return true or false if explicitly enabled, otherwise per-default true
@@ -91,10 +130,23 @@ namespace polyhedralGravity {
 
         /**
          * Reads the DataSource from the yaml configuration file.
+         * The vertices of binary STL and PLY files are welded with the {@link getWeldTolerance}.
          * @return shared_ptr to the DataSource Object created
          */
         std::tuple<std::vector<Array3>, std::vector<IndexArray3>> getPolyhedralSource() override;
 
+        /**
+         * Reads the names of the polyhedron's files from the yaml configuration file.
+         * @return the file names
+         */
+        std::vector<std::string> getPolyhedronFileNames() override;
+
+        /**
+         * Reads the tolerance for welding the vertices of binary STL and PLY files from the yaml configuration file.
+         * @return the tolerance, if not present defaults to zero
+         */
+        double getWeldTolerance() override;
+
 
         /**
          * Retrieves the metric unit of the mesh as specified in the configuration.
@@ -103,6 +155,12 @@ namespace polyhedralGravity {
          */
         MetricUnit getMeshUnit() override;
 
+        /**
+         * Reads the name of the binary snapshot file from the yaml configuration file.
+         * @return the filename or an empty string if none is specified
+         */
+        std::string getSnapshotFileName() override;
+
 
     };
 
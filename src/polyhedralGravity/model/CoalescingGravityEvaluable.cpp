@@ -0,0 +1,108 @@
+#include "CoalescingGravityEvaluable.h"
+
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <stdexcept>
+
+namespace polyhedralGravity {
+
+    CoalescingGravityEvaluable::CoalescingGravityEvaluable(GravityEvaluable evaluable, size_t maxBatchSize,
+                                                           std::chrono::microseconds maxWait, bool parallelization)
+        : _evaluable{std::move(evaluable)},
+          _maxBatchSize{maxBatchSize},
+          _maxWait{maxWait},
+          _parallelization{parallelization} {
+        if (_maxBatchSize == 0) {
+            throw std::invalid_argument("The maximal batch size of a CoalescingGravityEvaluable must be positive.");
+        }
+        _pending.reserve(_maxBatchSize);
+        _dispatcher = std::thread{[this]() { this->dispatch(); }};
+    }
+
+    CoalescingGravityEvaluable::~CoalescingGravityEvaluable() {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _stopped = true;
+        }
+        _requestAdded.notify_all();
+        _dispatcher.join();
+    }
+
+    std::future<GravityModelResult> CoalescingGravityEvaluable::submit(const Array3 &computationPoint) {
+        std::promise<GravityModelResult> promise{};
+        std::future<GravityModelResult> future = promise.get_future();
+        bool notify{false};
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            if (_stopped) {
+                throw std::runtime_error("The CoalescingGravityEvaluable does not accept requests anymore.");
+            }
+            _pending.push_back(Request{computationPoint, std::move(promise), std::chrono::steady_clock::now()});
+            // The dispatcher only needs to wake up for the first request (to start the wait) and a full batch
+            notify = _pending.size() == 1 || _pending.size() == _maxBatchSize;
+        }
+        if (notify) {
+            _requestAdded.notify_one();
+        }
+        return future;
+    }
+
+    GravityModelResult CoalescingGravityEvaluable::operator()(const Array3 &computationPoint) {
+        return this->submit(computationPoint).get();
+    }
+
+    void CoalescingGravityEvaluable::dispatch() {
+        std::vector<Request> batch{};
+        batch.reserve(_maxBatchSize);
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock{_mutex};
+                _requestAdded.wait(lock, [this]() { return _stopped || !_pending.empty(); });
+                if (_pending.empty()) {
+                    return;
+                }
+                // The batch is evaluated once it is full, its first request waited long enough, or on destruction
+                _requestAdded.wait_until(lock, _pending.front().arrival + _maxWait, [this]() {
+                    return _stopped || _pending.size() >= _maxBatchSize;
+                });
+                const size_t size = std::min(_pending.size(), _maxBatchSize);
+                std::move(_pending.begin(), _pending.begin() + size, std::back_inserter(batch));
+                _pending.erase(_pending.begin(), _pending.begin() + size);
+                _statistics.requests += size;
+                _statistics.batches += 1;
+                _statistics.maximalBatchSize = std::max(_statistics.maximalBatchSize, size);
+            }
+            this->evaluateBatch(batch);
+            batch.clear();
+        }
+    }
+
+    void CoalescingGravityEvaluable::evaluateBatch(std::vector<Request> &batch) const {
+        std::vector<Array3> points{};
+        points.reserve(batch.size());
+        std::transform(batch.cbegin(), batch.cend(), std::back_inserter(points), [](const Request &request) {
+            return request.point;
+        });
+        try {
+            const auto results = std::get<std::vector<GravityModelResult>>(_evaluable(points, _parallelization));
+            for (size_t i = 0; i < batch.size(); ++i) {
+                batch[i].promise.set_value(results[i]);
+            }
+        } catch (...) {
+            for (auto &request: batch) {
+                request.promise.set_exception(std::current_exception());
+            }
+        }
+    }
+
+    CoalescingStatistics CoalescingGravityEvaluable::getStatistics() const {
+        std::lock_guard<std::mutex> lock{_mutex};
+        return _statistics;
+    }
+
+    const GravityEvaluable &CoalescingGravityEvaluable::getEvaluable() const {
+        return _evaluable;
+    }
+
+}// namespace polyhedralGravity
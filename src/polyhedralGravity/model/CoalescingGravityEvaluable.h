@@ -0,0 +1,154 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "GravityEvaluable.h"
+#include "GravityModelData.h"
+
+namespace polyhedralGravity {
+
+    /**
+     * The number of requests and batches a {@link CoalescingGravityEvaluable} has evaluated so far.
+     * @note This struct is basically a named tuple
+     */
+    struct CoalescingStatistics {
+        /** The number of evaluated requests, i.e. single points */
+        size_t requests;
+        /** The number of evaluated batches */
+        size_t batches;
+        /** The largest evaluated batch */
+        size_t maximalBatchSize;
+    };
+
+    /**
+     * Thread-safe front end of a {@link GravityEvaluable} for services in which many threads each ask for the
+     * gravity at a single point. Instead of evaluating every point on its own, the concurrent requests are collected
+     * into micro-batches by a dispatcher thread and evaluated as a batch of points, i.e. in parallel over the points.
+     * Every request is answered via a future.
+     * A batch is evaluated as soon as it has reached the maximal batch size or its first request has waited
+     * for the maximal wait. Hence, under load the batches grow and the per-call overhead is amortized, while a
+     * single request is delayed by at most the maximal wait.
+     */
+    class CoalescingGravityEvaluable {
+
+        /**
+         * A pending request.
+         * @note This struct is basically a named tuple
+         */
+        struct Request {
+            /** The computation point */
+            Array3 point;
+            /** The promise answering the request */
+            std::promise<GravityModelResult> promise;
+            /** The arrival of the request */
+            std::chrono::steady_clock::time_point arrival;
+        };
+
+        /** The evaluable evaluating the batches */
+        const GravityEvaluable _evaluable;
+
+        /** The maximal number of points per batch */
+        const size_t _maxBatchSize;
+
+        /** The maximal time the first request of a batch waits for further requests */
+        const std::chrono::microseconds _maxWait;
+
+        /** If true, the points of a batch are evaluated in parallel */
+        const bool _parallelization;
+
+        /** The pending requests in the order of their arrival */
+        std::vector<Request> _pending{};
+
+        /** The statistics so far */
+        CoalescingStatistics _statistics{0, 0, 0};
+
+        /** True if no more requests are accepted */
+        bool _stopped{false};
+
+        /** Guards the pending requests, the statistics, and the stop flag */
+        mutable std::mutex _mutex{};
+
+        /** Notified if a request was added or the evaluable is stopped */
+        std::condition_variable _requestAdded{};
+
+        /** The dispatcher collecting and evaluating the batches */
+        std::thread _dispatcher{};
+
+        /**
+         * The loop of the dispatcher, evaluates the batches until the evaluable is stopped and every request
+         * has been answered.
+         */
+        void dispatch();
+
+        /**
+         * Evaluates a batch and answers its requests.
+         * @param batch the requests
+         */
+        void evaluateBatch(std::vector<Request> &batch) const;
+
+    public:
+
+        /** The default maximal number of points per batch */
+        static constexpr size_t DEFAULT_MAX_BATCH_SIZE = 1024;
+
+        /** The default maximal time the first request of a batch waits for further requests */
+        static constexpr std::chrono::microseconds DEFAULT_MAX_WAIT{100};
+
+        /**
+         * Creates a new CoalescingGravityEvaluable and starts its dispatcher.
+         * @param evaluable the evaluable evaluating the batches, e.g. with a custom {@link Executor}
+         * @param maxBatchSize the maximal number of points per batch
+         * @param maxWait the maximal time the first request of a batch waits for further requests
+         * @param parallelization if true, the points of a batch are evaluated in parallel
+         * @throws std::invalid_argument if the maximal batch size is zero
+         */
+        explicit CoalescingGravityEvaluable(GravityEvaluable evaluable, size_t maxBatchSize = DEFAULT_MAX_BATCH_SIZE,
+                                            std::chrono::microseconds maxWait = DEFAULT_MAX_WAIT,
+                                            bool parallelization = true);
+
+        CoalescingGravityEvaluable(const CoalescingGravityEvaluable &) = delete;
+
+        CoalescingGravityEvaluable &operator=(const CoalescingGravityEvaluable &) = delete;
+
+        /**
+         * Stops accepting requests, answers the pending ones, and joins the dispatcher.
+         */
+        ~CoalescingGravityEvaluable();
+
+        /**
+         * Requests the evaluation of the polyhedral gravity model at a computation point.
+         * Thread-safe, the point is evaluated together with the concurrent requests of other threads.
+         * @param computationPoint the computation point P
+         * @return the future result containing the potential, acceleration, and second derivative
+         * @throws std::runtime_error if the evaluable is being destroyed
+         */
+        std::future<GravityModelResult> submit(const Array3 &computationPoint);
+
+        /**
+         * Evaluates the polyhedral gravity model at a computation point, i.e. submits it and waits for the result.
+         * @param computationPoint the computation point P
+         * @return the GravityModelResult containing the potential, acceleration, and second derivative
+         * @throws std::runtime_error if the evaluable is being destroyed
+         */
+        GravityModelResult operator()(const Array3 &computationPoint);
+
+        /**
+         * Returns the number of requests and batches evaluated so far, e.g. to monitor the mean batch size.
+         * @return the statistics
+         */
+        [[nodiscard]] CoalescingStatistics getStatistics() const;
+
+        /**
+         * Returns the evaluable evaluating the batches.
+         * @return the evaluable
+         */
+        [[nodiscard]] const GravityEvaluable &getEvaluable() const;
+
+    };
+
+}// namespace polyhedralGravity
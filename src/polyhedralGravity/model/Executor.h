@@ -0,0 +1,120 @@
+#pragma once
+
+#include <functional>
+#include <utility>
+
+#ifdef POLYHEDRAL_GRAVITY_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#endif
+
+namespace polyhedralGravity {
+
+    /**
+     * Interface for running the parallel loops of a {@link GravityEvaluable} on a scheduler owned by the caller,
+     * e.g. the thread pool or TBB arena of a host application. The evaluations then run cooperatively inside
+     * the host's scheduler instead of creating their own OpenMP team or TBB arena and oversubscribing the cores.
+     * Reductions (e.g. the sum over the faces) are built on {@link parallelFor} with a fixed partitioning,
+     * hence the results do not depend on how an executor splits the range.
+     */
+    class Executor {
+
+    public:
+
+        /**
+         * The body of a parallel loop, called with a half-open subrange [begin, end) of the iterations.
+         */
+        using RangeBody = std::function<void(size_t, size_t)>;
+
+        /** Default Virtual Destructor */
+        virtual ~Executor() = default;
+
+        /**
+         * Calls the body for disjoint subranges which cover [0, count), possibly concurrently, and returns after all
+         * calls completed. The body is safe to call concurrently. Exceptions of the body must be propagated.
+         * @param count the number of iterations
+         * @param body the body of the loop
+         */
+        virtual void parallelFor(size_t count, const RangeBody &body) const = 0;
+
+    };
+
+    /**
+     * Executor running every loop serially on the calling thread, e.g. if the caller already parallelizes
+     * over the evaluations.
+     */
+    class SerialExecutor final : public Executor {
+
+    public:
+
+        void parallelFor(size_t count, const RangeBody &body) const override {
+            if (count > 0) {
+                body(0, count);
+            }
+        }
+
+    };
+
+    /**
+     * Executor delegating every loop to a user-supplied parallel for, e.g. one submitting the subranges to a
+     * std::thread pool and waiting for them.
+     */
+    class FunctionExecutor final : public Executor {
+
+    public:
+
+        /**
+         * A parallel for with the semantics of {@link Executor::parallelFor}.
+         */
+        using ParallelFor = std::function<void(size_t, const RangeBody &)>;
+
+    private:
+
+        /** The user-supplied parallel for */
+        const ParallelFor _parallelFor;
+
+    public:
+
+        /**
+         * Creates a new FunctionExecutor.
+         * @param parallelFor the user-supplied parallel for
+         */
+        explicit FunctionExecutor(ParallelFor parallelFor) : _parallelFor{std::move(parallelFor)} {}
+
+        void parallelFor(size_t count, const RangeBody &body) const override {
+            _parallelFor(count, body);
+        }
+
+    };
+
+#ifdef POLYHEDRAL_GRAVITY_TBB
+    /**
+     * Executor running every loop as tbb::parallel_for inside a task arena of the host application.
+     * Only available if the TBB backend is compiled in.
+     */
+    class TaskArenaExecutor final : public Executor {
+
+        /** The arena of the host application, which must outlive the executor */
+        tbb::task_arena &_arena;
+
+    public:
+
+        /**
+         * Creates a new TaskArenaExecutor.
+         * @param arena the arena of the host application, which must outlive the executor
+         */
+        explicit TaskArenaExecutor(tbb::task_arena &arena) : _arena{arena} {}
+
+        void parallelFor(size_t count, const RangeBody &body) const override {
+            _arena.execute([count, &body]() {
+                tbb::parallel_for(tbb::blocked_range<size_t>{0, count}, [&body](const tbb::blocked_range<size_t> &range) {
+                    body(range.begin(), range.end());
+                });
+            });
+        }
+
+    };
+#endif
+
+}// namespace polyhedralGravity
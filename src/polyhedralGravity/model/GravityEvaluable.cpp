@@ -1,36 +1,211 @@
 #include "GravityEvaluable.h"
 
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+
+#include "polyhedralGravity/input/PointSource.h"
+
 
 namespace polyhedralGravity {
 
-    void GravityEvaluable::prepare() const {
+    namespace {
+        /** The caches of a GravityEvaluable allocated by itself (and not residing in a snapshot) */
+        struct OwnedCaches {
+            std::vector<Array3Triplet> segmentVectors;
+            std::vector<Array3> planeUnitNormals;
+            std::vector<Array3Triplet> segmentUnitNormals;
+        };
+
+        /**
+         * The caches of a GravityEvaluable in compact storage (see {@link MeshStorage})
+         * @tparam Real the floating point type of the unit normals
+         */
+        template<typename Real>
+        struct CompactCaches {
+            /** A 32-bit copy of the polyhedron's faces (which are retained), read instead of them by the evaluation */
+            std::vector<CompactIndexArray3> faces;
+            std::vector<std::array<Real, 3>> planeUnitNormals;
+            std::vector<std::array<std::array<Real, 3>, 3>> segmentUnitNormals;
+        };
+
+        /**
+         * The number of faces summed up serially by one iteration of an executor's parallel loop. The fixed blocks
+         * make the sum independent of the executor's partitioning.
+         */
+        constexpr size_t FACES_PER_BLOCK = 256;
+
+        /** The maximal deviation of a unit normal's component after narrowing it to single precision and widening it again */
+        constexpr double FLOAT32_WIDENING_TOLERANCE = 1e-6;
+
+        template<typename Real>
+        std::array<Real, 3> narrow(const Array3 &vector) {
+            return {static_cast<Real>(vector[0]), static_cast<Real>(vector[1]), static_cast<Real>(vector[2])};
+        }
+
+        Array3 widen(const Float3 &vector) {
+            return {static_cast<double>(vector[0]), static_cast<double>(vector[1]), static_cast<double>(vector[2])};
+        }
+
+        /** Returns true if the narrowed vector widens to the original one (within the tolerance), false for NaN */
+        bool isFaithfulNarrowing(const Array3 &original, const Float3 &narrowed) {
+            const Array3 widened = widen(narrowed);
+            for (size_t i = 0; i < original.size(); ++i) {
+                if (!(std::abs(widened[i] - original[i]) <= FLOAT32_WIDENING_TOLERANCE)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    template<typename Function>
+    void GravityEvaluable::parallelFor(size_t count, const Function &function) const {
+        if (_executor != nullptr) {
+            _executor->parallelFor(count, [&function](size_t begin, size_t end) {
+                for (size_t index = begin; index < end; ++index) {
+                    function(index);
+                }
+            });
+            return;
+        }
+        auto countingIterator = thrust::make_counting_iterator<size_t>(0);
+        Parallelization::execute([&](const auto &policy) {
+            thrust::for_each(policy, countingIterator, countingIterator + count, function);
+        });
+    }
+
+    GravityEvaluable::GravityEvaluable(Polyhedron polyhedron,
+                                       std::vector<Array3Triplet> segmentVectors,
+                                       std::vector<Array3> planeUnitNormals,
+                                       std::vector<Array3Triplet> segmentUnitNormals) :
+        _polyhedron{std::move(polyhedron)} {
+        const auto caches = std::make_shared<OwnedCaches>(OwnedCaches{
+                std::move(segmentVectors), std::move(planeUnitNormals), std::move(segmentUnitNormals)});
+        _segmentVectors = caches->segmentVectors.data();
+        _planeUnitNormals = caches->planeUnitNormals.data();
+        _segmentUnitNormals = caches->segmentUnitNormals.data();
+        _cacheStorage = caches;
+    }
+
+    void GravityEvaluable::prepare() {
         using namespace GravityModel::detail;
+        if (_storage == MeshStorage::COMPACT) {
+            this->prepareCompact<double>();
+            return;
+        }
+        if (_storage == MeshStorage::COMPACT_FLOAT32) {
+            this->prepareCompact<float>();
+            return;
+        }
         // Initialize the vectors and allocate the required memory
         const size_t n = _polyhedron.countFaces();
         const auto &vertices = _polyhedron.getVertices();
         const auto &faces = _polyhedron.getFaces();
-        _segmentVectors.resize(n);
-        _planeUnitNormals.resize(n);
-        _segmentUnitNormals.resize(n);
-
-        // Create the iterators for the for_each loop over the polyhedral faces
-        thrust::counting_iterator<size_t> begin{0};
-        thrust::counting_iterator<size_t> end{n};
+        const auto caches = std::make_shared<OwnedCaches>();
+        auto &[segmentVectors, planeUnitNormals, segmentUnitNormals] = *caches;
+        segmentVectors.resize(n);
+        planeUnitNormals.resize(n);
+        segmentUnitNormals.resize(n);
 
         // Compute the segment vectors, the plane unit normals and the segment unit normals
-        thrust::for_each(thrust::device, begin, end, [this, &faces, &vertices](size_t index) {
+        const auto prepareFace = [&owned = *caches, &faces, &vertices](size_t index) {
             Array3Triplet face{vertices[faces[index][0]], vertices[faces[index][1]], vertices[faces[index][2]]};
             //1-01 Step: Compute Segment Vectors G_pq which describe each one the edge between two vertices
-            _segmentVectors[index] = buildVectorsOfSegments(face[0], face[1], face[2]);
+            owned.segmentVectors[index] = buildVectorsOfSegments(face[0], face[1], face[2]);
             //1-02 Step: Compute the Plane Unit Normals N_p (pointing outside the polyhedron)
-            _planeUnitNormals[index] = buildUnitNormalOfPlane(_segmentVectors[index][0], _segmentVectors[index][1]);
+            owned.planeUnitNormals[index] = buildUnitNormalOfPlane(owned.segmentVectors[index][0], owned.segmentVectors[index][1]);
             //1-03 Step: Compute Segment Unit Normals n_pq (normal pointing away from each segment)
-            _segmentUnitNormals[index] = buildUnitNormalOfSegments(_segmentVectors[index], _planeUnitNormals[index]);
-        });
+            owned.segmentUnitNormals[index] = buildUnitNormalOfSegments(owned.segmentVectors[index], owned.planeUnitNormals[index]);
+        };
+        this->parallelFor(n, prepareFace);
+        _segmentVectors = segmentVectors.data();
+        _planeUnitNormals = planeUnitNormals.data();
+        _segmentUnitNormals = segmentUnitNormals.data();
+        _cacheStorage = caches;
+    }
+
+    template<typename Real>
+    void GravityEvaluable::prepareCompact() {
+        using namespace GravityModel::detail;
+        const size_t n = _polyhedron.countFaces();
+        const auto &vertices = _polyhedron.getVertices();
+        const auto &faces = _polyhedron.getFaces();
+        if (vertices.size() > std::numeric_limits<uint32_t>::max()) {
+            throw std::invalid_argument("The polyhedron has " + std::to_string(vertices.size()) +
+                                        " vertices, which exceeds the 32-bit indices of the compact storage.");
+        }
+        const auto caches = std::make_shared<CompactCaches<Real>>();
+        caches->faces.resize(n);
+        caches->planeUnitNormals.resize(n);
+        caches->segmentUnitNormals.resize(n);
+
+        // The caches are computed like in prepare(), but the segment vectors are dropped afterward
+        std::atomic<size_t> invalidFace{n};
+        const auto prepareFace = [&compact = *caches, &faces, &vertices, &invalidFace](size_t index) {
+            const IndexArray3 &face = faces[index];
+            compact.faces[index] = {static_cast<uint32_t>(face[0]), static_cast<uint32_t>(face[1]), static_cast<uint32_t>(face[2])};
+            const Array3Triplet segmentVectors = buildVectorsOfSegments(vertices[face[0]], vertices[face[1]], vertices[face[2]]);
+            const Array3 planeUnitNormal = buildUnitNormalOfPlane(segmentVectors[0], segmentVectors[1]);
+            const Array3Triplet segmentUnitNormals = buildUnitNormalOfSegments(segmentVectors, planeUnitNormal);
+            compact.planeUnitNormals[index] = narrow<Real>(planeUnitNormal);
+            for (size_t j = 0; j < segmentUnitNormals.size(); ++j) {
+                compact.segmentUnitNormals[index][j] = narrow<Real>(segmentUnitNormals[j]);
+            }
+            if constexpr (std::is_same_v<Real, float>) {
+                bool faithful = isFaithfulNarrowing(planeUnitNormal, compact.planeUnitNormals[index]);
+                for (size_t j = 0; j < segmentUnitNormals.size(); ++j) {
+                    faithful = faithful && isFaithfulNarrowing(segmentUnitNormals[j], compact.segmentUnitNormals[index][j]);
+                }
+                if (!faithful) {
+                    invalidFace.store(index, std::memory_order_relaxed);
+                }
+            }
+        };
+        this->parallelFor(n, prepareFace);
+        if (const size_t index = invalidFace.load(); index != n) {
+            throw std::invalid_argument("The unit normals of the face " + std::to_string(index) + " cannot be stored in "
+                                        "single precision (is the face degenerated?). Use MeshStorage::DOUBLE instead.");
+        }
+        _compactFaces = caches->faces.data();
+        if constexpr (std::is_same_v<Real, float>) {
+            _planeUnitNormalsFloat32 = caches->planeUnitNormals.data();
+            _segmentUnitNormalsFloat32 = caches->segmentUnitNormals.data();
+        } else {
+            _planeUnitNormals = caches->planeUnitNormals.data();
+            _segmentUnitNormals = caches->segmentUnitNormals.data();
+        }
+        _cacheStorage = caches;
+        POLYHEDRAL_GRAVITY_LOG_DEBUG("Prepared the compact caches of {} faces", n);
+    }
+
+    thrust::tuple<Array3Triplet, Array3Triplet, Array3, Array3Triplet>
+    GravityEvaluable::compactFace(size_t index, const Array3 &computationPoint) const {
+        using namespace util;
+        using namespace GravityModel::detail;
+        const auto &vertices = _polyhedron.getVertices();
+        const CompactIndexArray3 &indices = _compactFaces[index];
+        const Array3 &vertex0 = vertices[indices[0]];
+        const Array3 &vertex1 = vertices[indices[1]];
+        const Array3 &vertex2 = vertices[indices[2]];
+        const Array3Triplet face{vertex0 - computationPoint, vertex1 - computationPoint, vertex2 - computationPoint};
+        // Computed from the original vertices like in prepare(), hence identical to the cached segment vectors
+        const Array3Triplet segmentVectors = buildVectorsOfSegments(vertex0, vertex1, vertex2);
+        if (_planeUnitNormalsFloat32 != nullptr) {
+            const Float3Triplet &segmentUnitNormals = _segmentUnitNormalsFloat32[index];
+            return thrust::make_tuple(face, segmentVectors, widen(_planeUnitNormalsFloat32[index]),
+                                      Array3Triplet{widen(segmentUnitNormals[0]), widen(segmentUnitNormals[1]),
+                                                    widen(segmentUnitNormals[2])});
+        }
+        return thrust::make_tuple(face, segmentVectors, _planeUnitNormals[index], _segmentUnitNormals[index]);
     }
 
     template<bool Parallelization>
     GravityModelResult GravityEvaluable::evaluate(const Array3 &computationPoint) const {
+        // The template parameter hides the class, hence it is qualified
+        using Backend = polyhedralGravity::Parallelization;
         using namespace GravityModel::detail;
         using namespace util;
         POLYHEDRAL_GRAVITY_LOG_DEBUG("Evaluation for computation point P = [{}, {}, {}] started, given density = {} kg/m^3",
@@ -38,20 +213,81 @@ namespace polyhedralGravity {
         /*
          * Calculate V and Vx, Vy, Vz and Vxx, Vyy, Vzz, Vxy, Vxz, Vyz
          */
-        const auto &[polyBegin, polyEnd] = _polyhedron.transformIterator(computationPoint);
-        const auto zip1 = zip(polyBegin, _segmentVectors.begin(), _planeUnitNormals.begin(), _segmentUnitNormals.begin());
-        const auto zip2 = zip(polyEnd, _segmentVectors.end(), _planeUnitNormals.end(), _segmentUnitNormals.end());
+        const size_t n = _polyhedron.countFaces();
 
         POLYHEDRAL_GRAVITY_LOG_DEBUG("Starting to iterate over the planes...");
         GravityModelResult result{};
         auto &[potential, acceleration, gradiometricTensor] = result;
 
-        if constexpr (Parallelization) {
-            result = thrust::transform_reduce(thrust::device, zip1, zip2, &GravityEvaluable::evaluateFace, result,
-                                              util::operator+ <double, Array3, Array6>);
+        const auto evaluateFaceAt = [this, &computationPoint](size_t index) {
+            if (_storage != MeshStorage::DOUBLE) {
+                return evaluateFace(this->compactFace(index, computationPoint));
+            }
+            const IndexArray3 &face = _polyhedron.getFaces()[index];
+            const Array3Triplet relativeFace{_polyhedron.getVertex(face[0]) - computationPoint,
+                                             _polyhedron.getVertex(face[1]) - computationPoint,
+                                             _polyhedron.getVertex(face[2]) - computationPoint};
+            return evaluateFace(thrust::make_tuple(relativeFace, _segmentVectors[index], _planeUnitNormals[index],
+                                                   _segmentUnitNormals[index]));
+        };
+
+        if (Parallelization && _workerTeam != nullptr) {
+            // Every thread of the team sums up a fixed range of faces, the partial sums are added in order
+            const size_t threads = _workerTeam->countThreads();
+            // Reused by the calls of the same thread, the workers access it via the reference (and not their own instance)
+            thread_local std::vector<PartialSum> partialSums{};
+            partialSums.resize(threads);
+            std::vector<PartialSum> &sums = partialSums;
+            _workerTeam->run([&sums, &evaluateFaceAt, n, threads](size_t thread) {
+                GravityModelResult threadSum{};
+                for (size_t index = n * thread / threads; index < n * (thread + 1) / threads; ++index) {
+                    threadSum = threadSum + evaluateFaceAt(index);
+                }
+                sums[thread].sum = threadSum;
+            });
+            for (size_t thread = 0; thread < threads; ++thread) {
+                result = result + sums[thread].sum;
+            }
+        } else if (Parallelization && _executor != nullptr) {
+            // The faces are summed up block by block, so that the result does not depend on the executor
+            std::vector<GravityModelResult> blockSums((n + FACES_PER_BLOCK - 1) / FACES_PER_BLOCK);
+            this->parallelFor(blockSums.size(), [&blockSums, &evaluateFaceAt, n](size_t block) {
+                GravityModelResult blockSum{};
+                for (size_t index = block * FACES_PER_BLOCK; index < std::min(n, (block + 1) * FACES_PER_BLOCK); ++index) {
+                    blockSum = blockSum + evaluateFaceAt(index);
+                }
+                blockSums[block] = blockSum;
+            });
+            result = std::accumulate(blockSums.cbegin(), blockSums.cend(), result, util::operator+ <double, Array3, Array6>);
+        } else if (_storage != MeshStorage::DOUBLE) {
+            // The input of every face is assembled from the compact caches on the fly
+            const auto evaluateCompactFace = [this, &computationPoint](size_t index) {
+                return evaluateFace(this->compactFace(index, computationPoint));
+            };
+            thrust::counting_iterator<size_t> begin{0};
+            thrust::counting_iterator<size_t> end{n};
+            if constexpr (Parallelization) {
+                result = Backend::execute([&](const auto &policy) {
+                    return thrust::transform_reduce(policy, begin, end, evaluateCompactFace, result,
+                                                    util::operator+ <double, Array3, Array6>);
+                });
+            } else {
+                result = thrust::transform_reduce(thrust::host, begin, end, evaluateCompactFace, result,
+                                                  util::operator+ <double, Array3, Array6>);
+            }
         } else {
-            result = thrust::transform_reduce(thrust::host, zip1, zip2, &GravityEvaluable::evaluateFace, result,
-                                              util::operator+ <double, Array3, Array6>);
+            const auto &[polyBegin, polyEnd] = _polyhedron.transformIterator(computationPoint);
+            const auto zip1 = zip(polyBegin, _segmentVectors, _planeUnitNormals, _segmentUnitNormals);
+            const auto zip2 = zip(polyEnd, _segmentVectors + n, _planeUnitNormals + n, _segmentUnitNormals + n);
+            if constexpr (Parallelization) {
+                result = Backend::execute([&](const auto &policy) {
+                    return thrust::transform_reduce(policy, zip1, zip2, &GravityEvaluable::evaluateFace, result,
+                                                    util::operator+ <double, Array3, Array6>);
+                });
+            } else {
+                result = thrust::transform_reduce(thrust::host, zip1, zip2, &GravityEvaluable::evaluateFace, result,
+                                                  util::operator+ <double, Array3, Array6>);
+            }
         }
 
         POLYHEDRAL_GRAVITY_LOG_DEBUG("Finished the sums. Applying final prefix.");
@@ -72,30 +308,157 @@ namespace polyhedralGravity {
 
     template GravityModelResult GravityEvaluable::evaluate<false>(const Array3 &computationPoints) const;
 
+    template<typename Function>
+    void GravityEvaluable::forEachPoint(const Array3 *computationPoints, size_t count, bool parallelization,
+                                        bool sortPoints, const Function &function) const {
+        auto countingIterator = thrust::make_counting_iterator<size_t>(0);
+        if (!sortPoints) {
+            if (parallelization) {
+                this->parallelFor(count, function);
+            } else {
+                thrust::for_each(thrust::host, countingIterator, countingIterator + count, function);
+            }
+            return;
+        }
+        // The Morton curve is cheaper to compute than the Hilbert curve and already clusters the points
+        const util::SpaceFillingCurveGrid grid{computationPoints, computationPoints + count};
+        std::vector<uint64_t> keys(count);
+        std::transform(computationPoints, computationPoints + count, keys.begin(), [&grid](const Array3 &point) {
+            return util::mortonKey(grid.cell(point));
+        });
+        std::vector<size_t> order(count);
+        std::iota(order.begin(), order.end(), 0);
+        if (parallelization && _executor == nullptr) {
+            Parallelization::execute([&](const auto &policy) {
+                thrust::stable_sort_by_key(policy, keys.begin(), keys.end(), order.begin());
+            });
+        } else {
+            thrust::stable_sort_by_key(thrust::host, keys.begin(), keys.end(), order.begin());
+        }
+        // The results are scattered back to the original index of every point
+        const auto visit = [&order, &function](size_t i) {
+            function(order[i]);
+        };
+        if (parallelization) {
+            this->parallelFor(count, visit);
+        } else {
+            thrust::for_each(thrust::host, countingIterator, countingIterator + count, visit);
+        }
+    }
+
     template<bool Parallelization>
-    std::vector<GravityModelResult> GravityEvaluable::evaluate(const std::vector<Array3> &computationPoints) const {
+    std::vector<GravityModelResult> GravityEvaluable::evaluate(const std::vector<Array3> &computationPoints,
+                                                               bool sortPoints) const {
+        // The template parameter hides the class, hence it is qualified
+        using Backend = polyhedralGravity::Parallelization;
         std::vector<GravityModelResult> result{computationPoints.size()};
-        if constexpr (Parallelization) {
-            thrust::transform(thrust::device, computationPoints.begin(), computationPoints.end(), result.begin(),
-                              [this](const Array3 &computationPoint) {
-                                  return this->evaluate<false>(computationPoint);
-                              });
-        } else {
-            thrust::transform(thrust::host, computationPoints.begin(), computationPoints.end(), result.begin(),
-                              [this](const Array3 &computationPoint) {
-                                  return this->evaluate<false>(computationPoint);
-                              });
+        if (!sortPoints && _executor == nullptr) {
+            if constexpr (Parallelization) {
+                Backend::execute([&](const auto &policy) {
+                    thrust::transform(policy, computationPoints.begin(), computationPoints.end(), result.begin(),
+                                      [this](const Array3 &computationPoint) {
+                                          return this->evaluate<false>(computationPoint);
+                                      });
+                });
+            } else {
+                thrust::transform(thrust::host, computationPoints.begin(), computationPoints.end(), result.begin(),
+                                  [this](const Array3 &computationPoint) {
+                                      return this->evaluate<false>(computationPoint);
+                                  });
+            }
+            return result;
         }
+        forEachPoint(computationPoints.data(), computationPoints.size(), Parallelization, sortPoints,
+                     [this, &computationPoints, &result](size_t i) {
+                         result[i] = this->evaluate<false>(computationPoints[i]);
+                     });
         return result;
     }
 
     // Explicit template instantiation of the multipoint evaluate method
 
     template std::vector<GravityModelResult>
-    GravityEvaluable::evaluate<true>(const std::vector<Array3> &computationPoints) const;
+    GravityEvaluable::evaluate<true>(const std::vector<Array3> &computationPoints, bool sortPoints) const;
 
     template std::vector<GravityModelResult>
-    GravityEvaluable::evaluate<false>(const std::vector<Array3> &computationPoints) const;
+    GravityEvaluable::evaluate<false>(const std::vector<Array3> &computationPoints, bool sortPoints) const;
+
+    void GravityEvaluable::evaluate(const Array3 *computationPoints, size_t count, const GravityModelResultSpans &results,
+                                    bool parallelization, bool sortPoints) const {
+        const auto evaluatePoint = [this, computationPoints, &results](const size_t i) {
+            const auto &[potential, acceleration, tensor] = this->evaluate<false>(computationPoints[i]);
+            if (results.potential != nullptr) {
+                results.potential[i] = potential;
+            }
+            for (size_t j = 0; j < acceleration.size(); ++j) {
+                if (results.acceleration[j] != nullptr) {
+                    results.acceleration[j][i] = acceleration[j];
+                }
+            }
+            for (size_t j = 0; j < tensor.size(); ++j) {
+                if (results.tensor[j] != nullptr) {
+                    results.tensor[j][i] = tensor[j];
+                }
+            }
+        };
+        forEachPoint(computationPoints, count, parallelization, sortPoints, evaluatePoint);
+    }
+
+    void GravityEvaluable::evaluate(const Array3 *computationPoints, size_t count, double *potential,
+                                    Array3 *acceleration, Array6 *tensor, bool parallelization, bool sortPoints) const {
+        const auto evaluatePoint = [this, computationPoints, potential, acceleration, tensor](const size_t i) {
+            const auto &[pointPotential, pointAcceleration, pointTensor] = this->evaluate<false>(computationPoints[i]);
+            if (potential != nullptr) {
+                potential[i] = pointPotential;
+            }
+            if (acceleration != nullptr) {
+                acceleration[i] = pointAcceleration;
+            }
+            if (tensor != nullptr) {
+                tensor[i] = pointTensor;
+            }
+        };
+        forEachPoint(computationPoints, count, parallelization, sortPoints, evaluatePoint);
+    }
+
+    size_t GravityEvaluable::stream(PointSource &pointSource, const ChunkSink &sink, size_t chunkSize,
+                                    bool parallelization) const {
+        return this->streamChunks([&pointSource](std::vector<Array3> &points, size_t maxCount) {
+            return pointSource.read(points, maxCount);
+        }, sink, chunkSize, parallelization);
+    }
+
+    size_t GravityEvaluable::streamChunks(const std::function<size_t(std::vector<Array3> &, size_t)> &fill,
+                                          const ChunkSink &sink, size_t chunkSize, bool parallelization) const {
+        if (chunkSize == 0) {
+            throw std::invalid_argument("The chunk size of a streamed evaluation must be positive.");
+        }
+        std::vector<Array3> points{};
+        std::vector<GravityModelResult> results{};
+        points.reserve(chunkSize);
+        results.reserve(chunkSize);
+        size_t evaluated{0};
+        while (fill(points, chunkSize) > 0) {
+            results.resize(points.size());
+            const auto evaluatePoint = [this](const Array3 &computationPoint) {
+                return this->evaluate<false>(computationPoint);
+            };
+            if (parallelization) {
+                this->parallelFor(points.size(), [&points, &results, &evaluatePoint](size_t i) {
+                    results[i] = evaluatePoint(points[i]);
+                });
+            } else {
+                thrust::transform(thrust::host, points.cbegin(), points.cend(), results.begin(), evaluatePoint);
+            }
+            const size_t firstIndex = evaluated;
+            evaluated += points.size();
+            if (!sink(firstIndex, points, results)) {
+                POLYHEDRAL_GRAVITY_LOG_DEBUG("The streamed evaluation was stopped by the sink after {} points", evaluated);
+                break;
+            }
+        }
+        return evaluated;
+    }
 
     GravityModelResult
     GravityEvaluable::evaluateFace(const thrust::tuple<Array3Triplet, Array3Triplet, Array3, Array3Triplet> &tuple) {
@@ -248,7 +611,55 @@ namespace polyhedralGravity {
 
     std::tuple<Polyhedron, std::vector<Array3Triplet>, std::vector<Array3>, std::vector<Array3Triplet>>
     GravityEvaluable::getState() const {
-        return std::make_tuple(_polyhedron, _segmentVectors, _planeUnitNormals, _segmentUnitNormals);
+        const size_t n = _polyhedron.countFaces();
+        if (_storage != MeshStorage::DOUBLE) {
+            std::vector<Array3Triplet> segmentVectors(n);
+            std::vector<Array3> planeUnitNormals(n);
+            std::vector<Array3Triplet> segmentUnitNormals(n);
+            for (size_t index = 0; index < n; ++index) {
+                const auto face = this->compactFace(index, {0.0, 0.0, 0.0});
+                segmentVectors[index] = thrust::get<1>(face);
+                planeUnitNormals[index] = thrust::get<2>(face);
+                segmentUnitNormals[index] = thrust::get<3>(face);
+            }
+            return std::make_tuple(_polyhedron, std::move(segmentVectors), std::move(planeUnitNormals),
+                                   std::move(segmentUnitNormals));
+        }
+        return std::make_tuple(_polyhedron, std::vector<Array3Triplet>(_segmentVectors, _segmentVectors + n),
+                               std::vector<Array3>(_planeUnitNormals, _planeUnitNormals + n),
+                               std::vector<Array3Triplet>(_segmentUnitNormals, _segmentUnitNormals + n));
+    }
+
+    const Polyhedron &GravityEvaluable::getPolyhedron() const {
+        return _polyhedron;
+    }
+
+    std::tuple<const Array3Triplet *, const Array3 *, const Array3Triplet *> GravityEvaluable::getCaches() const {
+        return std::make_tuple(_segmentVectors, _planeUnitNormals, _segmentUnitNormals);
+    }
+
+    GravityEvaluable GravityEvaluable::withExecutor(std::shared_ptr<const Executor> executor) const {
+        GravityEvaluable evaluable{*this};
+        evaluable._executor = std::move(executor);
+        return evaluable;
+    }
+
+    const std::shared_ptr<const Executor> &GravityEvaluable::getExecutor() const {
+        return _executor;
+    }
+
+    GravityEvaluable GravityEvaluable::withWorkerTeam(std::shared_ptr<WorkerTeam> workerTeam) const {
+        GravityEvaluable evaluable{*this};
+        evaluable._workerTeam = std::move(workerTeam);
+        return evaluable;
+    }
+
+    const std::shared_ptr<WorkerTeam> &GravityEvaluable::getWorkerTeam() const {
+        return _workerTeam;
+    }
+
+    MeshStorage GravityEvaluable::getStorage() const {
+        return _storage;
     }
 
 }// namespace polyhedralGravity
@@ -5,8 +5,13 @@
 #include <string>
 #include <optional>
 #include <sstream>
+#include <memory>
+#include <functional>
+#include <stdexcept>
 
 #include "thrust/transform.h"
+#include "thrust/for_each.h"
+#include "thrust/iterator/counting_iterator.h"
 #include "thrust/execution_policy.h"
 
 #include "GravityModelDetail.h"
@@ -14,40 +19,106 @@
 #include "polyhedralGravity/input/TetgenAdapter.h"
 #include "GravityModelData.h"
 #include "Polyhedron.h"
+#include "Parallelization.h"
+#include "Executor.h"
+#include "WorkerTeam.h"
 
 
 namespace polyhedralGravity {
 
+    class PointSource;
+
     /**
      * Class for evaluating the polyhedrale gravity model for a given constant density polyhedron.
      * Caches the polyhedron and data which is independent of the computation point P.
      * Provides an operator() for evaluating the polyhedrale gravity model for a given constant density polyhedron
      * at computation point P and choosing between parallel and serial evaluation.
+     * A GravityEvaluable is immutable after its construction, hence it may be evaluated from multiple threads concurrently.
      */
     class GravityEvaluable {
 
         /** The constant density polyhedron consisting of vertices and triangular faces */
         const Polyhedron _polyhedron;
 
+        /**
+         * Owner of the memory the caches point to.
+         * This is either the storage allocated by {@link prepare} or a memory-mapped {@link Snapshot}.
+         * The caches are immutable after their computation, hence copies of a GravityEvaluable share them.
+         */
+        std::shared_ptr<const void> _cacheStorage{};
+
         /** Cache for the segment vectors (segments between vertices of a polyhedral face) */
-        mutable std::vector<Array3Triplet> _segmentVectors{};
+        const Array3Triplet *_segmentVectors{nullptr};
 
         /** Cache for the plane unit normals (unit normals of the polyhedral faces) */
-        mutable std::vector<Array3> _planeUnitNormals{};
+        const Array3 *_planeUnitNormals{nullptr};
 
         /** Cache for the segment unit normals (unit normals of each the polyhedral faces' segments) */
-        mutable std::vector<Array3Triplet> _segmentUnitNormals{};
+        const Array3Triplet *_segmentUnitNormals{nullptr};
+
+        /**
+         * The storage of the caches. In compact storage, the segment vectors are not cached and
+         * the faces are additionally cached with 32-bit indices.
+         */
+        MeshStorage _storage{MeshStorage::DOUBLE};
+
+        /** Cache for the faces with 32-bit vertex indices (only in compact storage) */
+        const CompactIndexArray3 *_compactFaces{nullptr};
+
+        /** Cache for the single precision plane unit normals (only in {@link MeshStorage::COMPACT_FLOAT32} storage) */
+        const Float3 *_planeUnitNormalsFloat32{nullptr};
+
+        /** Cache for the single precision segment unit normals (only in {@link MeshStorage::COMPACT_FLOAT32} storage) */
+        const Float3Triplet *_segmentUnitNormalsFloat32{nullptr};
+
+        /**
+         * The executor running the parallel loops, nullptr runs them with the thrust backend selected by
+         * {@link Parallelization}.
+         */
+        std::shared_ptr<const Executor> _executor{};
+
+        /**
+         * The worker team evaluating single points with the lowest latency, nullptr uses the executor or the
+         * thrust backend (see {@link withWorkerTeam}).
+         */
+        std::shared_ptr<WorkerTeam> _workerTeam{};
+
+        /**
+         * The partial sum of a thread of the {@link WorkerTeam}, aligned to a cache line so that the threads
+         * do not write to the same line.
+         * @note This struct is basically a named tuple
+         */
+        struct alignas(64) PartialSum {
+            /** The sum over the faces of the thread */
+            GravityModelResult sum;
+        };
 
     public:
+        /**
+         * Callback receiving the results of a completed chunk of computation points during a {@link stream}.
+         * The arguments are the index of the chunk's first point in the input, the chunk's points, and their results.
+         * The vectors are reused for the next chunk, i.e. they are only valid during the call.
+         * Returning false stops the evaluation early.
+         */
+        using ChunkSink = std::function<bool(size_t, const std::vector<Array3> &, const std::vector<GravityModelResult> &)>;
+
         /**
          * Instantiates a GravityEvaluable with a given constant density polyhedron.
          * In contrast to the {@link GravityModel::evaluate}, this evaluate method on the {@link GravityEvaluable}
          * caches intermediate results and input data and subsequent evaluations will be faster.
          *
-         * @param polyhedron the constant density polyhedron
+         * @param polyhedron the constant density polyhedron, its vertices and faces are shared and not copied
+         * @param storage the storage of the caches (see {@link MeshStorage}, default: DOUBLE)
+         * @param executor the executor of the parallel loops, including the preparation of the caches
+         *          (see {@link withExecutor}, default: nullptr, i.e. the thrust backend)
+         * @throws std::invalid_argument if the polyhedron has too many vertices for 32-bit indices (compact storage),
+         *          or if a unit normal cannot be represented in single precision (COMPACT_FLOAT32 storage)
          */
-        explicit GravityEvaluable(const Polyhedron &polyhedron) :
-            _polyhedron{polyhedron} {
+        explicit GravityEvaluable(Polyhedron polyhedron, MeshStorage storage = MeshStorage::DOUBLE,
+                                  std::shared_ptr<const Executor> executor = nullptr) :
+            _polyhedron{std::move(polyhedron)},
+            _storage{storage},
+            _executor{std::move(executor)} {
             this->prepare();
         }
 
@@ -59,15 +130,30 @@ namespace polyhedralGravity {
          * @param planeUnitNormals the plane unit normals
          * @param segmentUnitNormals the segment unit normals
          */
-        GravityEvaluable(const Polyhedron &polyhedron,
-                         const std::vector<Array3Triplet> &segmentVectors,
-                         const std::vector<Array3> &planeUnitNormals,
-                         const std::vector<Array3Triplet> &segmentUnitNormals) :
-            _polyhedron{polyhedron},
+        GravityEvaluable(Polyhedron polyhedron,
+                         std::vector<Array3Triplet> segmentVectors,
+                         std::vector<Array3> planeUnitNormals,
+                         std::vector<Array3Triplet> segmentUnitNormals);
+
+        /**
+         * Instantiates a GravityEvaluable with a given constant density polyhedron and caches residing in
+         * memory owned by someone else, e.g. a memory-mapped {@link Snapshot}. The caches are not copied.
+         * @param polyhedron the polyhedron
+         * @param cacheStorage the owner of the memory, kept alive as long as the GravityEvaluable (or a copy) exists
+         * @param segmentVectors pointer to the segment vectors of every face
+         * @param planeUnitNormals pointer to the plane unit normals of every face
+         * @param segmentUnitNormals pointer to the segment unit normals of every face
+         */
+        GravityEvaluable(Polyhedron polyhedron,
+                         std::shared_ptr<const void> cacheStorage,
+                         const Array3Triplet *segmentVectors,
+                         const Array3 *planeUnitNormals,
+                         const Array3Triplet *segmentUnitNormals) :
+            _polyhedron{std::move(polyhedron)},
+            _cacheStorage{std::move(cacheStorage)},
             _segmentVectors{segmentVectors},
             _planeUnitNormals{planeUnitNormals},
-            _segmentUnitNormals{
-                    segmentUnitNormals} {
+            _segmentUnitNormals{segmentUnitNormals} {
         }
 
         /**
@@ -80,26 +166,93 @@ namespace polyhedralGravity {
          *
          * @param computationPoints the computation point P or multiple computation points in a vector
          * @param parallelization if true, the calculation is parallelized
+         * @param sortPoints if true, multiple computation points are evaluated along a Morton curve, i.e. spatially
+         *          close points are evaluated after each other, the results are still in the order of the points
          * @return the GravityModelResult containing the potential, acceleration, and second derivative
          */
         inline std::variant<GravityModelResult, std::vector<GravityModelResult>>
         operator()(const std::variant<Array3, std::vector<Array3>> &computationPoints,
-                   bool parallelization = true) const {
+                   bool parallelization = true, bool sortPoints = false) const {
             if (parallelization) {
                 if (std::holds_alternative<Array3>(computationPoints)) {
                     return this->evaluate<true>(std::get<Array3>(computationPoints));
                 } else {
-                    return this->evaluate<true>(std::get<std::vector<Array3>>(computationPoints));
+                    return this->evaluate<true>(std::get<std::vector<Array3>>(computationPoints), sortPoints);
                 }
             } else {
                 if (std::holds_alternative<Array3>(computationPoints)) {
                     return this->evaluate<false>(std::get<Array3>(computationPoints));
                 } else {
-                    return this->evaluate<false>(std::get<std::vector<Array3>>(computationPoints));
+                    return this->evaluate<false>(std::get<std::vector<Array3>>(computationPoints), sortPoints);
                 }
             }
         }
 
+        /**
+         * Evaluates the polyhedral gravity model at multiple computation points and writes the results into
+         * caller-provided arrays in structure-of-arrays layout instead of allocating a vector of results.
+         * Combined with memory-mapped arrays (see {@link MappedResultFile}), the results of arbitrarily many points
+         * stream to disk through the page cache without any intermediate copy.
+         * @param computationPoints pointer to the first computation point
+         * @param count the number of computation points
+         * @param results the output arrays, each one with (at least) count elements, nullptr components are skipped
+         * @param parallelization if true, the points are evaluated in parallel
+         * @param sortPoints if true, the points are evaluated along a Morton curve (see {@link operator()})
+         */
+        void evaluate(const Array3 *computationPoints, size_t count, const GravityModelResultSpans &results,
+                      bool parallelization = true, bool sortPoints = false) const;
+
+        /**
+         * Evaluates the polyhedral gravity model at multiple computation points and writes the results into
+         * caller-provided arrays in array-of-structures layout, i.e. one row per computation point. These are exactly
+         * the memory layouts of C-contiguous arrays of shape (N,), (N, 3) and (N, 6), e.g. NumPy arrays.
+         * @param computationPoints pointer to the first computation point
+         * @param count the number of computation points
+         * @param potential the output potentials with (at least) count elements, nullptr skips them
+         * @param acceleration the output accelerations with (at least) count elements, nullptr skips them
+         * @param tensor the output second derivative tensors with (at least) count elements, nullptr skips them
+         * @param parallelization if true, the points are evaluated in parallel
+         * @param sortPoints if true, the points are evaluated along a Morton curve (see {@link operator()})
+         */
+        void evaluate(const Array3 *computationPoints, size_t count, double *potential, Array3 *acceleration,
+                      Array6 *tensor, bool parallelization = true, bool sortPoints = false) const;
+
+        /**
+         * Evaluates the polyhedral gravity model for a stream of computation points chunk by chunk.
+         * Every completed chunk is passed to the sink in the order of the points, before the next chunk is read.
+         * Hence, at most one chunk of points and results resides in memory and the consumer can start immediately.
+         * @param pointSource the source of the computation points (e.g. a file or a generator)
+         * @param sink the callback receiving every completed chunk, returning false stops the evaluation
+         * @param chunkSize the maximal number of points per chunk
+         * @param parallelization if true, the points of a chunk are evaluated in parallel
+         * @return the number of evaluated points (including the chunk whose sink stopped the evaluation)
+         * @throws std::invalid_argument if the chunk size is zero
+         */
+        size_t stream(PointSource &pointSource, const ChunkSink &sink, size_t chunkSize, bool parallelization = true) const;
+
+        /**
+         * Evaluates the polyhedral gravity model for a range of computation points chunk by chunk.
+         * The range is only traversed once, so single-pass input iterators (e.g. of a generator) are supported.
+         * @tparam InputIt an input iterator whose elements are convertible to Array3
+         * @param first the beginning of the range
+         * @param last the end of the range
+         * @param sink the callback receiving every completed chunk, returning false stops the evaluation
+         * @param chunkSize the maximal number of points per chunk
+         * @param parallelization if true, the points of a chunk are evaluated in parallel
+         * @return the number of evaluated points (including the chunk whose sink stopped the evaluation)
+         * @throws std::invalid_argument if the chunk size is zero
+         */
+        template<typename InputIt>
+        size_t stream(InputIt first, InputIt last, const ChunkSink &sink, size_t chunkSize, bool parallelization = true) const {
+            return this->streamChunks([&first, &last](std::vector<Array3> &points, size_t maxCount) {
+                points.clear();
+                for (; first != last && points.size() < maxCount; ++first) {
+                    points.push_back(*first);
+                }
+                return points.size();
+            }, sink, chunkSize, parallelization);
+        }
+
         /**
          * Returns a string representation of the GravityEvaluable.
          * @return string representation of the GravityEvaluable
@@ -116,11 +269,65 @@ namespace polyhedralGravity {
 
         /**
          * Returns the polyhedron, the density, and the internal caches.
+         * In compact storage, the caches are expanded to double precision.
          *
          * @return tuple of polyhedron, density, segmentVectors, planeUnitNormals, and segmentUnitNormals
          */
         std::tuple<Polyhedron, std::vector<Array3Triplet>, std::vector<Array3>, std::vector<Array3Triplet>> getState() const;
 
+        /**
+         * Returns the polyhedron of this GravityEvaluable.
+         * @return the constant density polyhedron
+         */
+        [[nodiscard]] const Polyhedron &getPolyhedron() const;
+
+        /**
+         * Returns read-only pointers to the internal caches, each one containing one element per face.
+         * In contrast to {@link getState}, the caches are not copied.
+         * In compact storage, the segment vectors are not cached (nullptr), and in COMPACT_FLOAT32 storage neither are
+         * the double precision unit normals.
+         * @return tuple of pointers to the segmentVectors, planeUnitNormals, and segmentUnitNormals
+         */
+        [[nodiscard]] std::tuple<const Array3Triplet *, const Array3 *, const Array3Triplet *> getCaches() const;
+
+        /**
+         * Returns the storage of the internal caches.
+         * @return the storage
+         */
+        [[nodiscard]] MeshStorage getStorage() const;
+
+        /**
+         * Returns a GravityEvaluable sharing the polyhedron and the caches of this one, whose parallel loops
+         * run on the given executor, e.g. to embed the evaluations in the scheduler of a host application.
+         * This also applies to evaluables restored from a {@link Snapshot}.
+         * @param executor the executor, nullptr runs the loops with the thrust backend
+         * @return the GravityEvaluable using the executor
+         */
+        [[nodiscard]] GravityEvaluable withExecutor(std::shared_ptr<const Executor> executor) const;
+
+        /**
+         * Returns the executor of the parallel loops.
+         * @return the executor or nullptr if the loops run with the thrust backend
+         */
+        [[nodiscard]] const std::shared_ptr<const Executor> &getExecutor() const;
+
+        /**
+         * Returns a GravityEvaluable sharing the polyhedron and the caches of this one, which evaluates single
+         * points (with parallelization) on the given worker team. Every thread of the team sums up a fixed range of
+         * faces, hence the evaluation avoids the fork/join overhead of the thrust backend, which dominates the latency
+         * of a single point for meshes of a few thousand faces. Multiple points are still evaluated by the executor
+         * or the thrust backend.
+         * @param workerTeam the team, it may be shared by several evaluables, nullptr disables the latency-optimized mode
+         * @return the GravityEvaluable using the worker team
+         */
+        [[nodiscard]] GravityEvaluable withWorkerTeam(std::shared_ptr<WorkerTeam> workerTeam) const;
+
+        /**
+         * Returns the worker team evaluating single points.
+         * @return the worker team or nullptr
+         */
+        [[nodiscard]] const std::shared_ptr<WorkerTeam> &getWorkerTeam() const;
+
     private:
 
         /**
@@ -128,7 +335,39 @@ namespace polyhedralGravity {
          * and the segment unit normals.
          * Called by the constructor once.
          */
-        void prepare() const;
+        void prepare();
+
+        /**
+         * Prepares the compact caches, i.e. the 32-bit faces and the (single precision) unit normals.
+         * Called by {@link prepare} in compact storage.
+         * @tparam Real the floating point type of the cached unit normals
+         * @throws std::invalid_argument if the polyhedron has too many vertices for 32-bit indices or
+         *          if a widened unit normal deviates from the double precision one
+         */
+        template<typename Real>
+        void prepareCompact();
+
+        /**
+         * Assembles the input of {@link evaluateFace} from the compact caches, i.e. widens the unit normals to
+         * double precision and recomputes the segment vectors (exactly like {@link prepare}).
+         * @param index the index of the face
+         * @param computationPoint the computation point P
+         * @return tuple consisting of face (relative to P), segmentVectors, planeUnitNormal, and segmentUnitNormals
+         */
+        [[nodiscard]] thrust::tuple<Array3Triplet, Array3Triplet, Array3, Array3Triplet>
+        compactFace(size_t index, const Array3 &computationPoint) const;
+
+        /**
+         * Reads, evaluates, and passes chunks to the sink until the input is exhausted or the sink returns false.
+         * The buffers of the points and results are reused for every chunk.
+         * @param fill reads up to the given number of points into the buffer and returns the number of points read
+         * @param sink the callback receiving every completed chunk
+         * @param chunkSize the maximal number of points per chunk
+         * @param parallelization if true, the points of a chunk are evaluated in parallel
+         * @return the number of evaluated points
+         */
+        size_t streamChunks(const std::function<size_t(std::vector<Array3> &, size_t)> &fill, const ChunkSink &sink,
+                            size_t chunkSize, bool parallelization) const;
 
         /**
         * Evaluates the polyhedral gravity model for a given constant density polyhedron at computation
@@ -147,10 +386,37 @@ namespace polyhedralGravity {
          * at multiple computation points.
          * @tparam Parallelization if true, the calculation is parallelized
          * @param computationPoints the computation Points
+         * @param sortPoints if true, the points are evaluated along a Morton curve
          * @return vector of GravityModelResults containing the potential, the acceleration, and the change of acceleration
          */
         template<bool Parallelization = true>
-        [[nodiscard]] std::vector<GravityModelResult> evaluate(const std::vector<Array3> &computationPoints) const;
+        [[nodiscard]] std::vector<GravityModelResult> evaluate(const std::vector<Array3> &computationPoints,
+                                                               bool sortPoints = false) const;
+
+        /**
+         * Calls the function with the index of every computation point. If the points are sorted, the indices are
+         * visited along a Morton curve through the points, so that consecutive (and concurrent) evaluations
+         * see spatially coherent points. The function hence must write its results to the given index.
+         * @tparam Function callable with the index of a computation point
+         * @param computationPoints pointer to the first computation point
+         * @param count the number of computation points
+         * @param parallelization if true, the points are visited in parallel
+         * @param sortPoints if true, the points are visited along a Morton curve
+         * @param function the function called for every index
+         */
+        template<typename Function>
+        void forEachPoint(const Array3 *computationPoints, size_t count, bool parallelization, bool sortPoints,
+                          const Function &function) const;
+
+        /**
+         * Calls the function with every index of [0, count) in parallel, either on the executor or with the thrust
+         * backend.
+         * @tparam Function callable with an index
+         * @param count the number of indices
+         * @param function the function called for every index
+         */
+        template<typename Function>
+        void parallelFor(size_t count, const Function &function) const;
 
         /**
          * Evaluates the polyhedral gravity model for a given constant density polyhedron at computation a certain face.
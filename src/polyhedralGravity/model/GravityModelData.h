@@ -193,4 +193,31 @@ namespace polyhedralGravity {
         }
     };
 
+    /**
+     * Caller-provided output of a batch evaluation in structure-of-arrays layout, i.e. one contiguous array
+     * per component, each with one element per computation point. The arrays may reside anywhere, e.g. in a
+     * memory-mapped file. A nullptr skips the component.
+     * @note This struct is basically a named tuple
+     */
+    struct GravityModelResultSpans {
+        /** The potential V */
+        double *potential;
+        /** The acceleration Vx, Vy, Vz */
+        std::array<double *, 3> acceleration;
+        /** The second derivative tensor Vxx, Vyy, Vzz, Vxy, Vxz, Vyz */
+        std::array<double *, 6> tensor;
+
+        /**
+         * Returns the spans starting at the given computation point, e.g. for evaluating the points chunk by chunk.
+         * @param offset the index of the first computation point
+         * @return the shifted spans
+         */
+        [[nodiscard]] GravityModelResultSpans subspan(size_t offset) const {
+            const auto shift = [offset](double *pointer) { return pointer != nullptr ? pointer + offset : nullptr; };
+            return {shift(potential),
+                    {shift(acceleration[0]), shift(acceleration[1]), shift(acceleration[2])},
+                    {shift(tensor[0]), shift(tensor[1]), shift(tensor[2]), shift(tensor[3]), shift(tensor[4]), shift(tensor[5])}};
+        }
+    };
+
 }
@@ -0,0 +1,145 @@
+#include "IntegrityCache.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <process.h>
+#endif
+
+namespace polyhedralGravity::IntegrityCache {
+
+    namespace {
+        /** Guards the cache directory */
+        std::mutex directoryMutex{};
+
+        /** The directory set via setDirectory, if set it overrides the environment variable */
+        std::optional<std::string> directoryOverride{};
+
+        /**
+         * Returns the id of the calling process, which distinguishes the temporary files of several processes
+         * storing the same record (thread ids alone repeat across processes).
+         * @return the process id
+         */
+        long processId() {
+#if defined(__unix__) || defined(__APPLE__)
+            return static_cast<long>(::getpid());
+#elif defined(_WIN32)
+            return static_cast<long>(::_getpid());
+#else
+            return 0;
+#endif
+        }
+
+        std::filesystem::path recordPath(const std::string &directory, uint64_t key) {
+            std::stringstream name{};
+            name << std::hex << std::setw(16) << std::setfill('0') << key << FILE_SUFFIX;
+            return std::filesystem::path{directory} / name.str();
+        }
+    }
+
+    void setDirectory(const std::string &directory) {
+        std::lock_guard<std::mutex> lock{directoryMutex};
+        directoryOverride = directory;
+    }
+
+    std::string getDirectory() {
+        std::lock_guard<std::mutex> lock{directoryMutex};
+        if (directoryOverride.has_value()) {
+            return directoryOverride.value();
+        }
+        const char *environment = std::getenv(ENVIRONMENT_VARIABLE);
+        return environment != nullptr ? std::string{environment} : std::string{};
+    }
+
+    uint64_t hash(const std::vector<Array3> &vertices, const std::vector<IndexArray3> &faces,
+                  const NormalOrientation &orientation) {
+        uint64_t hash = util::FNV_OFFSET_BASIS;
+        util::fnv1a(hash, static_cast<uint64_t>(vertices.size()));
+        for (const Array3 &vertex: vertices) {
+            util::fnv1a(hash, vertex);
+        }
+        util::fnv1a(hash, static_cast<uint64_t>(faces.size()));
+        for (const IndexArray3 &face: faces) {
+            for (const size_t index: face) {
+                util::fnv1a(hash, static_cast<uint64_t>(index));
+            }
+        }
+        util::fnv1a(hash, orientation);
+        return hash;
+    }
+
+    std::optional<IntegrityRecord> load(uint64_t key, size_t faceCount) {
+        const std::string directory = getDirectory();
+        if (directory.empty()) {
+            return std::nullopt;
+        }
+        const std::filesystem::path path = recordPath(directory, key);
+        std::ifstream file{path};
+        if (!file.is_open()) {
+            return std::nullopt;
+        }
+        std::string header{};
+        std::getline(file, header);
+        std::string faceLabel{}, degeneratedLabel{}, orientationLabel{}, orientation{}, violatingLabel{};
+        size_t storedFaceCount{0}, violatingCount{0};
+        IntegrityRecord record{};
+        file >> faceLabel >> storedFaceCount >> degeneratedLabel >> record.degenerated
+                >> orientationLabel >> orientation >> violatingLabel >> violatingCount;
+        if (!file || header != FILE_HEADER || storedFaceCount != faceCount || violatingCount > faceCount ||
+            (orientation != "OUTWARDS" && orientation != "INWARDS")) {
+            POLYHEDRAL_GRAVITY_LOG_DEBUG("Ignoring the invalid integrity cache file {}", path.string());
+            return std::nullopt;
+        }
+        record.actualOrientation = orientation == "OUTWARDS" ? NormalOrientation::OUTWARDS : NormalOrientation::INWARDS;
+        for (size_t i = 0; i < violatingCount; ++i) {
+            size_t index{0};
+            if (!(file >> index) || index >= faceCount) {
+                POLYHEDRAL_GRAVITY_LOG_DEBUG("Ignoring the invalid integrity cache file {}", path.string());
+                return std::nullopt;
+            }
+            record.violatingIndices.insert(index);
+        }
+        POLYHEDRAL_GRAVITY_LOG_DEBUG("Loaded the mesh integrity results from the cache file {}", path.string());
+        return record;
+    }
+
+    void store(uint64_t key, size_t faceCount, const IntegrityRecord &record) {
+        const std::string directory = getDirectory();
+        if (directory.empty()) {
+            return;
+        }
+        const std::filesystem::path path = recordPath(directory, key);
+        std::filesystem::path temporaryPath = path;
+        temporaryPath += ".tmp" + std::to_string(processId()) + "-" +
+                         std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+        std::error_code error{};
+        std::filesystem::create_directories(directory, error);
+        if (error) {
+            POLYHEDRAL_GRAVITY_LOG_WARN("The integrity cache directory {} could not be created", directory);
+            return;
+        }
+        {
+            std::ofstream file{temporaryPath};
+            file << FILE_HEADER << '\n'
+                 << "faces " << faceCount << '\n'
+                 << "degenerated " << record.degenerated << '\n'
+                 << "orientation " << record.actualOrientation << '\n'
+                 << "violating " << record.violatingIndices.size();
+            for (const size_t index: record.violatingIndices) {
+                file << ' ' << index;
+            }
+            file << '\n';
+            if (!file) {
+                error = std::make_error_code(std::errc::io_error);
+            }
+        }
+        if (!error) {
+            std::filesystem::rename(temporaryPath, path, error);
+        }
+        if (error) {
+            std::filesystem::remove(temporaryPath, error);
+            POLYHEDRAL_GRAVITY_LOG_WARN("The mesh integrity results could not be written to the cache file {}", path.string());
+        }
+    }
+
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <set>
+#include <optional>
+#include <mutex>
+#include <thread>
+#include <functional>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <filesystem>
+
+#include "PolyhedronDefinitions.h"
+#include "polyhedralGravity/output/Logging.h"
+#include "polyhedralGravity/util/UtilityBinary.h"
+
+namespace polyhedralGravity {
+
+    /**
+     * The outcome of the mesh integrity checks of a {@link Polyhedron}.
+     * The violating indices are the faces whose vertex ordering is swapped (index 0 with index 1) in case of
+     * {@link PolyhedronIntegrity::HEAL}. Hence, they are the healed face permutation and can be replayed
+     * without re-running the checks.
+     * @note This struct is basically a named tuple
+     */
+    struct IntegrityRecord {
+        /** True if at least one triangle of the mesh is degenerated (orientation is not determined then) */
+        bool degenerated;
+        /** The detected majority orientation of the plane unit normals */
+        NormalOrientation actualOrientation;
+        /** The indices of the faces violating the majority orientation */
+        std::set<size_t> violatingIndices;
+    };
+
+    /**
+     * Namespace containing the on-disk cache of the mesh integrity checks.
+     * The cache stores one file per mesh in a directory. The files are keyed by a content hash over the
+     * vertices, faces, and specified orientation of the polyhedron.
+     * The cache is disabled by default. It is enabled by setting a directory via {@link setDirectory} or
+     * via the environment variable POLYHEDRAL_GRAVITY_INTEGRITY_CACHE.
+     * Failing to read or write the cache never fails the construction of a polyhedron, the checks are run instead.
+     */
+    namespace IntegrityCache {
+
+        /** The name of the environment variable specifying the cache directory */
+        constexpr char ENVIRONMENT_VARIABLE[] = "POLYHEDRAL_GRAVITY_INTEGRITY_CACHE";
+
+        /** The suffix of the cache files */
+        constexpr char FILE_SUFFIX[] = ".integrity";
+
+        /** The header (and format version) of every cache file */
+        constexpr char FILE_HEADER[] = "polyhedral-gravity-integrity 1";
+
+        /**
+         * Sets the cache directory. An empty string disables the cache.
+         * Overrides the environment variable POLYHEDRAL_GRAVITY_INTEGRITY_CACHE.
+         * @param directory the directory to store the cache files in (created if it does not exist)
+         */
+        void setDirectory(const std::string &directory);
+
+        /**
+         * Returns the cache directory. Empty if the cache is disabled.
+         * @return the cache directory
+         */
+        std::string getDirectory();
+
+        /**
+         * Computes the content hash (64-bit FNV-1a) of a polyhedral mesh.
+         * @param vertices the vertices of the polyhedron
+         * @param faces the faces of the polyhedron
+         * @param orientation the specified orientation of the plane unit normals
+         * @return the hash
+         */
+        uint64_t hash(const std::vector<Array3> &vertices, const std::vector<IndexArray3> &faces,
+                      const NormalOrientation &orientation);
+
+        /**
+         * Loads a record from the cache.
+         * @param key the content hash of the mesh
+         * @param faceCount the number of faces of the mesh, guards against hash collisions and stale files
+         * @return the record or std::nullopt if the cache is disabled or the record does not exist (or is invalid)
+         */
+        std::optional<IntegrityRecord> load(uint64_t key, size_t faceCount);
+
+        /**
+         * Stores a record in the cache. The file is written to a temporary file first and then renamed,
+         * so that concurrent readers never observe a partially written record.
+         * Does nothing if the cache is disabled.
+         * @param key the content hash of the mesh
+         * @param faceCount the number of faces of the mesh
+         * @param record the outcome of the integrity checks
+         */
+        void store(uint64_t key, size_t faceCount, const IntegrityRecord &record);
+
+    }
+
+}
@@ -0,0 +1,240 @@
+#include "Numa.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include "polyhedralGravity/output/Logging.h"
+
+namespace polyhedralGravity {
+
+    namespace {
+        /** The directory of the NUMA nodes in the Linux sysfs */
+        constexpr char NUMA_NODE_DIRECTORY[] = "/sys/devices/system/node";
+
+        /** The number of chunks per thread a loop is split into, so that faster threads take over more chunks */
+        constexpr size_t CHUNKS_PER_THREAD = 4;
+
+        /**
+         * Returns the CPUs the process may run on.
+         * @return the CPU indices in ascending order, empty if unknown
+         */
+        std::vector<size_t> allowedCpus() {
+            std::vector<size_t> cpus{};
+#ifdef __linux__
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+                for (size_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                    if (CPU_ISSET(cpu, &set)) {
+                        cpus.push_back(cpu);
+                    }
+                }
+            }
+#endif
+            return cpus;
+        }
+
+        /**
+         * The state of a single loop of a {@link PinnedThreadPool}, shared by the threads taking part in it.
+         */
+        struct LoopState {
+            /** The index of the next unclaimed chunk */
+            std::atomic<size_t> next{0};
+            /** The number of completed chunks */
+            size_t completed{0};
+            /** The first exception thrown by the body */
+            std::exception_ptr exception{};
+            /** Guards the completed chunks and the exception */
+            std::mutex mutex{};
+            /** Notified if the last chunk has been completed */
+            std::condition_variable finished{};
+        };
+    }// namespace
+
+    std::vector<size_t> parseCpuList(const std::string &cpuList) {
+        std::vector<size_t> cpus{};
+        std::stringstream stream{cpuList};
+        std::string range{};
+        while (std::getline(stream, range, ',')) {
+            range.erase(std::remove_if(range.begin(), range.end(), [](char c) { return std::isspace(c); }), range.end());
+            if (range.empty()) {
+                continue;
+            }
+            try {
+                size_t position{0};
+                const size_t first = std::stoul(range, &position);
+                size_t last = first;
+                if (position < range.size()) {
+                    if (range[position] != '-') {
+                        throw std::invalid_argument{range};
+                    }
+                    const std::string end = range.substr(position + 1);
+                    last = std::stoul(end, &position);
+                    if (position != end.size() || last < first) {
+                        throw std::invalid_argument{range};
+                    }
+                }
+                for (size_t cpu = first; cpu <= last; ++cpu) {
+                    cpus.push_back(cpu);
+                }
+            } catch (const std::logic_error &) {
+                throw std::invalid_argument{"The CPU list '" + cpuList + "' is malformed."};
+            }
+        }
+        std::sort(cpus.begin(), cpus.end());
+        cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+        return cpus;
+    }
+
+    std::vector<NumaNode> detectNumaNodes() {
+        std::vector<NumaNode> nodes{};
+        const std::vector<size_t> allowed = allowedCpus();
+        std::error_code error{};
+        for (const auto &entry: std::filesystem::directory_iterator{NUMA_NODE_DIRECTORY, error}) {
+            const std::string name = entry.path().filename().string();
+            if (name.rfind("node", 0) != 0 || name.size() == 4 ||
+                !std::all_of(name.cbegin() + 4, name.cend(), [](char c) { return std::isdigit(c); })) {
+                continue;
+            }
+            std::ifstream file{entry.path() / "cpulist"};
+            std::string cpuList{};
+            if (!std::getline(file, cpuList)) {
+                continue;
+            }
+            try {
+                NumaNode node{std::stoul(name.substr(4)), parseCpuList(cpuList)};
+                if (!allowed.empty()) {
+                    const auto end = std::remove_if(node.cpus.begin(), node.cpus.end(), [&allowed](size_t cpu) {
+                        return !std::binary_search(allowed.cbegin(), allowed.cend(), cpu);
+                    });
+                    node.cpus.erase(end, node.cpus.end());
+                }
+                if (!node.cpus.empty()) {
+                    nodes.push_back(std::move(node));
+                }
+            } catch (const std::invalid_argument &) {
+                POLYHEDRAL_GRAVITY_LOG_WARN("Ignoring the NUMA node {} with the malformed CPU list {}", name, cpuList);
+            }
+        }
+        if (nodes.empty()) {
+            // No topology available, every CPU is considered to be on a single node
+            std::vector<size_t> cpus = allowed;
+            if (cpus.empty()) {
+                cpus.resize(std::max(std::thread::hardware_concurrency(), 1u));
+                std::iota(cpus.begin(), cpus.end(), 0);
+            }
+            return {NumaNode{0, std::move(cpus)}};
+        }
+        std::sort(nodes.begin(), nodes.end(), [](const NumaNode &lhs, const NumaNode &rhs) { return lhs.id < rhs.id; });
+        return nodes;
+    }
+
+    bool pinCurrentThread(const std::vector<size_t> &cpus) {
+#ifdef __linux__
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (const size_t cpu: cpus) {
+            if (cpu < CPU_SETSIZE) {
+                CPU_SET(cpu, &set);
+            }
+        }
+        return CPU_COUNT(&set) > 0 && sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+        return false;
+#endif
+    }
+
+    PinnedThreadPool::PinnedThreadPool(const std::vector<size_t> &cpus) {
+        for (size_t i = 1; i < cpus.size(); ++i) {
+            _workers.emplace_back([this, cpu = cpus[i]]() {
+                if (!pinCurrentThread({cpu})) {
+                    POLYHEDRAL_GRAVITY_LOG_DEBUG("Could not pin a worker thread to the CPU {}", cpu);
+                }
+                this->work();
+            });
+        }
+    }
+
+    PinnedThreadPool::~PinnedThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _stopped = true;
+        }
+        _taskAdded.notify_all();
+        for (auto &worker: _workers) {
+            worker.join();
+        }
+    }
+
+    void PinnedThreadPool::work() {
+        while (true) {
+            std::function<void()> task{};
+            {
+                std::unique_lock<std::mutex> lock{_mutex};
+                _taskAdded.wait(lock, [this]() { return _stopped || !_tasks.empty(); });
+                if (_tasks.empty()) {
+                    return;
+                }
+                task = std::move(_tasks.front());
+                _tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+    size_t PinnedThreadPool::countThreads() const {
+        return _workers.size() + 1;
+    }
+
+    void PinnedThreadPool::parallelFor(size_t count, const RangeBody &body) const {
+        if (count == 0) {
+            return;
+        }
+        const size_t chunks = std::min(count, CHUNKS_PER_THREAD * this->countThreads());
+        const auto state = std::make_shared<LoopState>();
+        // Workers picking up the task after every chunk has been claimed return without touching the body
+        const auto runChunks = [state, count, chunks, &body]() {
+            for (size_t chunk = state->next++; chunk < chunks; chunk = state->next++) {
+                std::exception_ptr exception{};
+                try {
+                    body(count * chunk / chunks, count * (chunk + 1) / chunks);
+                } catch (...) {
+                    exception = std::current_exception();
+                }
+                std::lock_guard<std::mutex> lock{state->mutex};
+                if (exception && !state->exception) {
+                    state->exception = exception;
+                }
+                if (++state->completed == chunks) {
+                    state->finished.notify_all();
+                }
+            }
+        };
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            for (size_t i = 0; i < std::min(chunks - 1, _workers.size()); ++i) {
+                _tasks.emplace_back(runChunks);
+            }
+        }
+        _taskAdded.notify_all();
+        runChunks();
+        std::unique_lock<std::mutex> lock{state->mutex};
+        state->finished.wait(lock, [&state, chunks]() { return state->completed == chunks; });
+        if (state->exception) {
+            std::rethrow_exception(state->exception);
+        }
+    }
+
+}// namespace polyhedralGravity
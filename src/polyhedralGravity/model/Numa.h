@@ -0,0 +1,105 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Executor.h"
+
+namespace polyhedralGravity {
+
+    /**
+     * A NUMA node of the machine, i.e. a socket (or a part of it) with its own memory controller.
+     * @note This struct is basically a named tuple
+     */
+    struct NumaNode {
+        /** The operating system's index of the node */
+        size_t id;
+        /** The operating system's indices of the node's logical CPUs the process may run on */
+        std::vector<size_t> cpus;
+    };
+
+    /**
+     * Parses a list of CPUs in the format of the Linux sysfs, e.g. "0-3,8-11".
+     * @param cpuList the comma-separated list of CPU indices and inclusive ranges, may be empty
+     * @return the CPU indices in ascending order
+     * @throws std::invalid_argument if the list is malformed
+     */
+    std::vector<size_t> parseCpuList(const std::string &cpuList);
+
+    /**
+     * Detects the NUMA nodes of the machine from /sys/devices/system/node (Linux only). Only the CPUs the process
+     * may run on are considered, nodes without any of them (e.g. memory-only nodes) are skipped.
+     * If the topology is not available, a single node with every hardware thread is returned.
+     * @return the nodes, at least one
+     */
+    std::vector<NumaNode> detectNumaNodes();
+
+    /**
+     * Pins the calling thread to the given CPUs (Linux only).
+     * @param cpus the CPUs the thread may run on
+     * @return true if the thread has been pinned, false if pinning is not supported or failed
+     *          (the thread then continues to run unpinned)
+     */
+    bool pinCurrentThread(const std::vector<size_t> &cpus);
+
+    /**
+     * Executor with persistent worker threads, each one pinned to a CPU, e.g. to the CPUs of a single
+     * {@link NumaNode}. The calling thread takes part in every loop, hence loops can be nested and the pool runs
+     * one thread per given CPU if the calling thread is pinned to the first one.
+     * The executor is thread-safe, i.e. several threads may run loops concurrently.
+     */
+    class PinnedThreadPool final : public Executor {
+
+        /** The workers, one for every CPU except the first one */
+        std::vector<std::thread> _workers{};
+
+        /** The pending tasks */
+        mutable std::deque<std::function<void()>> _tasks{};
+
+        /** True if the workers are to be stopped */
+        bool _stopped{false};
+
+        /** Guards the tasks and the stop flag */
+        mutable std::mutex _mutex{};
+
+        /** Notified if a task was added or the workers are to be stopped */
+        mutable std::condition_variable _taskAdded{};
+
+        /**
+         * The loop of every worker, runs the tasks until the pool is stopped.
+         */
+        void work();
+
+    public:
+
+        /**
+         * Creates a new PinnedThreadPool, starting one worker for every CPU except the first one.
+         * @param cpus the CPUs, the first one being reserved for the calling thread
+         */
+        explicit PinnedThreadPool(const std::vector<size_t> &cpus);
+
+        PinnedThreadPool(const PinnedThreadPool &) = delete;
+
+        PinnedThreadPool &operator=(const PinnedThreadPool &) = delete;
+
+        /**
+         * Stops and joins the workers.
+         */
+        ~PinnedThreadPool() override;
+
+        /**
+         * Returns the number of threads running a loop, i.e. the workers and the calling thread.
+         * @return the number of threads
+         */
+        [[nodiscard]] size_t countThreads() const;
+
+        void parallelFor(size_t count, const RangeBody &body) const override;
+
+    };
+
+}// namespace polyhedralGravity
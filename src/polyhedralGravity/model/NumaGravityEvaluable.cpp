@@ -0,0 +1,155 @@
+#include "NumaGravityEvaluable.h"
+
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <stdexcept>
+#include <thread>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include "polyhedralGravity/output/Logging.h"
+
+namespace polyhedralGravity {
+
+    template<typename Function>
+    void NumaGravityEvaluable::onEveryNode(const Function &function) const {
+        std::vector<std::exception_ptr> exceptions(_replicas.size());
+        std::vector<std::thread> threads{};
+        threads.reserve(_replicas.size());
+        for (size_t index = 0; index < _replicas.size(); ++index) {
+            threads.emplace_back([this, &function, &exceptions, index]() {
+                // The first CPU is reserved for this thread, the pool's workers run on the remaining ones
+                if (!pinCurrentThread({_replicas[index].node.cpus.front()})) {
+                    POLYHEDRAL_GRAVITY_LOG_DEBUG("Could not pin the thread of the NUMA node {}", _replicas[index].node.id);
+                }
+                try {
+                    function(index);
+                } catch (...) {
+                    exceptions[index] = std::current_exception();
+                }
+            });
+        }
+        for (auto &thread: threads) {
+            thread.join();
+        }
+        for (const auto &exception: exceptions) {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        }
+    }
+
+    NumaGravityEvaluable::NumaGravityEvaluable(const Polyhedron &polyhedron, MeshStorage storage,
+                                               std::vector<NumaNode> nodes) {
+        if (nodes.empty()) {
+            throw std::invalid_argument("A NumaGravityEvaluable requires at least one NUMA node.");
+        }
+        for (auto &node: nodes) {
+            if (node.cpus.empty()) {
+                throw std::invalid_argument("Every NUMA node of a NumaGravityEvaluable requires at least one CPU.");
+            }
+            auto pool = std::make_shared<const PinnedThreadPool>(node.cpus);
+            _replicas.push_back(Replica{std::move(node), std::move(pool), nullptr});
+        }
+        // The copies of the mesh and the caches are first touched by the node's threads, i.e. allocated locally
+        this->onEveryNode([this, &polyhedron, storage](size_t index) {
+            Replica &replica = _replicas[index];
+            Polyhedron localPolyhedron{std::vector<Array3>{polyhedron.getVertices()},
+                                       std::vector<IndexArray3>{polyhedron.getFaces()},
+                                       polyhedron.getDensity(), polyhedron.getOrientation(),
+                                       PolyhedronIntegrity::DISABLE, polyhedron.getMeshUnit(), VertexIndexing::ZERO_BASED};
+            replica.evaluable = std::make_unique<const GravityEvaluable>(std::move(localPolyhedron), storage,
+                                                                         replica.pool);
+        });
+        POLYHEDRAL_GRAVITY_LOG_DEBUG("Replicated the polyhedron and its caches on {} NUMA node(s)", _replicas.size());
+    }
+
+    const NumaGravityEvaluable::Replica &NumaGravityEvaluable::localReplica() const {
+#ifdef __linux__
+        const int cpu = sched_getcpu();
+        if (cpu >= 0) {
+            const auto replica = std::find_if(_replicas.cbegin(), _replicas.cend(), [cpu](const Replica &candidate) {
+                return std::find(candidate.node.cpus.cbegin(), candidate.node.cpus.cend(),
+                                 static_cast<size_t>(cpu)) != candidate.node.cpus.cend();
+            });
+            if (replica != _replicas.cend()) {
+                return *replica;
+            }
+        }
+#endif
+        return _replicas.front();
+    }
+
+    std::vector<size_t> NumaGravityEvaluable::partition(size_t count) const {
+        size_t totalCpus{0};
+        for (const auto &replica: _replicas) {
+            totalCpus += replica.node.cpus.size();
+        }
+        std::vector<size_t> offsets{0};
+        size_t cpus{0};
+        for (const auto &replica: _replicas) {
+            cpus += replica.node.cpus.size();
+            offsets.push_back(count * cpus / totalCpus);
+        }
+        return offsets;
+    }
+
+    std::variant<GravityModelResult, std::vector<GravityModelResult>>
+    NumaGravityEvaluable::operator()(const std::variant<Array3, std::vector<Array3>> &computationPoints,
+                                     bool parallelization, bool sortPoints) const {
+        if (std::holds_alternative<Array3>(computationPoints)) {
+            return (*this->localReplica().evaluable)(computationPoints, parallelization);
+        }
+        const auto &points = std::get<std::vector<Array3>>(computationPoints);
+        if (!parallelization) {
+            return (*this->localReplica().evaluable)(points, false, sortPoints);
+        }
+        std::vector<GravityModelResult> results(points.size());
+        const std::vector<size_t> offsets = this->partition(points.size());
+        this->onEveryNode([this, &points, &results, &offsets, sortPoints](size_t index) {
+            const std::vector<Array3> share(points.cbegin() + offsets[index], points.cbegin() + offsets[index + 1]);
+            if (share.empty()) {
+                return;
+            }
+            const auto shareResults = std::get<std::vector<GravityModelResult>>(
+                    (*_replicas[index].evaluable)(share, true, sortPoints));
+            std::copy(shareResults.cbegin(), shareResults.cend(), results.begin() + offsets[index]);
+        });
+        return results;
+    }
+
+    void NumaGravityEvaluable::evaluate(const Array3 *computationPoints, size_t count, double *potential,
+                                        Array3 *acceleration, Array6 *tensor, bool parallelization,
+                                        bool sortPoints) const {
+        if (!parallelization) {
+            this->localReplica().evaluable->evaluate(computationPoints, count, potential, acceleration, tensor, false,
+                                                     sortPoints);
+            return;
+        }
+        const std::vector<size_t> offsets = this->partition(count);
+        this->onEveryNode([&](size_t index) {
+            const size_t first = offsets[index];
+            _replicas[index].evaluable->evaluate(computationPoints + first, offsets[index + 1] - first,
+                                                 potential != nullptr ? potential + first : nullptr,
+                                                 acceleration != nullptr ? acceleration + first : nullptr,
+                                                 tensor != nullptr ? tensor + first : nullptr, true, sortPoints);
+        });
+    }
+
+    std::vector<NumaNode> NumaGravityEvaluable::getNodes() const {
+        std::vector<NumaNode> nodes{};
+        nodes.reserve(_replicas.size());
+        std::transform(_replicas.cbegin(), _replicas.cend(), std::back_inserter(nodes), [](const Replica &replica) {
+            return replica.node;
+        });
+        return nodes;
+    }
+
+    const GravityEvaluable &NumaGravityEvaluable::getReplica(size_t index) const {
+        return *_replicas.at(index).evaluable;
+    }
+
+}// namespace polyhedralGravity
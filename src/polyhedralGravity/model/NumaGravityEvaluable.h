@@ -0,0 +1,125 @@
+#pragma once
+
+#include <memory>
+#include <variant>
+#include <vector>
+
+#include "GravityEvaluable.h"
+#include "GravityModelData.h"
+#include "Numa.h"
+#include "Polyhedron.h"
+
+namespace polyhedralGravity {
+
+    /**
+     * NUMA-aware variant of the {@link GravityEvaluable} for machines with several sockets.
+     * The read-only mesh and caches are replicated once per {@link NumaNode}, every replica being allocated and
+     * computed by threads pinned to its node, so that its pages reside in the node's local memory (first touch).
+     * Every node runs its own {@link PinnedThreadPool} and evaluates a contiguous share of a batch of points,
+     * proportional to its number of CPUs, hence no thread reads the caches across the socket interconnect.
+     * The memory is increased by the factor of the number of nodes.
+     *
+     * @note The replicas are only local if the memory policy of the process is the default local allocation,
+     * i.e. not if it runs under e.g. numactl --interleave.
+     */
+    class NumaGravityEvaluable final {
+
+        /**
+         * A copy of the evaluable residing in the memory of a single node.
+         * @note This struct is basically a named tuple
+         */
+        struct Replica {
+            /** The node */
+            NumaNode node;
+            /** The threads pinned to the node's CPUs */
+            std::shared_ptr<const PinnedThreadPool> pool;
+            /** The evaluable, whose caches reside in the node's memory */
+            std::unique_ptr<const GravityEvaluable> evaluable;
+        };
+
+        /** The replicas, one for every node */
+        std::vector<Replica> _replicas{};
+
+    public:
+
+        /**
+         * Replicates the polyhedron and its caches on every given NUMA node.
+         * @param polyhedron the constant density polyhedron
+         * @param storage the storage of the caches (see {@link MeshStorage}, default: DOUBLE)
+         * @param nodes the nodes to replicate on (default: every node of the machine, see {@link detectNumaNodes})
+         * @throws std::invalid_argument if no node is given or a node has no CPUs, or if the caches cannot
+         *          be created in the given storage (see {@link GravityEvaluable})
+         */
+        explicit NumaGravityEvaluable(const Polyhedron &polyhedron, MeshStorage storage = MeshStorage::DOUBLE,
+                                      std::vector<NumaNode> nodes = detectNumaNodes());
+
+        /**
+         * Evaluates the polyhedral gravity model at a computation point P or at multiple computation points.
+         * Multiple points are split between the nodes, each node evaluating its share with its pinned threads.
+         * A single point is evaluated with the replica of the node the calling thread currently runs on.
+         *
+         * @param computationPoints the computation point P or multiple computation points in a vector
+         * @param parallelization if true, the calculation is parallelized
+         * @param sortPoints if true, every node evaluates its share of the points along a Morton curve
+         * @return the GravityModelResult containing the potential, acceleration, and second derivative
+         */
+        std::variant<GravityModelResult, std::vector<GravityModelResult>>
+        operator()(const std::variant<Array3, std::vector<Array3>> &computationPoints,
+                   bool parallelization = true, bool sortPoints = false) const;
+
+        /**
+         * Evaluates the polyhedral gravity model at multiple computation points and writes the results into
+         * caller-provided arrays in array-of-structures layout (see {@link GravityEvaluable::evaluate}).
+         * @param computationPoints pointer to the first computation point
+         * @param count the number of computation points
+         * @param potential the output potentials with (at least) count elements, nullptr skips them
+         * @param acceleration the output accelerations with (at least) count elements, nullptr skips them
+         * @param tensor the output second derivative tensors with (at least) count elements, nullptr skips them
+         * @param parallelization if true, the points are split between the nodes and evaluated in parallel
+         * @param sortPoints if true, every node evaluates its share of the points along a Morton curve
+         */
+        void evaluate(const Array3 *computationPoints, size_t count, double *potential, Array3 *acceleration,
+                      Array6 *tensor, bool parallelization = true, bool sortPoints = false) const;
+
+        /**
+         * Returns the nodes the evaluable is replicated on.
+         * @return the nodes
+         */
+        [[nodiscard]] std::vector<NumaNode> getNodes() const;
+
+        /**
+         * Returns the replica of a node.
+         * @param index the index of the node in {@link getNodes}
+         * @return the replica's evaluable
+         * @throws std::out_of_range if the index is out of range
+         */
+        [[nodiscard]] const GravityEvaluable &getReplica(size_t index) const;
+
+    private:
+
+        /**
+         * Runs the function once for every node, each call on a new thread pinned to the node's CPUs,
+         * and waits for all calls.
+         * @tparam Function callable with the index of a replica
+         * @param function the function
+         * @throws the first exception thrown by a call
+         */
+        template<typename Function>
+        void onEveryNode(const Function &function) const;
+
+        /**
+         * Returns the replica of the node the calling thread currently runs on, the first one if unknown.
+         * @return the replica
+         */
+        [[nodiscard]] const Replica &localReplica() const;
+
+        /**
+         * Splits the points between the nodes proportionally to their number of CPUs.
+         * @param count the number of points
+         * @return the first point of every node followed by count
+         */
+        [[nodiscard]] std::vector<size_t> partition(size_t count) const;
+
+    };
+
+}// namespace polyhedralGravity
@@ -0,0 +1,166 @@
+#include "Parallelization.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include "polyhedralGravity/Info.h"
+#include "polyhedralGravity/output/Logging.h"
+
+namespace polyhedralGravity {
+
+    namespace {
+        /** The largest number of threads which fits into the packed settings */
+        constexpr uint64_t MAX_PACKED_THREADS = std::numeric_limits<uint64_t>::max() >> 8;
+
+        /**
+         * Packs the settings into a single word (the backend in the lowest byte), so that the default settings
+         * are published atomically and read without a lock on every parallel call.
+         * Larger numbers of threads than MAX_PACKED_THREADS are clamped.
+         */
+        uint64_t pack(const ParallelizationSettings &settings) {
+            const uint64_t threads = std::min<uint64_t>(settings.threads, MAX_PACKED_THREADS);
+            return threads << 8 | static_cast<uint8_t>(settings.backend);
+        }
+
+        /** Reverses {@link pack} */
+        ParallelizationSettings unpack(uint64_t packed) {
+            return {static_cast<ParallelizationBackend>(packed & 0xFF), static_cast<size_t>(packed >> 8)};
+        }
+
+        /**
+         * Reads the initial default settings from the environment variables,
+         * invalid values are ignored with a warning, since they cannot be reported to a caller.
+         */
+        ParallelizationSettings readEnvironment() {
+            ParallelizationSettings settings{readParallelizationBackend(std::string{POLYHEDRAL_GRAVITY_PARALLELIZATION}), 0};
+            if (const char *backend = std::getenv(Parallelization::BACKEND_ENVIRONMENT_VARIABLE); backend != nullptr) {
+                try {
+                    const ParallelizationBackend requested = readParallelizationBackend(backend);
+                    if (Parallelization::isAvailable(requested)) {
+                        settings.backend = requested;
+                    } else {
+                        POLYHEDRAL_GRAVITY_LOG_WARN("The parallelization backend {} is not available in this build, using {}",
+                                                    backend, POLYHEDRAL_GRAVITY_PARALLELIZATION);
+                    }
+                } catch (const std::invalid_argument &) {
+                    POLYHEDRAL_GRAVITY_LOG_WARN("Ignoring the unknown parallelization backend {}", backend);
+                }
+            }
+            if (const char *threads = std::getenv(Parallelization::THREADS_ENVIRONMENT_VARIABLE); threads != nullptr) {
+                char *end{nullptr};
+                const unsigned long long count = std::strtoull(threads, &end, 10);
+                if (end != threads && *end == '\0') {
+                    settings.threads = static_cast<size_t>(count);
+                } else {
+                    POLYHEDRAL_GRAVITY_LOG_WARN("Ignoring the invalid number of threads {}", threads);
+                }
+            }
+            return settings;
+        }
+
+        /** The process-wide (packed) default settings, initialized from the environment on first use */
+        std::atomic<uint64_t> &defaultSettings() {
+            static std::atomic<uint64_t> settings{pack(readEnvironment())};
+            return settings;
+        }
+
+        /** Throws if the backend is not compiled into this build */
+        void checkAvailable(ParallelizationBackend backend) {
+            if (!Parallelization::isAvailable(backend)) {
+                std::stringstream message{};
+                message << "The parallelization backend " << backend << " is not available in this build.";
+                throw std::invalid_argument(message.str());
+            }
+        }
+    }// namespace
+
+    thread_local std::optional<ParallelizationSettings> Parallelization::_scopedSettings{};
+
+    std::ostream &operator<<(std::ostream &os, const ParallelizationBackend &backend) {
+        switch (backend) {
+            case ParallelizationBackend::CPP:
+                os << "CPP";
+            break;
+            case ParallelizationBackend::OMP:
+                os << "OMP";
+            break;
+            case ParallelizationBackend::TBB:
+                os << "TBB";
+            break;
+            default:
+                os << "Unknown";
+            break;
+        }
+        return os;
+    }
+
+    ParallelizationBackend readParallelizationBackend(const std::string &name) {
+        if (name == "CPP") {
+            return ParallelizationBackend::CPP;
+        } else if (name == "OMP") {
+            return ParallelizationBackend::OMP;
+        } else if (name == "TBB") {
+            return ParallelizationBackend::TBB;
+        } else {
+            throw std::invalid_argument{"The parallelization backend must be either 'CPP', 'OMP' or 'TBB'"};
+        }
+    }
+
+    std::vector<ParallelizationBackend> Parallelization::availableBackends() {
+        std::vector<ParallelizationBackend> backends{ParallelizationBackend::CPP};
+#ifdef POLYHEDRAL_GRAVITY_OMP
+        backends.push_back(ParallelizationBackend::OMP);
+#endif
+#ifdef POLYHEDRAL_GRAVITY_TBB
+        backends.push_back(ParallelizationBackend::TBB);
+#endif
+        return backends;
+    }
+
+    bool Parallelization::isAvailable(ParallelizationBackend backend) {
+        const std::vector<ParallelizationBackend> backends = availableBackends();
+        return std::find(backends.cbegin(), backends.cend(), backend) != backends.cend();
+    }
+
+    ParallelizationSettings Parallelization::getDefault() {
+        return unpack(defaultSettings().load(std::memory_order_acquire));
+    }
+
+    void Parallelization::setDefault(const ParallelizationSettings &settings) {
+        checkAvailable(settings.backend);
+        defaultSettings().store(pack(settings), std::memory_order_release);
+    }
+
+    ParallelizationSettings Parallelization::current() {
+        return _scopedSettings.has_value() ? _scopedSettings.value() : getDefault();
+    }
+
+    int Parallelization::threadLimit(size_t threads) {
+        // hardware_concurrency() is zero if it is unknown, then only the conversion to int is guarded
+        const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+        const size_t limit = hardwareThreads != 0 ? hardwareThreads : static_cast<size_t>(std::numeric_limits<int>::max());
+        return static_cast<int>(std::clamp<size_t>(threads, 1, std::min<size_t>(limit, std::numeric_limits<int>::max())));
+    }
+
+    ParallelizationScope::ParallelizationScope(const ParallelizationSettings &settings)
+        : _previous{Parallelization::_scopedSettings} {
+        checkAvailable(settings.backend);
+        Parallelization::_scopedSettings = settings;
+    }
+
+    ParallelizationScope::ParallelizationScope(size_t threads)
+        : _previous{Parallelization::_scopedSettings} {
+        Parallelization::_scopedSettings = ParallelizationSettings{Parallelization::current().backend, threads};
+    }
+
+    ParallelizationScope::~ParallelizationScope() {
+        Parallelization::_scopedSettings = _previous;
+    }
+
+}// namespace polyhedralGravity
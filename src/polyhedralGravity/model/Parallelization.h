@@ -0,0 +1,206 @@
+#pragma once
+
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "thrust/execution_policy.h"
+#include "thrust/system/cpp/execution_policy.h"
+#ifdef POLYHEDRAL_GRAVITY_OMP
+#include "thrust/system/omp/execution_policy.h"
+#include <omp.h>
+#endif
+#ifdef POLYHEDRAL_GRAVITY_TBB
+#include "thrust/system/tbb/execution_policy.h"
+#include <tbb/task_arena.h>
+#endif
+
+namespace polyhedralGravity {
+
+    /**
+     * The thrust host systems the parallel algorithms can be executed with.
+     * Every system configured by CMake (POLYHEDRAL_GRAVITY_PARALLELIZATION and
+     * POLYHEDRAL_GRAVITY_ADDITIONAL_PARALLELIZATION) is compiled into the same build and selectable at runtime.
+     */
+    enum class ParallelizationBackend : char {
+        /** Serial execution, always available */
+        CPP,
+        /** Parallel execution with OpenMP */
+        OMP,
+        /** Parallel execution with Intel's Threading Building Blocks */
+        TBB,
+    };
+
+    /**
+     * Stream operator for the ParallelizationBackend enum. Prints the enum to a human-readable string.
+     * @param os The output stream to write the string representation to.
+     * @param backend the backend to print
+     * @return The output stream after writing the string representation.
+     */
+    std::ostream &operator<<(std::ostream &os, const ParallelizationBackend &backend);
+
+    /**
+     * Reads the backend from its name, i.e. CPP, OMP, or TBB.
+     * @param name the backend's name
+     * @return the backend
+     * @throws std::invalid_argument if the name is no backend's name
+     */
+    ParallelizationBackend readParallelizationBackend(const std::string &name);
+
+    /**
+     * The backend and the number of threads the parallel algorithms are executed with.
+     * @note This struct is basically a named tuple
+     */
+    struct ParallelizationSettings {
+        /** The thrust host system */
+        ParallelizationBackend backend;
+        /**
+         * The maximal number of threads, zero is the backend's default (usually one thread per core).
+         * Larger numbers than the hardware threads are clamped (see {@link Parallelization::threadLimit}).
+         */
+        size_t threads;
+    };
+
+    /**
+     * Selects the backend of the parallel algorithms at runtime.
+     * The process-wide default is initialized from the environment variables POLYHEDRAL_GRAVITY_BACKEND
+     * (e.g. OMP) and POLYHEDRAL_GRAVITY_THREADS (e.g. 4), otherwise it is the configured
+     * POLYHEDRAL_GRAVITY_PARALLELIZATION with the backend's default number of threads.
+     * A {@link ParallelizationScope} overrides the default for the calls of a single thread.
+     */
+    class Parallelization {
+
+        /** The settings of the current thread's innermost scope, std::nullopt outside any scope */
+        static thread_local std::optional<ParallelizationSettings> _scopedSettings;
+
+        friend class ParallelizationScope;
+
+    public:
+
+        /** The name of the environment variable specifying the default backend */
+        static constexpr char BACKEND_ENVIRONMENT_VARIABLE[] = "POLYHEDRAL_GRAVITY_BACKEND";
+
+        /** The name of the environment variable specifying the default number of threads */
+        static constexpr char THREADS_ENVIRONMENT_VARIABLE[] = "POLYHEDRAL_GRAVITY_THREADS";
+
+        /**
+         * Returns the backends compiled into this build, the serial CPP backend is always available.
+         * @return the available backends
+         */
+        static std::vector<ParallelizationBackend> availableBackends();
+
+        /**
+         * Checks if the backend is compiled into this build.
+         * @param backend the backend
+         * @return true if the backend is available
+         */
+        static bool isAvailable(ParallelizationBackend backend);
+
+        /**
+         * Returns the process-wide default settings. They are read without a lock, since every parallel call
+         * outside a {@link ParallelizationScope} reads them.
+         * @return the default settings
+         */
+        static ParallelizationSettings getDefault();
+
+        /**
+         * Sets the process-wide default settings. Calls already running are not affected.
+         * A number of threads beyond 2^56 - 1 is clamped.
+         * @param settings the new default settings
+         * @throws std::invalid_argument if the backend is not available
+         */
+        static void setDefault(const ParallelizationSettings &settings);
+
+        /**
+         * Returns the settings the current thread's calls are executed with.
+         * @return the settings of the innermost scope or the default settings
+         */
+        static ParallelizationSettings current();
+
+        /**
+         * Converts a number of threads into the thread limit passed to OpenMP and TBB. The number is clamped to the
+         * hardware threads, as larger numbers cannot be represented as int or would spawn that many OpenMP threads.
+         * @param threads the number of threads, greater than zero
+         * @return the thread limit in [1, number of hardware threads]
+         */
+        static int threadLimit(size_t threads);
+
+        /**
+         * Calls the function with the thrust execution policy of the current settings. The number of threads is
+         * limited for the duration of the call (an OpenMP thread limit or a TBB task arena).
+         * The function is instantiated for every available backend, hence it must be a generic callable.
+         * @tparam Function callable with any thrust host execution policy
+         * @param function the function, e.g. a lambda calling a thrust algorithm with the given policy
+         * @return the function's result
+         */
+        template<typename Function>
+        static auto execute(Function &&function) -> decltype(function(thrust::cpp::par)) {
+            const ParallelizationSettings settings = current();
+            switch (settings.backend) {
+#ifdef POLYHEDRAL_GRAVITY_OMP
+                case ParallelizationBackend::OMP: {
+                    if (settings.threads == 0) {
+                        return function(thrust::omp::par);
+                    }
+                    // The limit applies to the parallel regions started by this thread, it is restored afterward
+                    struct ThreadLimit {
+                        const int previous = omp_get_max_threads();
+                        explicit ThreadLimit(size_t threads) { omp_set_num_threads(threadLimit(threads)); }
+                        ~ThreadLimit() { omp_set_num_threads(previous); }
+                    } threadLimit{settings.threads};
+                    return function(thrust::omp::par);
+                }
+#endif
+#ifdef POLYHEDRAL_GRAVITY_TBB
+                case ParallelizationBackend::TBB: {
+                    if (settings.threads == 0) {
+                        return function(thrust::tbb::par);
+                    }
+                    tbb::task_arena arena{threadLimit(settings.threads)};
+                    return arena.execute([&function]() { return function(thrust::tbb::par); });
+                }
+#endif
+                default:
+                    return function(thrust::cpp::par);
+            }
+        }
+
+    };
+
+    /**
+     * Overrides the parallelization settings for all calls of the current thread during the scope's lifetime,
+     * e.g. to cap the threads of a single evaluation. Scopes can be nested, the innermost one applies.
+     */
+    class ParallelizationScope {
+
+        /** The settings of the enclosing scope, restored by the destructor */
+        const std::optional<ParallelizationSettings> _previous;
+
+    public:
+
+        /**
+         * Overrides the settings of the current thread.
+         * @param settings the settings for the calls within the scope
+         * @throws std::invalid_argument if the backend is not available
+         */
+        explicit ParallelizationScope(const ParallelizationSettings &settings);
+
+        /**
+         * Overrides only the number of threads of the current thread, the backend remains unchanged.
+         * @param threads the maximal number of threads, zero is the backend's default
+         */
+        explicit ParallelizationScope(size_t threads);
+
+        ParallelizationScope(const ParallelizationScope &) = delete;
+
+        ParallelizationScope &operator=(const ParallelizationScope &) = delete;
+
+        /**
+         * Restores the settings of the enclosing scope.
+         */
+        ~ParallelizationScope();
+
+    };
+
+}// namespace polyhedralGravity
@@ -0,0 +1,126 @@
+#include "Pipeline.h"
+
+namespace polyhedralGravity::Pipeline {
+
+    namespace {
+        using Clock = std::chrono::steady_clock;
+
+        double toSeconds(Clock::duration duration) {
+            return std::chrono::duration<double>(duration).count();
+        }
+
+        /**
+         * A chunk of computation points and (after the evaluation stage) their results.
+         * @note This struct is basically a named tuple
+         */
+        struct Chunk {
+            std::vector<Array3> points;
+            std::vector<GravityModelResult> results;
+        };
+    }
+
+    Statistics run(PointSource &pointSource, const GravityEvaluable &evaluable, ResultWriter *resultWriter,
+                   size_t chunkSize, size_t queueCapacity) {
+        if (chunkSize == 0) {
+            throw std::invalid_argument("The chunk size of a pipelined evaluation must be positive.");
+        }
+        POLYHEDRAL_GRAVITY_LOG_DEBUG("Starting the pipeline with chunks of {} points and queues of {} chunks", chunkSize, queueCapacity);
+        const Clock::time_point start = Clock::now();
+        util::BoundedQueue<Chunk> readQueue{queueCapacity};
+        util::BoundedQueue<Chunk> writeQueue{queueCapacity};
+        Statistics statistics{};
+
+        // The first failure of any stage is kept, the queues are closed to stop the other stages
+        std::exception_ptr failure{};
+        std::mutex failureMutex{};
+        const auto fail = [&](std::exception_ptr exception) {
+            {
+                std::lock_guard lock{failureMutex};
+                failure = failure ? failure : std::move(exception);
+            }
+            readQueue.close(true);
+            writeQueue.close(true);
+        };
+
+        std::thread reader{[&]() {
+            StageStatistics &stage = statistics.read;
+            try {
+                while (true) {
+                    const Clock::time_point readStart = Clock::now();
+                    Chunk chunk{};
+                    const size_t count = pointSource.read(chunk.points, chunkSize);
+                    const Clock::time_point readEnd = Clock::now();
+                    stage.busySeconds += toSeconds(readEnd - readStart);
+                    if (count == 0 || !readQueue.push(std::move(chunk))) {
+                        break;
+                    }
+                    stage.waitingSeconds += toSeconds(Clock::now() - readEnd);
+                    stage.points += count;
+                    ++stage.chunks;
+                }
+                readQueue.close();
+            } catch (...) {
+                fail(std::current_exception());
+            }
+        }};
+
+        std::thread writer{[&]() {
+            StageStatistics &stage = statistics.write;
+            try {
+                while (true) {
+                    const Clock::time_point waitStart = Clock::now();
+                    std::optional<Chunk> chunk = writeQueue.pop();
+                    const Clock::time_point writeStart = Clock::now();
+                    stage.waitingSeconds += toSeconds(writeStart - waitStart);
+                    if (!chunk) {
+                        break;
+                    }
+                    if (resultWriter != nullptr) {
+                        resultWriter->write(chunk->points, chunk->results);
+                    }
+                    stage.busySeconds += toSeconds(Clock::now() - writeStart);
+                    stage.points += chunk->points.size();
+                    ++stage.chunks;
+                }
+            } catch (...) {
+                fail(std::current_exception());
+            }
+        }};
+
+        StageStatistics &stage = statistics.evaluate;
+        try {
+            while (true) {
+                const Clock::time_point waitStart = Clock::now();
+                std::optional<Chunk> chunk = readQueue.pop();
+                const Clock::time_point evaluateStart = Clock::now();
+                stage.waitingSeconds += toSeconds(evaluateStart - waitStart);
+                if (!chunk) {
+                    break;
+                }
+                chunk->results = std::get<std::vector<GravityModelResult>>(evaluable(chunk->points, true));
+                const Clock::time_point evaluateEnd = Clock::now();
+                stage.busySeconds += toSeconds(evaluateEnd - evaluateStart);
+                stage.points += chunk->points.size();
+                ++stage.chunks;
+                if (!writeQueue.push(std::move(*chunk))) {
+                    break;
+                }
+                stage.waitingSeconds += toSeconds(Clock::now() - evaluateEnd);
+            }
+            writeQueue.close();
+        } catch (...) {
+            fail(std::current_exception());
+        }
+
+        reader.join();
+        writer.join();
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+        statistics.readQueue = readQueue.occupancy();
+        statistics.writeQueue = writeQueue.occupancy();
+        statistics.totalSeconds = toSeconds(Clock::now() - start);
+        return statistics;
+    }
+
+}// namespace polyhedralGravity::Pipeline
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <chrono>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "GravityEvaluable.h"
+#include "GravityModelData.h"
+#include "PolyhedronDefinitions.h"
+#include "polyhedralGravity/input/PointSource.h"
+#include "polyhedralGravity/output/Logging.h"
+#include "polyhedralGravity/output/ResultWriter.h"
+#include "polyhedralGravity/util/BoundedQueue.h"
+
+/**
+ * Namespace containing the pipelined evaluation of the polyhedral gravity model for a stream of computation points.
+ * Three stages run concurrently and are connected by bounded queues: the reader stage reads chunks of points,
+ * the evaluation stage evaluates them with the parallel backend, and the writer stage writes the results.
+ * Hence, the disk I/O is hidden behind the computation and at most a fixed number of chunks resides in memory.
+ */
+namespace polyhedralGravity::Pipeline {
+
+    /**
+     * The work of one stage of the pipeline.
+     * @note This struct is basically a named tuple
+     */
+    struct StageStatistics {
+        /** The number of points processed */
+        size_t points;
+        /** The number of chunks processed */
+        size_t chunks;
+        /** The time in seconds spent working, i.e. without waiting for the neighbouring stages */
+        double busySeconds;
+        /** The time in seconds spent waiting for the previous (input) or next (output) stage */
+        double waitingSeconds;
+
+        /**
+         * Returns the throughput of the stage while working.
+         * @return the points per second
+         */
+        [[nodiscard]] double throughput() const {
+            return busySeconds > 0.0 ? static_cast<double>(points) / busySeconds : 0.0;
+        }
+    };
+
+    /**
+     * The statistics of a pipelined run. The stage with the lowest throughput limits the run, this is also
+     * visible in the queues: a queue which is mostly full is drained by the limiting stage, a queue which is
+     * mostly empty is filled by it.
+     * @note This struct is basically a named tuple
+     */
+    struct Statistics {
+        /** The reader stage */
+        StageStatistics read;
+        /** The evaluation stage */
+        StageStatistics evaluate;
+        /** The writer stage */
+        StageStatistics write;
+        /** The queue between the reader and the evaluation stage */
+        util::QueueOccupancy readQueue;
+        /** The queue between the evaluation and the writer stage */
+        util::QueueOccupancy writeQueue;
+        /** The wall time of the whole run in seconds */
+        double totalSeconds;
+    };
+
+    /**
+     * Evaluates the gravity model for every point of the source in chunks, overlapping reading, evaluating, and
+     * writing. The reader and writer stages run on their own threads, the evaluation runs on the calling thread
+     * (and in parallel via the backend). The results are written in the order of the points.
+     * If any stage fails, the other stages are stopped and the exception is rethrown.
+     * @param pointSource the source of the computation points
+     * @param evaluable the evaluable of the polyhedron
+     * @param resultWriter the writer of the results, nullptr if the results are discarded
+     * @param chunkSize the maximal number of points per chunk
+     * @param queueCapacity the maximal number of chunks waiting in each of the two queues
+     * @return the statistics of the run
+     * @throws std::invalid_argument if the chunk size is zero
+     * @throws std::exception the first exception thrown by any of the stages
+     */
+    Statistics run(PointSource &pointSource, const GravityEvaluable &evaluable, ResultWriter *resultWriter,
+                   size_t chunkSize, size_t queueCapacity);
+
+}// namespace polyhedralGravity::Pipeline
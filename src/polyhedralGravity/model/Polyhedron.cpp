@@ -2,65 +2,148 @@
 
 namespace polyhedralGravity {
 
-    Polyhedron::Polyhedron(const std::vector<Array3> &vertices,
-                           const std::vector<IndexArray3> &faces, const double density, const NormalOrientation &orientation, const PolyhedronIntegrity &integrity, const MetricUnit& metricUnit)
-        : _vertices{vertices},
-          _faces{faces},
+    namespace {
+        /**
+         * Checks if the indexing of the vertices starts with one, i.e. if the node with index zero is not used.
+         * In this case, the indexing presumably starts mathematically at one.
+         */
+        bool startsWithOne(const std::vector<IndexArray3> &faces) {
+            return faces.end() == std::find_if(faces.begin(), faces.end(), [](const auto &face) {
+                return face[0] == 0 || face[1] == 0 || face[2] == 0;
+            });
+        }
+
+        /** Shifts the indexing of the vertices by -1, so that it starts with zero */
+        void shiftToZero(std::vector<IndexArray3> &faces) {
+            using util::operator-;
+            POLYHEDRAL_GRAVITY_LOG_DEBUG("The indexing of the polyhedron's vertices seems to start at 1 instead of 0. The faces array is modfied accordingly!");
+            std::transform(faces.begin(), faces.end(), faces.begin(), [](const IndexArray3 &face) {return face - 1;});
+        }
+
+        /** Converts the given faces to shared ones, the indexing is shifted in-place before if necessary */
+        std::shared_ptr<const std::vector<IndexArray3>> shareZeroBased(std::vector<IndexArray3> &&faces, VertexIndexing indexing) {
+            if (indexing == VertexIndexing::AUTOMATIC && startsWithOne(faces)) {
+                shiftToZero(faces);
+            }
+            return std::make_shared<const std::vector<IndexArray3>>(std::move(faces));
+        }
+
+        /** Extracts the polyhedral source from the variant, the files are read if necessary */
+        PolyhedralSource toPolyhedralSource(std::variant<PolyhedralSource, PolyhedralFiles> &&polyhedralSource) {
+            if (std::holds_alternative<PolyhedralSource>(polyhedralSource)) {
+                return std::get<PolyhedralSource>(std::move(polyhedralSource));
+            }
+            return MeshReader::getPolyhedralSource(std::get<PolyhedralFiles>(polyhedralSource));
+        }
+
+        /** Returns the permutation which sorts the given keys (stable), i.e. the old index of every new index */
+        std::vector<size_t> sortingPermutation(std::vector<uint64_t> keys) {
+            std::vector<size_t> order(keys.size());
+            std::iota(order.begin(), order.end(), 0);
+            Parallelization::execute([&](const auto &policy) {
+                thrust::stable_sort_by_key(policy, keys.begin(), keys.end(), order.begin());
+            });
+            return order;
+        }
+
+        /** Returns the given permutation composed with a previous one (nullptr is the identity) */
+        std::vector<size_t> composePermutation(std::vector<size_t> order, const std::shared_ptr<const std::vector<size_t>> &previous) {
+            if (previous != nullptr) {
+                std::transform(order.cbegin(), order.cend(), order.begin(), [&previous](size_t index) {
+                    return (*previous)[index];
+                });
+            }
+            return order;
+        }
+
+        /** Materializes a permutation (nullptr is the identity) */
+        std::vector<size_t> materializePermutation(const std::shared_ptr<const std::vector<size_t>> &permutation, size_t size) {
+            if (permutation != nullptr) {
+                return *permutation;
+            }
+            std::vector<size_t> identity(size);
+            std::iota(identity.begin(), identity.end(), 0);
+            return identity;
+        }
+    }
+
+    Polyhedron::Polyhedron(std::vector<Array3> vertices, std::vector<IndexArray3> faces, const double density,
+                           const NormalOrientation &orientation, const PolyhedronIntegrity &integrity, const MetricUnit& metricUnit,
+                           const VertexIndexing &indexing)
+        : Polyhedron{std::make_shared<const std::vector<Array3>>(std::move(vertices)), shareZeroBased(std::move(faces), indexing),
+                     density, orientation, integrity, metricUnit, VertexIndexing::ZERO_BASED} {
+    }
+
+    Polyhedron::Polyhedron(std::shared_ptr<const std::vector<Array3>> vertices, std::shared_ptr<const std::vector<IndexArray3>> faces,
+                           const double density, const NormalOrientation &orientation, const PolyhedronIntegrity &integrity, const MetricUnit& metricUnit,
+                           const VertexIndexing &indexing)
+        : _vertices{std::move(vertices)},
+          _faces{std::move(faces)},
           _density{density},
           _orientation{orientation},
           _metricUnit{metricUnit} {
-        using util::operator-;
+        if (_vertices == nullptr || _faces == nullptr) {
+            throw std::invalid_argument("The vertices and faces of a polyhedron must not be null.");
+        }
         // Checks that the node with index zero is actually used
         // In case it is not used, the indexing presumably starts mathematically at one
-        // In this case, we shift it by -1, so that the indexing start with zero
-        if (_faces.end() == std::find_if(_faces.begin(), _faces.end(), [&](const auto &face) {
-                return face[0] == 0 || face[1] == 0 || face[2] == 0;
-            })) {
-            POLYHEDRAL_GRAVITY_LOG_DEBUG("The indexing of the polyhedron's vertices seems to start at 1 instead of 0. The faces array is modfied accordingly!");
-            std::transform(_faces.begin(), _faces.end(), _faces.begin(), [&](const std::array<size_t, 3> &face) {return face - 1;});
+        // In this case, we shift a copy by -1, so that the indexing start with zero (the shared faces are immutable)
+        if (indexing == VertexIndexing::AUTOMATIC && startsWithOne(*_faces)) {
+            std::vector<IndexArray3> shiftedFaces{*_faces};
+            shiftToZero(shiftedFaces);
+            _faces = std::make_shared<const std::vector<IndexArray3>>(std::move(shiftedFaces));
         }
         this->runIntegrityMeasures(integrity);
     }
 
-    Polyhedron::Polyhedron(const PolyhedralSource &polyhedralSource, const double density, const NormalOrientation &orientation, const PolyhedronIntegrity &integrity, const MetricUnit& metricUnit)
-        : Polyhedron{std::get<std::vector<Array3>>(polyhedralSource), std::get<std::vector<IndexArray3>>(polyhedralSource), density, orientation, integrity, metricUnit} {
+    Polyhedron::Polyhedron(PolyhedralSource polyhedralSource, const double density, const NormalOrientation &orientation, const PolyhedronIntegrity &integrity, const MetricUnit& metricUnit)
+        : Polyhedron{std::move(std::get<std::vector<Array3>>(polyhedralSource)), std::move(std::get<std::vector<IndexArray3>>(polyhedralSource)), density, orientation, integrity, metricUnit} {
     }
 
     Polyhedron::Polyhedron(const PolyhedralFiles &polyhedralFiles, const double density, const NormalOrientation &orientation, const PolyhedronIntegrity &integrity, const MetricUnit& metricUnit)
         : Polyhedron{MeshReader::getPolyhedralSource(polyhedralFiles), density, orientation, integrity, metricUnit} {
     }
 
-    Polyhedron::Polyhedron(const std::variant<PolyhedralSource, PolyhedralFiles> &polyhedralSource, const double density, const NormalOrientation &orientation, const PolyhedronIntegrity &integrity, const MetricUnit& metricUnit)
-        : Polyhedron{std::holds_alternative<PolyhedralSource>(polyhedralSource) ? std::get<PolyhedralSource>(polyhedralSource) : MeshReader::getPolyhedralSource(std::get<PolyhedralFiles>(polyhedralSource)),
-                     density, orientation, integrity, metricUnit} {
+    Polyhedron::Polyhedron(std::variant<PolyhedralSource, PolyhedralFiles> polyhedralSource, const double density, const NormalOrientation &orientation, const PolyhedronIntegrity &integrity, const MetricUnit& metricUnit)
+        : Polyhedron{toPolyhedralSource(std::move(polyhedralSource)), density, orientation, integrity, metricUnit} {
     }
 
     const std::vector<Array3> &Polyhedron::getVertices() const {
+        return *_vertices;
+    }
+
+    const std::shared_ptr<const std::vector<Array3>> &Polyhedron::getSharedVertices() const {
         return _vertices;
     }
 
     const Array3 &Polyhedron::getVertex(size_t index) const {
-        return _vertices[index];
+        return (*_vertices)[index];
     }
 
     size_t Polyhedron::countVertices() const {
-        return _vertices.size();
+        return _vertices->size();
     }
 
     const std::vector<IndexArray3> &Polyhedron::getFaces() const {
+        return *_faces;
+    }
+
+    const std::shared_ptr<const std::vector<IndexArray3>> &Polyhedron::getSharedFaces() const {
         return _faces;
     }
 
     const IndexArray3 &Polyhedron::getFace(size_t index) const {
-        return _faces[index];
+        return (*_faces)[index];
     }
 
     Array3Triplet Polyhedron::getResolvedFace(size_t index) const {
-        return {_vertices[_faces[index][0]], _vertices[_faces[index][1]], _vertices[_faces[index][2]]};
+        const std::vector<Array3> &vertices = *_vertices;
+        const IndexArray3 &face = (*_faces)[index];
+        return {vertices[face[0]], vertices[face[1]], vertices[face[2]]};
     }
 
     size_t Polyhedron::countFaces() const {
-        return _faces.size();
+        return _faces->size();
     }
 
     double Polyhedron::getDensity() const {
@@ -127,27 +210,260 @@ namespace polyhedralGravity {
     }
 
     std::tuple<std::vector<Array3>, std::vector<IndexArray3>, double, NormalOrientation, MetricUnit> Polyhedron::getState() const {
-        return std::make_tuple(_vertices, _faces, _density, _orientation, _metricUnit);
+        return std::make_tuple(*_vertices, *_faces, _density, _orientation, _metricUnit);
+    }
+
+    Polyhedron Polyhedron::reordered(const SpaceFillingCurve &curve) const {
+        const std::vector<Array3> &vertices = *_vertices;
+        const std::vector<IndexArray3> &faces = *_faces;
+        // The points are quantized within the bounding cube of the vertices
+        const util::SpaceFillingCurveGrid grid{vertices.cbegin(), vertices.cend()};
+        const auto curveKey = [&grid, curve](const Array3 &point) {
+            const std::array<uint32_t, 3> cell = grid.cell(point);
+            return curve == SpaceFillingCurve::HILBERT ? util::hilbertKey(cell) : util::mortonKey(cell);
+        };
+
+        // 1. Step: Sort the vertices and remember the new index of every old one
+        std::vector<uint64_t> vertexKeys(vertices.size());
+        Parallelization::execute([&](const auto &policy) {
+            thrust::transform(policy, vertices.cbegin(), vertices.cend(), vertexKeys.begin(), curveKey);
+        });
+        const std::vector<size_t> vertexOrder = sortingPermutation(std::move(vertexKeys));
+        std::vector<Array3> reorderedVertices(vertices.size());
+        std::vector<size_t> newVertexIndex(vertices.size());
+        for (size_t index = 0; index < vertexOrder.size(); ++index) {
+            reorderedVertices[index] = vertices[vertexOrder[index]];
+            newVertexIndex[vertexOrder[index]] = index;
+        }
+
+        // 2. Step: Sort the faces by their centroids and remap their vertex indices
+        std::vector<uint64_t> faceKeys(faces.size());
+        Parallelization::execute([&](const auto &policy) {
+            thrust::transform(policy, faces.cbegin(), faces.cend(), faceKeys.begin(), [&vertices, &curveKey](const IndexArray3 &face) {
+                using namespace util;
+                return curveKey((vertices[face[0]] + vertices[face[1]] + vertices[face[2]]) / 3.0);
+            });
+        });
+        const std::vector<size_t> faceOrder = sortingPermutation(std::move(faceKeys));
+        std::vector<IndexArray3> reorderedFaces(faces.size());
+        std::transform(faceOrder.cbegin(), faceOrder.cend(), reorderedFaces.begin(), [&faces, &newVertexIndex](size_t index) {
+            const IndexArray3 &face = faces[index];
+            return IndexArray3{newVertexIndex[face[0]], newVertexIndex[face[1]], newVertexIndex[face[2]]};
+        });
+
+        // The reordered polyhedron has already been checked (and healed), hence it is no newly constructed one
+        Polyhedron polyhedron{*this};
+        polyhedron._vertices = std::make_shared<const std::vector<Array3>>(std::move(reorderedVertices));
+        polyhedron._faces = std::make_shared<const std::vector<IndexArray3>>(std::move(reorderedFaces));
+        polyhedron._vertexPermutation = std::make_shared<const std::vector<size_t>>(composePermutation(vertexOrder, _vertexPermutation));
+        polyhedron._facePermutation = std::make_shared<const std::vector<size_t>>(composePermutation(faceOrder, _facePermutation));
+        return polyhedron;
     }
 
-    std::pair<NormalOrientation, std::set<size_t>> Polyhedron::checkPlaneUnitNormalOrientation() const {
+    std::vector<size_t> Polyhedron::getVertexPermutation() const {
+        return materializePermutation(_vertexPermutation, this->countVertices());
+    }
+
+    std::vector<size_t> Polyhedron::getFacePermutation() const {
+        return materializePermutation(_facePermutation, this->countFaces());
+    }
+
+    std::pair<NormalOrientation, std::set<size_t>> Polyhedron::checkPlaneUnitNormalOrientation(const OrientationCheckStrategy &strategy) const {
+        switch (strategy) {
+            case OrientationCheckStrategy::TOPOLOGICAL:
+                return this->checkPlaneUnitNormalOrientationByTopology();
+            case OrientationCheckStrategy::RAY_CASTING:
+                return this->checkPlaneUnitNormalOrientationByRayCasting();
+        }
+        throw std::invalid_argument{"The orientation check strategy is not supported!"};
+    }
+
+    MeshTopology Polyhedron::checkMeshTopology() const {
+        std::vector<bool> flipped{};
+        return this->analyzeEdgeAdjacency(flipped);
+    }
+
+    std::pair<NormalOrientation, std::set<size_t>> Polyhedron::checkPlaneUnitNormalOrientationByRayCasting() const {
         // 1. Step: Find all indices of normals which vioate the constraint outwards pointing
         const auto &[polyBegin, polyEnd] = this->transformIterator();
         const size_t n = this->countFaces();
         // Vector contains TRUE if the corrspeonding index VIOLATES the OUTWARDS cirteria
         // Vector contains FALSE if the cooresponding index FULFILLS the OUTWARDS criteria
         thrust::device_vector<bool> violatingBoolOutwards(n, false);
-        thrust::transform(
-                thrust::device,
-                polyBegin,
-                polyEnd,
-                violatingBoolOutwards.begin(),
-                [&](const auto &face) {
-                    // If the ray intersects the polyhedron odd number of times the normal points inwards
-                    // Hence, violating the OUTWARDS constraint
-                    const size_t intersects = this->countRayPolyhedronIntersections(face);
-                    return intersects % 2 != 0;
-                });
+        const RayIntersection::TriangleSoA triangles{*_vertices, *_faces};
+        Parallelization::execute([&](const auto &policy) {
+            thrust::transform(
+                    policy,
+                    polyBegin,
+                    polyEnd,
+                    violatingBoolOutwards.begin(),
+                    [&triangles](const auto &face) {
+                        // If the ray intersects the polyhedron odd number of times the normal points inwards
+                        // Hence, violating the OUTWARDS constraint
+                        const size_t intersects = countRayPolyhedronIntersections(face, triangles);
+                        return intersects % 2 != 0;
+                    });
+        });
+        return majorityOrientation(violatingBoolOutwards);
+    }
+
+    std::pair<NormalOrientation, std::set<size_t>> Polyhedron::checkPlaneUnitNormalOrientationByTopology() const {
+        // 1. Step: Determine the orientation of every face relative to the first face of its component
+        std::vector<bool> flipped{};
+        const MeshTopology topology = this->analyzeEdgeAdjacency(flipped);
+        if (!topology.isClosedManifold()) {
+            POLYHEDRAL_GRAVITY_LOG_DEBUG("The mesh is not a closed manifold ({} open edges, {} non-manifold edges, orientable: {}). "
+                                         "Falling back to ray casting for the orientation check.",
+                                         topology.openEdges.size(), topology.nonManifoldEdges.size(), topology.orientable);
+            return this->checkPlaneUnitNormalOrientationByRayCasting();
+        }
+        const size_t n = this->countFaces();
+        auto countingIterator = thrust::make_counting_iterator<size_t>(0);
+
+        // 2. Step: Settle the global direction of every component
+        // Contains TRUE at a component's index if its non-flipped faces have outwards pointing normals
+        std::vector<bool> componentOutwards(topology.componentCount, true);
+        if (topology.componentCount == 1) {
+            // The signed volume of a closed, consistently oriented mesh is positive if its normals point outwards
+            const double signedVolume = Parallelization::execute([&](const auto &policy) {
+                return thrust::transform_reduce(
+                        policy,
+                        countingIterator,
+                        countingIterator + n,
+                        [&](const size_t index) {
+                            using namespace util;
+                            const Array3Triplet face = this->getResolvedFace(index);
+                            const double volume = dot(face[0], cross(face[1], face[2]));
+                            return flipped[index] ? -volume : volume;
+                        },
+                        0.0, thrust::plus<double>());
+            });
+            componentOutwards[0] = signedVolume > 0.0;
+        } else {
+            // A component might be the inner shell of a cavity whose normals point towards the cavity's center,
+            // hence the direction is settled by a majority vote of a few ray casts per component
+            constexpr size_t RAY_SAMPLES = 3;
+            const RayIntersection::TriangleSoA triangles{*_vertices, *_faces};
+            std::vector<std::vector<size_t>> componentFaces(topology.componentCount);
+            for (size_t index = 0; index < n; ++index) {
+                componentFaces[topology.faceComponents[index]].push_back(index);
+            }
+            for (size_t component = 0; component < topology.componentCount; ++component) {
+                const std::vector<size_t> &faces = componentFaces[component];
+                const size_t samples = std::min(RAY_SAMPLES, faces.size());
+                size_t outwardsVotes = 0;
+                for (size_t sample = 0; sample < samples; ++sample) {
+                    const size_t index = faces[sample * faces.size() / samples];
+                    const bool faceOutwards = countRayPolyhedronIntersections(this->getResolvedFace(index), triangles) % 2 == 0;
+                    // Translate the face's orientation into the orientation of the component's non-flipped faces
+                    outwardsVotes += faceOutwards != flipped[index] ? 1 : 0;
+                }
+                componentOutwards[component] = 2 * outwardsVotes > samples;
+            }
+        }
+
+        // 3. Step: A face violates the OUTWARDS criteria if its orientation relative to its component is
+        // the opposite of the component's outwards orientation
+        thrust::device_vector<bool> violatingBoolOutwards(n, false);
+        for (size_t index = 0; index < n; ++index) {
+            violatingBoolOutwards[index] = componentOutwards[topology.faceComponents[index]] == flipped[index];
+        }
+        return majorityOrientation(violatingBoolOutwards);
+    }
+
+    MeshTopology Polyhedron::analyzeEdgeAdjacency(std::vector<bool> &flipped) const {
+        // An edge of a face, stored with the smaller vertex index first
+        struct FaceEdge {
+            size_t first;
+            size_t second;
+            size_t face;
+            // true if the face traverses the edge from second to first
+            bool reversed;
+        };
+        constexpr size_t UNASSIGNED = std::numeric_limits<size_t>::max();
+        const size_t n = this->countFaces();
+
+        // 1. Step: Collect the three edges of every face and sort them, so that shared edges are adjacent
+        std::vector<FaceEdge> faceEdges(3 * n);
+        auto countingIterator = thrust::make_counting_iterator<size_t>(0);
+        Parallelization::execute([&](const auto &policy) {
+            thrust::for_each(policy, countingIterator, countingIterator + n, [this, &faceEdges](const size_t index) {
+                const IndexArray3 &face = (*_faces)[index];
+                for (size_t k = 0; k < 3; ++k) {
+                    const size_t from = face[k];
+                    const size_t to = face[(k + 1) % 3];
+                    faceEdges[3 * index + k] = {std::min(from, to), std::max(from, to), index, from > to};
+                }
+            });
+        });
+        Parallelization::execute([&](const auto &policy) {
+            thrust::sort(policy, faceEdges.begin(), faceEdges.end(), [](const FaceEdge &lhs, const FaceEdge &rhs) {
+                return std::tie(lhs.first, lhs.second, lhs.face) < std::tie(rhs.first, rhs.second, rhs.face);
+            });
+        });
+
+        // 2. Step: Classify the edges and link the faces sharing a manifold edge
+        // Every face has at most three neighbours, each paired with the information if both faces traverse
+        // the shared edge in the same direction
+        MeshTopology topology{};
+        std::vector<std::array<std::pair<size_t, bool>, 3>> neighbours(n);
+        std::vector<unsigned char> neighbourCount(n, 0);
+        for (size_t begin = 0; begin < faceEdges.size();) {
+            size_t end = begin + 1;
+            while (end < faceEdges.size() && faceEdges[end].first == faceEdges[begin].first &&
+                   faceEdges[end].second == faceEdges[begin].second) {
+                ++end;
+            }
+            const std::pair<size_t, size_t> edge{faceEdges[begin].first, faceEdges[begin].second};
+            if (end - begin == 1) {
+                topology.openEdges.push_back(edge);
+            } else if (end - begin > 2 || faceEdges[begin].face == faceEdges[begin + 1].face) {
+                topology.nonManifoldEdges.push_back(edge);
+            } else {
+                const FaceEdge &lhs = faceEdges[begin];
+                const FaceEdge &rhs = faceEdges[begin + 1];
+                const bool sameDirection = lhs.reversed == rhs.reversed;
+                neighbours[lhs.face][neighbourCount[lhs.face]++] = {rhs.face, sameDirection};
+                neighbours[rhs.face][neighbourCount[rhs.face]++] = {lhs.face, sameDirection};
+            }
+            begin = end;
+        }
+
+        // 3. Step: Flood fill the components and the relative orientation of the faces
+        // Consistently oriented neighbours traverse their shared edge in opposite directions
+        topology.faceComponents.assign(n, UNASSIGNED);
+        topology.componentCount = 0;
+        topology.orientable = true;
+        flipped.assign(n, false);
+        std::queue<size_t> queue{};
+        for (size_t seed = 0; seed < n; ++seed) {
+            if (topology.faceComponents[seed] != UNASSIGNED) {
+                continue;
+            }
+            topology.faceComponents[seed] = topology.componentCount;
+            queue.push(seed);
+            while (!queue.empty()) {
+                const size_t current = queue.front();
+                queue.pop();
+                for (size_t k = 0; k < neighbourCount[current]; ++k) {
+                    const auto &[other, sameDirection] = neighbours[current][k];
+                    const bool otherFlipped = flipped[current] != sameDirection;
+                    if (topology.faceComponents[other] == UNASSIGNED) {
+                        topology.faceComponents[other] = topology.componentCount;
+                        flipped[other] = otherFlipped;
+                        queue.push(other);
+                    } else if (flipped[other] != otherFlipped) {
+                        topology.orientable = false;
+                    }
+                }
+            }
+            ++topology.componentCount;
+        }
+        return topology;
+    }
+
+    std::pair<NormalOrientation, std::set<size_t>> Polyhedron::majorityOrientation(const thrust::device_vector<bool> &violatingBoolOutwards) {
+        const size_t n = violatingBoolOutwards.size();
         const size_t numberOfOutwardsViolations = std::count(violatingBoolOutwards.cbegin(), violatingBoolOutwards.cend(), true);
         // 2. Step: Create a set with only the indices violating the constraint
         std::set<size_t> violatingIndices{};
@@ -178,17 +494,28 @@ namespace polyhedralGravity {
             case PolyhedronIntegrity::AUTOMATIC:
                 POLYHEDRAL_GRAVITY_LOG_WARN("The mesh check is enabled and analyzes the polyhedron for degnerated faces & "
                                             "that all plane unit normals point in the specified direction. This checks requires "
-                                            "a quadratic runtime cost which is most of the time not desirable. "
+                                            "a quadratic runtime cost for meshes which are not closed manifolds. "
                                             "Please explicitly set the integrity_check to either VERIFY, HEAL or DISABLE."
                                             "You can find further details in the documentation!");
             // NO BREAK! AUTOMATIC implies VERIFY, but with a info mesage to explcitly set the option
             case PolyhedronIntegrity::VERIFY:
             // NO BREAK! VERIFY terminates earlier, but does in the beginning the same as HEAL
-            case PolyhedronIntegrity::HEAL:
-                if (!this->checkTrianglesNotDegenerated()) {
+            case PolyhedronIntegrity::HEAL: {
+                // A matching record in the integrity cache replaces the checks
+                const std::optional<uint64_t> cacheKey = IntegrityCache::getDirectory().empty()
+                        ? std::nullopt : std::make_optional(IntegrityCache::hash(*_vertices, *_faces, _orientation));
+                std::optional<IntegrityRecord> record = cacheKey ? IntegrityCache::load(*cacheKey, _faces->size()) : std::nullopt;
+                if (!record) {
+                    record = this->checkIntegrity();
+                    if (cacheKey) {
+                        IntegrityCache::store(*cacheKey, _faces->size(), *record);
+                    }
+                }
+                if (record->degenerated) {
                     throw std::invalid_argument{"At least on triangle in the mesh is degenerated and its surface area equals zero!"};
                 }
-                const auto &[actualOrientation, violatingIndices] = this->checkPlaneUnitNormalOrientation();
+                const auto &actualOrientation = record->actualOrientation;
+                const auto &violatingIndices = record->violatingIndices;
                 if (actualOrientation != _orientation || !violatingIndices.empty()) {
                     std::stringstream sstream{};
                     sstream << "The plane unit normals are not all pointing in the specified direction " << _orientation << '\n';
@@ -210,30 +537,44 @@ namespace polyhedralGravity {
                         this->healPlaneUnitNormalOrientation(actualOrientation, violatingIndices);
                     }
                 }
+            }
         }
     }
 
+    IntegrityRecord Polyhedron::checkIntegrity() const {
+        if (!this->checkTrianglesNotDegenerated()) {
+            return {true, _orientation, {}};
+        }
+        auto [actualOrientation, violatingIndices] = this->checkPlaneUnitNormalOrientation();
+        return {false, actualOrientation, std::move(violatingIndices)};
+    }
+
     bool Polyhedron::checkTrianglesNotDegenerated() const {
         const auto &[begin, end] = this->transformIterator();
         // All triangles surface area needs to be greater than zero
-        return thrust::transform_reduce(
-                thrust::device,
-                begin, end, [](const Array3Triplet &face) {
-                    return util::surfaceArea(face) > 0.0;
-                },
-                true, thrust::logical_and<bool>());
+        return Parallelization::execute([&](const auto &policy) {
+            return thrust::transform_reduce(
+                    policy,
+                    begin, end, [](const Array3Triplet &face) {
+                        return util::surfaceArea(face) > 0.0;
+                    },
+                    true, thrust::logical_and<bool>());
+        });
     }
 
     void Polyhedron::healPlaneUnitNormalOrientation(const NormalOrientation &actualOrientation, const std::set<size_t> &violatingIndices) {
         // Assign the majority plane unit normal orientation
         _orientation = actualOrientation;
         // Fix the vioalting faces by exchaning the vertex ordering (exchaning index 0 with index 1 in the face)
-        std::for_each(violatingIndices.cbegin(), violatingIndices.cend(), [this](size_t i) {
-            std::swap(this->_faces[i][0], this->_faces[i][1]);
+        // The shared faces are immutable, hence a modified copy replaces them
+        std::vector<IndexArray3> healedFaces{*_faces};
+        std::for_each(violatingIndices.cbegin(), violatingIndices.cend(), [&healedFaces](size_t i) {
+            std::swap(healedFaces[i][0], healedFaces[i][1]);
         });
+        _faces = std::make_shared<const std::vector<IndexArray3>>(std::move(healedFaces));
     }
 
-    size_t Polyhedron::countRayPolyhedronIntersections(const Array3Triplet &face) const {
+    size_t Polyhedron::countRayPolyhedronIntersections(const Array3Triplet &face, const RayIntersection::TriangleSoA &triangles) {
         using namespace util;
         // The centroid of the triangular face
         const Array3 centroid = (face[0] + face[1] + face[2]) / 3.0;
@@ -248,48 +589,8 @@ namespace polyhedralGravity {
         const Array3 rayOrigin = centroid + (rayVector * EPSILON_ZERO_OFFSET);
 
         // Count every triangular face which is intersected by the ray
-        const auto &[begin, end] = this->transformIterator();
-        std::set<Array3> intersections{};
-        std::for_each(begin, end, [&rayOrigin, &rayVector, &intersections](const Array3Triplet &otherFace) {
-            const std::unique_ptr<Array3> intersection = rayIntersectsTriangle(rayOrigin, rayVector, otherFace);
-            if (intersection != nullptr) {
-                intersections.insert(*intersection);
-            }
-        });
-        return intersections.size();
-    }
-
-    std::unique_ptr<Array3> Polyhedron::rayIntersectsTriangle(const Array3 &rayOrigin, const Array3 &rayVector, const Array3Triplet &triangle) {
-        // Adapted Möller–Trumbore intersection algorithm
-        // see https://en.wikipedia.org/wiki/Möller–Trumbore_intersection_algorithm
-        using namespace util;
-        const Array3 edge1 = triangle[1] - triangle[0];
-        const Array3 edge2 = triangle[2] - triangle[0];
-        const Array3 h = cross(rayVector, edge2);
-        const double a = dot(edge1, h);
-        if (a > -EPSILON_ZERO_OFFSET && a < EPSILON_ZERO_OFFSET) {
-            return nullptr;
-        }
-
-        const double f = 1.0 / a;
-        const Array3 s = rayOrigin - triangle[0];
-        const double u = f * dot(s, h);
-        if (u < 0.0 || u > 1.0) {
-            return nullptr;
-        }
-
-        const Array3 q = cross(s, edge1);
-        const double v = f * dot(rayVector, q);
-        if (v < 0.0 || u + v > 1.0) {
-            return nullptr;
-        }
-
-        const double t = f * dot(edge2, q);
-        if (t > EPSILON_ZERO_OFFSET) {
-            return std::make_unique<Array3>(rayOrigin + rayVector * t);
-        } else {
-            return nullptr;
-        }
+        thread_local std::vector<double> intersections{};
+        return RayIntersection::countIntersections(rayOrigin, rayVector, triangles, intersections);
     }
 
 }// namespace polyhedralGravity
\ No newline at end of file
@@ -2,21 +2,30 @@
 
 #include "polyhedralGravity/input/MeshReader.h"
 #include "polyhedralGravity/model/GravityModelData.h"
+#include "polyhedralGravity/model/Parallelization.h"
 #include "polyhedralGravity/model/PolyhedronDefinitions.h"
+#include "polyhedralGravity/model/IntegrityCache.h"
+#include "polyhedralGravity/model/RayIntersection.h"
 #include "polyhedralGravity/output/Logging.h"
 #include "polyhedralGravity/util/UtilityConstants.h"
 #include "polyhedralGravity/util/UtilityContainer.h"
 #include "polyhedralGravity/util/UtilityFloatArithmetic.h"
+#include "polyhedralGravity/util/UtilitySpaceFillingCurve.h"
 #include "thrust/copy.h"
 #include "thrust/device_vector.h"
 #include "thrust/execution_policy.h"
 #include "thrust/iterator/counting_iterator.h"
 #include "thrust/iterator/transform_iterator.h"
+#include "thrust/sort.h"
+#include "thrust/transform.h"
 #include "thrust/transform_reduce.h"
 #include <algorithm>
 #include <array>
 #include <exception>
+#include <limits>
 #include <memory>
+#include <optional>
+#include <queue>
 #include <set>
 #include <sstream>
 #include <stdexcept>
@@ -42,8 +51,9 @@ namespace polyhedralGravity {
          * Each node is an array of size three containing the xyz coordinates.
          * The mesh must be scaled in the same units as the density is given
          * (the unit must match to the mesh, e.g., mesh in @f$[m]@f$ requires density in @f$[kg/m^3]@f$)
+         * The vector is immutable, hence copies of a Polyhedron (e.g. the one of a GravityEvaluable) share it.
          */
-        const std::vector<Array3> _vertices;
+        std::shared_ptr<const std::vector<Array3>> _vertices;
 
         /**
          * A vector containing the faces (triangles) of the polyhedron.
@@ -51,8 +61,9 @@ namespace polyhedralGravity {
          * Since every face consists of three nodes, every face consists of three segments. Each segment consists of
          * two nodes.
          * For example, a face consisting of {1, 2, 3} --> segments: {1, 2}, {2, 3}, {3, 1}
+         * The vector is immutable and shared like the vertices, healing the mesh replaces it by a modified copy.
          */
-        std::vector<IndexArray3> _faces;
+        std::shared_ptr<const std::vector<IndexArray3>> _faces;
 
         /** The constant density of the polyhedron (the unit must match to the mesh, e.g., mesh in @f$[m]@f$ requires density in @f$[kg/m^3]@f$) */
         double _density;
@@ -69,10 +80,23 @@ namespace polyhedralGravity {
         /** Metric Unit of the Vertices Coordinates. One of METER, KILOMETER, or UNITLESS */
         const MetricUnit _metricUnit;
 
+        /**
+         * Maps the index of every vertex to its index in the input of the polyhedron.
+         * Only set if the polyhedron was {@link reordered}, otherwise the identity.
+         */
+        std::shared_ptr<const std::vector<size_t>> _vertexPermutation{};
+
+        /**
+         * Maps the index of every face to its index in the input of the polyhedron.
+         * Only set if the polyhedron was {@link reordered}, otherwise the identity.
+         */
+        std::shared_ptr<const std::vector<size_t>> _facePermutation{};
+
     public:
         /**
          * Generates a polyhedron from nodes and faces.
-         * If the indexing of the polyhedron's vertices in the faces' array starts with one, it is shifted so that it starts with zero.
+         * If the indexing of the polyhedron's vertices in the faces' array starts with one, it is shifted so that it starts with zero
+         * (unless the indexing is ZERO_BASED).
          * @param vertices a vector of nodes
          * @param faces a vector of faces containing the formation of faces off vertices
          * @param density the density of the polyhedron in @f$[kg/X^3]@f$.
@@ -80,16 +104,43 @@ namespace polyhedralGravity {
          * @param orientation specify if the plane unit normals point outwards or inwards (default: OUTWARDS)
          * @param integrity specify if the mesh input is checked/ healed to fulfill the constraints of Tsoulis' algorithm (see {@link PolyhedronIntegrity})
          * @param metricUnit specify the mesh's coordinate scale's unit. Can be kilometer, meter, or unitless (defaults to meter)
+         * @param indexing specify if the indexing of the vertices is detected or known to start with zero (see {@link VertexIndexing})
          *
          * @throws std::invalid_argument depending on the {@link integrity} flag
          */
         Polyhedron(
-                const std::vector<Array3> &vertices,
-                const std::vector<IndexArray3> &faces,
+                std::vector<Array3> vertices,
+                std::vector<IndexArray3> faces,
                 double density,
                 const NormalOrientation &orientation = NormalOrientation::OUTWARDS,
                 const PolyhedronIntegrity &integrity = PolyhedronIntegrity::AUTOMATIC,
-                const MetricUnit &metricUnit = MetricUnit::METER
+                const MetricUnit &metricUnit = MetricUnit::METER,
+                const VertexIndexing &indexing = VertexIndexing::AUTOMATIC
+                );
+
+        /**
+         * Generates a polyhedron from shared, immutable vectors of nodes and faces, e.g. the ones of another polyhedron
+         * (see {@link getSharedVertices} and {@link getSharedFaces}). The vectors are not copied, unless the faces
+         * need to be modified (i.e. shifted to start with zero, unless the indexing is ZERO_BASED, or healed).
+         * @param vertices the shared vector of nodes
+         * @param faces the shared vector of faces containing the formation of faces off vertices
+         * @param density the density of the polyhedron in @f$[kg/X^3]@f$.
+         *          It must match the unit of the mesh, e.g., mesh in @f$[m]@f$ requires density in @f$[kg/m^3]@f$)
+         * @param orientation specify if the plane unit normals point outwards or inwards (default: OUTWARDS)
+         * @param integrity specify if the mesh input is checked/ healed to fulfill the constraints of Tsoulis' algorithm (see {@link PolyhedronIntegrity})
+         * @param metricUnit specify the mesh's coordinate scale's unit. Can be kilometer, meter, or unitless (defaults to meter)
+         * @param indexing specify if the indexing of the vertices is detected or known to start with zero (see {@link VertexIndexing})
+         *
+         * @throws std::invalid_argument depending on the {@link integrity} flag
+         */
+        Polyhedron(
+                std::shared_ptr<const std::vector<Array3>> vertices,
+                std::shared_ptr<const std::vector<IndexArray3>> faces,
+                double density,
+                const NormalOrientation &orientation = NormalOrientation::OUTWARDS,
+                const PolyhedronIntegrity &integrity = PolyhedronIntegrity::AUTOMATIC,
+                const MetricUnit &metricUnit = MetricUnit::METER,
+                const VertexIndexing &indexing = VertexIndexing::AUTOMATIC
                 );
 
         /**
@@ -105,7 +156,7 @@ namespace polyhedralGravity {
          * @throws std::invalid_argument depending on the {@link integrity} flag
          */
         Polyhedron(
-                const PolyhedralSource &polyhedralSource,
+                PolyhedralSource polyhedralSource,
                 double density,
                 const NormalOrientation &orientation = NormalOrientation::OUTWARDS,
                 const PolyhedronIntegrity &integrity = PolyhedronIntegrity::AUTOMATIC,
@@ -143,7 +194,7 @@ namespace polyhedralGravity {
          *
          * @throws std::invalid_argument depending on the {@link integrity} flag
          */
-        Polyhedron(const std::variant<PolyhedralSource, PolyhedralFiles> &polyhedralSource, double density,
+        Polyhedron(std::variant<PolyhedralSource, PolyhedralFiles> polyhedralSource, double density,
                    const NormalOrientation &orientation = NormalOrientation::OUTWARDS,
                    const PolyhedronIntegrity &integrity = PolyhedronIntegrity::AUTOMATIC,
                    const MetricUnit &metricUnit = MetricUnit::METER
@@ -160,6 +211,13 @@ namespace polyhedralGravity {
          */
         [[nodiscard]] const std::vector<Array3> &getVertices() const;
 
+        /**
+         * Returns the shared, immutable vertices of this polyhedron, e.g. for constructing another polyhedron
+         * of the same mesh without copying it.
+         * @return shared vector of cartesian coordinates
+         */
+        [[nodiscard]] const std::shared_ptr<const std::vector<Array3>> &getSharedVertices() const;
+
         /**
          * Returns the vertex at a specific index
          * @param index size_t
@@ -179,6 +237,12 @@ namespace polyhedralGravity {
          */
         [[nodiscard]] const std::vector<IndexArray3> &getFaces() const;
 
+        /**
+         * Returns the shared, immutable faces of this polyhedron (see {@link getSharedVertices}).
+         * @return shared vector of triangular faces
+         */
+        [[nodiscard]] const std::shared_ptr<const std::vector<IndexArray3>> &getSharedFaces() const;
+
         /**
          * Returns the indices of the vertices making up the face at the given index.
          * @param index size_t
@@ -269,6 +333,34 @@ namespace polyhedralGravity {
          */
         [[nodiscard]] std::tuple<std::vector<Array3>, std::vector<IndexArray3>, double, NormalOrientation, MetricUnit> getState() const;
 
+        /**
+         * Returns a copy of this polyhedron whose vertices and faces are sorted along a space-filling curve
+         * (the face indices are remapped accordingly). Consecutive faces then reference nearby vertices,
+         * so that the vertex gathers of the evaluation hit the CPU caches, and consecutive blocks of faces are
+         * spatially coherent. The faces are sorted by their centroids.
+         * The order of the vertices within a face (and hence the orientation) is preserved.
+         * The mapping to the original order is kept, see {@link getVertexPermutation} and {@link getFacePermutation}.
+         * Runtime Cost: @f$O(n \log n)@f$
+         *
+         * @param curve the space-filling curve (default: HILBERT)
+         * @return the reordered polyhedron
+         */
+        [[nodiscard]] Polyhedron reordered(const SpaceFillingCurve &curve = SpaceFillingCurve::HILBERT) const;
+
+        /**
+         * Returns for every vertex its index in the input of the polyhedron, i.e. the identity unless
+         * the polyhedron was {@link reordered}.
+         * @return the original index of every vertex
+         */
+        [[nodiscard]] std::vector<size_t> getVertexPermutation() const;
+
+        /**
+         * Returns for every face its index in the input of the polyhedron, i.e. the identity unless
+         * the polyhedron was {@link reordered}. This allows reporting results per face in the original order.
+         * @return the original index of every face
+         */
+        [[nodiscard]] std::vector<size_t> getFacePermutation() const;
+
         /**
          * An iterator transforming the polyhedron's coordinates on demand by a given offset.
          * This function returns a pair of transform iterators (first = begin(), second = end()).
@@ -292,14 +384,27 @@ namespace polyhedralGravity {
          * violate the majority constraint and need to be adapted.
          * Hence, if the set is empty, all faces obey to the returned ordering/ plane unit normal orientation.
          *
+         * @param strategy the strategy to determine the orientation (see {@link OrientationCheckStrategy}),
+         *  the TOPOLOGICAL strategy falls back to RAY_CASTING for open or non-manifold meshes
          * @return a pair consisting of majority ordering (OUTWARDS or INWARDS pointing normals)
          *  and a set of face indices which violate the constraint
          */
-        [[nodiscard]] std::pair<NormalOrientation, std::set<size_t>> checkPlaneUnitNormalOrientation() const;
+        [[nodiscard]] std::pair<NormalOrientation, std::set<size_t>> checkPlaneUnitNormalOrientation(
+                const OrientationCheckStrategy &strategy = OrientationCheckStrategy::TOPOLOGICAL) const;
+
+        /**
+         * Analyzes the edge adjacency of the polyhedron's mesh. Reports the open edges, the non-manifold edges,
+         * the connected components and whether the faces can be oriented consistently.
+         * Runtime Cost: @f$O(n \log n)@f$
+         *
+         * @return the topology of the mesh
+         */
+        [[nodiscard]] MeshTopology checkMeshTopology() const;
 
     private:
         /**
          * Checks the integrity of the polyhedron depending on the integrity flag.
+         * If the {@link IntegrityCache} is enabled, the outcome of the checks is loaded from or stored to the cache.
          *
          * @param integrity the behavior depends on the value, see {@link PolyhedronIntegrity}
          *
@@ -307,6 +412,14 @@ namespace polyhedralGravity {
          */
         void runIntegrityMeasures(const PolyhedronIntegrity &integrity);
 
+        /**
+         * Runs the degeneracy and the orientation check on the polyhedron.
+         * The orientation check is skipped if a triangle is degenerated.
+         *
+         * @return the outcome of the checks
+         */
+        [[nodiscard]] IntegrityRecord checkIntegrity() const;
+
 
         /**
          * Checks if no triangle is degenerated by checking the surface area being greater than zero.
@@ -316,31 +429,59 @@ namespace polyhedralGravity {
         [[nodiscard]] bool checkTrianglesNotDegenerated() const;
 
         /**
-         * Fixes the orientation of the plane unit normals for a given set of violating face indices.
+         * Determines the orientation of every plane unit normal by casting one ray per face.
+         * Runtime Cost: @f$O(n^2)@f$
          *
-         * @param actualOrientation The desired plane unit normal orientation.
-         * @param violatingIndices A set of indices representing the faces with violating orientations.
+         * @return a pair consisting of majority ordering (OUTWARDS or INWARDS pointing normals)
+         *  and a set of face indices which violate the constraint
          */
-        void healPlaneUnitNormalOrientation(const NormalOrientation &actualOrientation, const std::set<size_t> &violatingIndices);
+        [[nodiscard]] std::pair<NormalOrientation, std::set<size_t>> checkPlaneUnitNormalOrientationByRayCasting() const;
 
         /**
-         * Calculates how often a vector starting at a specific origin intersects a polyhedron's mesh's triangles.
-         * @param face the vector describing the ray
-         * @return true if the ray intersects the triangle
+         * Determines the orientation of every plane unit normal by flood filling the relative orientation
+         * over the shared edges and resolving the global direction once per connected component.
+         * Falls back to {@link checkPlaneUnitNormalOrientationByRayCasting} if the mesh is not a closed manifold.
+         *
+         * @return a pair consisting of majority ordering (OUTWARDS or INWARDS pointing normals)
+         *  and a set of face indices which violate the constraint
+         */
+        [[nodiscard]] std::pair<NormalOrientation, std::set<size_t>> checkPlaneUnitNormalOrientationByTopology() const;
+
+        /**
+         * Builds the edge adjacency of the faces and flood fills the relative orientation of the faces.
+         * @param flipped is resized to the number of faces and contains true at an index if the face's vertex ordering
+         *  is reversed compared to the first face of its component
+         * @return the topology of the mesh
          */
-        [[nodiscard]] size_t countRayPolyhedronIntersections(const Array3Triplet &face) const;
+        [[nodiscard]] MeshTopology analyzeEdgeAdjacency(std::vector<bool> &flipped) const;
 
         /**
-         * Calculates how often a vector starting at a specific origin intersects a triangular face.
-         * Uses the Möller–Trumbore intersection algorithm.
-         * @param rayOrigin the origin of the ray
-         * @param rayVector the vector describing the ray
-         * @param triangle a triangular face
-         * @return intersection point or null
+         * Computes the majority orientation and the violating face indices given the faces which violate the
+         * OUTWARDS pointing criteria.
+         * @param violatingBoolOutwards contains true at an index if the corresponding face's normal points inwards
+         * @return a pair consisting of majority ordering (OUTWARDS or INWARDS pointing normals)
+         *  and a set of face indices which violate the constraint
+         */
+        [[nodiscard]] static std::pair<NormalOrientation, std::set<size_t>> majorityOrientation(
+                const thrust::device_vector<bool> &violatingBoolOutwards);
+
+        /**
+         * Fixes the orientation of the plane unit normals for a given set of violating face indices.
          *
-         * @see Adapted from https://en.wikipedia.org/wiki/Möller–Trumbore_intersection_algorithm
+         * @param actualOrientation The desired plane unit normal orientation.
+         * @param violatingIndices A set of indices representing the faces with violating orientations.
+         */
+        void healPlaneUnitNormalOrientation(const NormalOrientation &actualOrientation, const std::set<size_t> &violatingIndices);
+
+        /**
+         * Calculates how often a ray starting slightly above the centroid of a face in direction of its
+         * plane unit normal intersects the polyhedron's mesh's triangles.
+         * Every thread reuses its own intersection buffer, hence the check does not allocate per ray.
+         * @param face the face emitting the ray
+         * @param triangles the polyhedron's triangles prepared for the batched Möller–Trumbore test
+         * @return the number of distinct intersections
          */
-        static std::unique_ptr<Array3> rayIntersectsTriangle(const Array3 &rayOrigin, const Array3 &rayVector, const Array3Triplet &triangle);
+        [[nodiscard]] static size_t countRayPolyhedronIntersections(const Array3Triplet &face, const RayIntersection::TriangleSoA &triangles);
 
 
     };
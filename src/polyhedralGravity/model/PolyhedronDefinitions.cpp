@@ -32,6 +32,24 @@ namespace polyhedralGravity {
         return os;
     }
 
+    std::ostream &operator<<(std::ostream &os, const MeshStorage &storage) {
+        switch (storage) {
+            case MeshStorage::DOUBLE:
+                os << "DOUBLE";
+            break;
+            case MeshStorage::COMPACT:
+                os << "COMPACT";
+            break;
+            case MeshStorage::COMPACT_FLOAT32:
+                os << "COMPACT_FLOAT32";
+            break;
+            default:
+                os << "Unknown";
+            break;
+        }
+        return os;
+    }
+
     MetricUnit readMetricUnit(const std::string &unit) {
         if (unit == "m") {
             return MetricUnit::METER;
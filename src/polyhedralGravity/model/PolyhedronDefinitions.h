@@ -1,9 +1,11 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <ostream>
 
 namespace polyhedralGravity {
@@ -18,6 +20,21 @@ namespace polyhedralGravity {
      */
     using IndexArray3 = std::array<size_t, 3>;
 
+    /**
+     * Alias for an array of size 3 (uint32_t) for the vertex indices in a triangular face in compact storage.
+     */
+    using CompactIndexArray3 = std::array<uint32_t, 3>;
+
+    /**
+     * Alias for an array of size 3 (float) for x, y, z coordinates in single precision storage.
+     */
+    using Float3 = std::array<float, 3>;
+
+    /**
+     * Alias for a triplet of arrays of size 3 (float) in single precision storage.
+     */
+    using Float3Triplet = std::array<Float3, 3>;
+
     /**
      * Alias for an array of size 6 for xx, yy, zz, xy, xz, yz second derivatives.
      */
@@ -90,23 +107,155 @@ namespace polyhedralGravity {
         /**
          * Only verification of the NormalOrientation.
          * A misalignment (e.g., specified OUTWARDS, but is not) leads to a runtime_error.
-         * Runtime Cost @f$O(n^2)@f$
+         * Runtime Cost @f$O(n \log n)@f$ for closed manifold meshes, otherwise @f$O(n^2)@f$
+         * (see {@link OrientationCheckStrategy})
          */
         VERIFY,
         /**
          * Like VERIFY, but also informs the user about the option in any case on the runtime costs.
          * This is the implicit default option.
-         * Runtime Cost: @f$O(n^2)@f$ and output to stdout in every case!
+         * Runtime Cost: like VERIFY and output to stdout in every case!
          */
         AUTOMATIC,
         /**
          * Verification and Automatic Healing of the NormalOrientation.
          * A misalignment does not lead to a runtime_error, but to an internal correction.
-         * Runtime Cost: @f$O(n^2)@f$ and a modification of the mesh input!
+         * Runtime Cost: like VERIFY and a modification of the mesh input!
          */
         HEAL,
     };
 
+    /**
+     * The indexing of the vertices in the faces given to the constructor of a {@link Polyhedron}.
+     */
+    enum class VertexIndexing : char {
+        /**
+         * The indexing starts with one if no face refers to the vertex with index zero,
+         * in this case it is shifted so that it starts with zero. This is the default for user input.
+         */
+        AUTOMATIC,
+        /**
+         * The indexing starts with zero, even if the vertex with index zero is unreferenced.
+         * Used for restoring already constructed polyhedra, e.g. {@link Polyhedron::reordered} ones.
+         */
+        ZERO_BASED,
+    };
+
+    /**
+     * The strategy used to determine the orientation of the plane unit normals of a {@link Polyhedron}.
+     * This enum is utilized in {@link Polyhedron::checkPlaneUnitNormalOrientation} and thereby also
+     * by the {@link PolyhedronIntegrity} checks during construction.
+     */
+    enum class OrientationCheckStrategy : char {
+        /**
+         * Flood fill over the shared edges of the mesh. Neighbouring faces must traverse their shared edge
+         * in opposite directions, so the relative orientation of all faces follows from the edge adjacency.
+         * The global direction is settled with one signed volume test (single component)
+         * or a few ray casts per component (multiple components).
+         * Non-manifold or open meshes fall back to {@link RAY_CASTING}.
+         * Runtime Cost: @f$O(n \log n)@f$ for closed manifold meshes
+         */
+        TOPOLOGICAL,
+        /**
+         * Casts one ray per face and counts the intersections with the polyhedron (Möller–Trumbore).
+         * Runtime Cost: @f$O(n^2)@f$
+         */
+        RAY_CASTING,
+    };
+
+    /**
+     * The space-filling curve along which {@link Polyhedron::reordered} sorts the vertices and faces of a polyhedron.
+     * Points close to each other along the curve are close to each other in space, hence consecutive faces
+     * reference nearby vertices and consecutive blocks of faces are spatially coherent.
+     */
+    enum class SpaceFillingCurve : char {
+        /**
+         * The Morton (Z-order) curve, which interleaves the bits of the quantized coordinates.
+         * Cheapest to compute, but with jumps between the octants.
+         */
+        MORTON,
+        /**
+         * The Hilbert curve, whose consecutive cells are always neighbours.
+         * Better locality than the Morton curve.
+         */
+        HILBERT,
+    };
+
+    /**
+     * Contains the result of the edge adjacency analysis of a polyhedral mesh.
+     * A mesh is a closed manifold if every edge is shared by exactly two faces and
+     * the faces can be oriented consistently.
+     * @note This struct is basically a named tuple
+     */
+    struct MeshTopology {
+        /**
+         * The edges (as pair of vertex indices) which are only part of one face, i.e., the boundary of a hole
+         */
+        std::vector<std::pair<size_t, size_t>> openEdges;
+        /**
+         * The edges (as pair of vertex indices) which are shared by more than two faces
+         */
+        std::vector<std::pair<size_t, size_t>> nonManifoldEdges;
+        /**
+         * The index of the connected component each face belongs to (faces are connected via their shared edges)
+         */
+        std::vector<size_t> faceComponents;
+        /**
+         * The number of disconnected components of the mesh
+         */
+        size_t componentCount;
+        /**
+         * True if the faces could be oriented consistently by flood filling over the shared edges
+         */
+        bool orientable;
+
+        /**
+         * Returns true if the mesh has no open or non-manifold edges and is consistently orientable.
+         * @return true if the mesh is a closed manifold
+         */
+        [[nodiscard]] bool isClosedManifold() const {
+            return openEdges.empty() && nonManifoldEdges.empty() && orientable;
+        }
+    };
+
+    /**
+     * The storage of the per-face data a {@link GravityEvaluable} caches for its evaluations
+     * (in addition to the vertices and faces of its polyhedron).
+     * The compact modes trade a little recomputation during the evaluation for less memory per face,
+     * so that larger meshes fit into the CPU caches and more polyhedra fit into memory.
+     * The polyhedron's faces with 64-bit vertex indices (24 bytes per face) are retained in every mode, the totals
+     * below include them. In the compact modes, the evaluation reads the 32-bit copy instead of the retained faces.
+     */
+    enum class MeshStorage : char {
+        /**
+         * Double precision segment vectors, plane unit normals, and segment unit normals. The evaluation reads the
+         * 64-bit vertex indices of the polyhedron's faces.
+         * Memory: 168 bytes per face (192 bytes per face including the polyhedron's faces)
+         */
+        DOUBLE,
+        /**
+         * 32-bit vertex indices and double precision unit normals. The segment vectors are recomputed from the
+         * vertices during the evaluation, hence the results are identical to {@link DOUBLE}.
+         * Memory: 108 bytes per face (132 bytes per face including the polyhedron's faces)
+         */
+        COMPACT,
+        /**
+         * Like {@link COMPACT}, but the unit normals are stored in single precision and widened to double precision
+         * right before they enter the evaluation of a face. The vertices remain in double precision, as the evaluation
+         * subtracts the computation point from them. The relative error of the results is in the order of 1e-7.
+         * Memory: 60 bytes per face (84 bytes per face including the polyhedron's faces)
+         */
+        COMPACT_FLOAT32,
+    };
+
+    /**
+     * Stream operator for the MeshStorage enum. Prints the enum to a human-readable string.
+     * @param os The output stream to write the string representation to.
+     * @param storage the storage to print
+     * @return The output stream after writing the string representation.
+     */
+    std::ostream &operator<<(std::ostream &os, const MeshStorage &storage);
+
     /**
      * Represents the unit of a polyhedron's mesh.
      */
@@ -0,0 +1,130 @@
+#include "RayIntersection.h"
+
+namespace polyhedralGravity::RayIntersection {
+
+    TriangleSoA::TriangleSoA(const std::vector<Array3> &vertices, const std::vector<IndexArray3> &faces) :
+        vertexX(faces.size()), vertexY(faces.size()), vertexZ(faces.size()),
+        edge1X(faces.size()), edge1Y(faces.size()), edge1Z(faces.size()),
+        edge2X(faces.size()), edge2Y(faces.size()), edge2Z(faces.size()) {
+        auto countingIterator = thrust::make_counting_iterator<size_t>(0);
+        Parallelization::execute([&](const auto &policy) {
+            thrust::for_each(policy, countingIterator, countingIterator + faces.size(), [&](const size_t index) {
+                using namespace util;
+                const IndexArray3 &face = faces[index];
+                const Array3 &vertex = vertices[face[0]];
+                const Array3 edge1 = vertices[face[1]] - vertex;
+                const Array3 edge2 = vertices[face[2]] - vertex;
+                vertexX[index] = vertex[0];
+                vertexY[index] = vertex[1];
+                vertexZ[index] = vertex[2];
+                edge1X[index] = edge1[0];
+                edge1Y[index] = edge1[1];
+                edge1Z[index] = edge1[2];
+                edge2X[index] = edge2[0];
+                edge2Y[index] = edge2[1];
+                edge2Z[index] = edge2[2];
+            });
+        });
+    }
+
+    size_t intersectRay(const Array3 &rayOrigin, const Array3 &rayVector, const TriangleSoA &triangles,
+                        std::vector<double> &hits) {
+        // Adapted Möller–Trumbore intersection algorithm for batches of triangles
+        // see https://en.wikipedia.org/wiki/Möller–Trumbore_intersection_algorithm
+        using Batch = xsimd::batch<double>;
+        constexpr size_t LANES = Batch::size;
+        hits.clear();
+        const size_t n = triangles.size();
+        const size_t simdEnd = n - n % LANES;
+
+        const Batch dx{rayVector[0]}, dy{rayVector[1]}, dz{rayVector[2]};
+        const Batch ox{rayOrigin[0]}, oy{rayOrigin[1]}, oz{rayOrigin[2]};
+        const Batch epsilon{util::EPSILON_ZERO_OFFSET}, zero{0.0}, one{1.0};
+        std::array<double, LANES> distances{};
+
+        for (size_t i = 0; i < simdEnd; i += LANES) {
+            const Batch e1x = Batch::load_unaligned(&triangles.edge1X[i]);
+            const Batch e1y = Batch::load_unaligned(&triangles.edge1Y[i]);
+            const Batch e1z = Batch::load_unaligned(&triangles.edge1Z[i]);
+            const Batch e2x = Batch::load_unaligned(&triangles.edge2X[i]);
+            const Batch e2y = Batch::load_unaligned(&triangles.edge2Y[i]);
+            const Batch e2z = Batch::load_unaligned(&triangles.edge2Z[i]);
+
+            // h = rayVector x edge2, a = edge1 * h
+            const Batch hx = dy * e2z - dz * e2y;
+            const Batch hy = dz * e2x - dx * e2z;
+            const Batch hz = dx * e2y - dy * e2x;
+            const Batch a = e1x * hx + e1y * hy + e1z * hz;
+            const Batch f = one / a;
+
+            // s = rayOrigin - vertex, u = f * (s * h)
+            const Batch sx = ox - Batch::load_unaligned(&triangles.vertexX[i]);
+            const Batch sy = oy - Batch::load_unaligned(&triangles.vertexY[i]);
+            const Batch sz = oz - Batch::load_unaligned(&triangles.vertexZ[i]);
+            const Batch u = f * (sx * hx + sy * hy + sz * hz);
+
+            // q = s x edge1, v = f * (rayVector * q), t = f * (edge2 * q)
+            const Batch qx = sy * e1z - sz * e1y;
+            const Batch qy = sz * e1x - sx * e1z;
+            const Batch qz = sx * e1y - sy * e1x;
+            const Batch v = f * (dx * qx + dy * qy + dz * qz);
+            const Batch t = f * (e2x * qx + e2y * qy + e2z * qz);
+
+            // Lanes with a parallel ray (a close to zero) might contain NaN/ Inf, but are masked out
+            const auto hit = (xsimd::abs(a) >= epsilon) & (u >= zero) & (u <= one) &
+                             (v >= zero) & (u + v <= one) & (t > epsilon);
+            if (xsimd::any(hit)) {
+                // Only hits have a positive distance after the selection
+                xsimd::select(hit, t, zero).store_unaligned(distances.data());
+                std::copy_if(distances.cbegin(), distances.cend(), std::back_inserter(hits),
+                             [](const double distance) { return distance > 0.0; });
+            }
+        }
+
+        for (size_t i = simdEnd; i < n; ++i) {
+            const double distance = intersectTriangle(rayOrigin, rayVector, triangles, i);
+            if (distance > 0.0) {
+                hits.push_back(distance);
+            }
+        }
+        return hits.size();
+    }
+
+    size_t countIntersections(const Array3 &rayOrigin, const Array3 &rayVector, const TriangleSoA &triangles,
+                              std::vector<double> &hits) {
+        intersectRay(rayOrigin, rayVector, triangles, hits);
+        // Equal distances along the same ray refer to the same intersection point
+        std::sort(hits.begin(), hits.end());
+        hits.erase(std::unique(hits.begin(), hits.end()), hits.end());
+        return hits.size();
+    }
+
+    double intersectTriangle(const Array3 &rayOrigin, const Array3 &rayVector, const TriangleSoA &triangles,
+                             size_t index) {
+        using namespace util;
+        const Array3 edge1{triangles.edge1X[index], triangles.edge1Y[index], triangles.edge1Z[index]};
+        const Array3 edge2{triangles.edge2X[index], triangles.edge2Y[index], triangles.edge2Z[index]};
+        const Array3 h = cross(rayVector, edge2);
+        const double a = dot(edge1, h);
+        if (a > -EPSILON_ZERO_OFFSET && a < EPSILON_ZERO_OFFSET) {
+            return 0.0;
+        }
+
+        const double f = 1.0 / a;
+        const Array3 s = rayOrigin - Array3{triangles.vertexX[index], triangles.vertexY[index], triangles.vertexZ[index]};
+        const double u = f * dot(s, h);
+        if (u < 0.0 || u > 1.0) {
+            return 0.0;
+        }
+
+        const Array3 q = cross(s, edge1);
+        const double v = f * dot(rayVector, q);
+        if (v < 0.0 || u + v > 1.0) {
+            return 0.0;
+        }
+
+        const double t = f * dot(edge2, q);
+        return t > EPSILON_ZERO_OFFSET ? t : 0.0;
+    }
+
+}// namespace polyhedralGravity::RayIntersection
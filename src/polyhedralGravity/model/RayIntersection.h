@@ -0,0 +1,95 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+
+#include "thrust/iterator/counting_iterator.h"
+#include "thrust/for_each.h"
+#include "thrust/execution_policy.h"
+#include "xsimd/xsimd.hpp"
+
+#include "Parallelization.h"
+#include "PolyhedronDefinitions.h"
+#include "polyhedralGravity/util/UtilityContainer.h"
+#include "polyhedralGravity/util/UtilityFloatArithmetic.h"
+
+/**
+ * Namespace containing the batched Möller–Trumbore ray-triangle intersection kernel.
+ * The kernel is utilized by the {@link Polyhedron} to determine the orientation of the plane unit normals,
+ * but can equally be used for point-in-polyhedron or altitude queries.
+ */
+namespace polyhedralGravity::RayIntersection {
+
+    /**
+     * The triangles of a polyhedral mesh in a structure of arrays layout.
+     * Every triangle is stored as its first vertex and its two edges starting at this vertex, i.e. the quantities
+     * the Möller–Trumbore algorithm requires. This enables loading several triangles into one SIMD register.
+     */
+    struct TriangleSoA {
+        /** The first vertex of every triangle */
+        std::vector<double> vertexX, vertexY, vertexZ;
+        /** The edge from the first to the second vertex of every triangle */
+        std::vector<double> edge1X, edge1Y, edge1Z;
+        /** The edge from the first to the third vertex of every triangle */
+        std::vector<double> edge2X, edge2Y, edge2Z;
+
+        /**
+         * Creates the structure of arrays from a polyhedral mesh.
+         * @param vertices the vertices of the mesh
+         * @param faces the triangular faces of the mesh (indexed starting with zero)
+         */
+        TriangleSoA(const std::vector<Array3> &vertices, const std::vector<IndexArray3> &faces);
+
+        /**
+         * Returns the number of triangles.
+         * @return number of triangles
+         */
+        [[nodiscard]] size_t size() const {
+            return vertexX.size();
+        }
+    };
+
+    /**
+     * Intersects a ray with all triangles and writes the distance along the ray of every hit to the given buffer.
+     * The buffer is cleared first. Its capacity is retained, hence reusing the same buffer for multiple rays
+     * avoids any allocation once the buffer is large enough.
+     * The triangles are tested in SIMD batches, the remainder is tested one by one.
+     *
+     * @param rayOrigin the origin of the ray
+     * @param rayVector the direction of the ray
+     * @param triangles the triangles to test against
+     * @param hits the buffer the distances t (with intersection point = rayOrigin + t * rayVector) are written to,
+     *  in no particular order and possibly containing duplicates if the ray hits a shared edge or vertex
+     * @return the number of hits, i.e. the size of the buffer
+     */
+    size_t intersectRay(const Array3 &rayOrigin, const Array3 &rayVector, const TriangleSoA &triangles,
+                        std::vector<double> &hits);
+
+    /**
+     * Counts the distinct intersection points of a ray with the triangles.
+     * Hits at the same location (e.g. the ray passes exactly through an edge shared by two triangles)
+     * are counted once. The duplicates are removed by sorting the buffer.
+     *
+     * @param rayOrigin the origin of the ray
+     * @param rayVector the direction of the ray
+     * @param triangles the triangles to test against
+     * @param hits the buffer used for the intersections, contains the sorted, unique distances afterwards
+     * @return the number of distinct intersections
+     */
+    size_t countIntersections(const Array3 &rayOrigin, const Array3 &rayVector, const TriangleSoA &triangles,
+                              std::vector<double> &hits);
+
+    /**
+     * Tests a ray against a single triangle of the structure of arrays (Möller–Trumbore).
+     * @param rayOrigin the origin of the ray
+     * @param rayVector the direction of the ray
+     * @param triangles the triangles
+     * @param index the index of the triangle to test
+     * @return the distance t along the ray if the ray intersects the triangle, otherwise zero
+     */
+    double intersectTriangle(const Array3 &rayOrigin, const Array3 &rayVector, const TriangleSoA &triangles,
+                             size_t index);
+
+}// namespace polyhedralGravity::RayIntersection
@@ -0,0 +1,339 @@
+#include "Snapshot.h"
+
+namespace polyhedralGravity::Snapshot {
+
+    namespace {
+        static_assert(sizeof(Array3) == 3 * sizeof(double), "Array3 must consist of three contiguous doubles");
+        static_assert(sizeof(Array3Triplet) == 9 * sizeof(double), "Array3Triplet must consist of nine contiguous doubles");
+        static_assert(sizeof(IndexArray3) == 3 * sizeof(size_t), "IndexArray3 must consist of three contiguous indices");
+
+        /** The number of doubles or integers per element of every section */
+        constexpr std::array<size_t, 5> SECTION_WIDTHS{3, 3, 9, 3, 9};
+
+        size_t alignUp(size_t offset) {
+            return (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+        }
+
+        /**
+         * Computes the offsets of the sections following the header.
+         * The sections of the caches are only counted if present.
+         */
+        std::array<uint64_t, 5> computeOffsets(uint64_t vertexCount, uint64_t faceCount, bool hasCaches) {
+            std::array<uint64_t, 5> offsets{};
+            size_t offset = HEADER_SIZE;
+            for (size_t section = 0; section < offsets.size(); ++section) {
+                offsets[section] = offset;
+                const uint64_t count = section == 0 ? vertexCount : (section == 1 || hasCaches ? faceCount : 0);
+                offset = alignUp(offset + count * SECTION_WIDTHS[section] * sizeof(double));
+            }
+            return offsets;
+        }
+
+        /** Returns the total size of a snapshot in bytes */
+        size_t computeSize(const std::array<uint64_t, 5> &offsets, uint64_t faceCount, bool hasCaches) {
+            return alignUp(offsets[4] + (hasCaches ? faceCount * sizeof(Array3Triplet) : 0));
+        }
+
+        template<typename T>
+        void writeValue(char *data, T value) {
+            std::memcpy(data, &value, sizeof(T));
+        }
+
+        /** Receives the consecutive parts of a serialized snapshot */
+        using Output = std::function<void(const char *, size_t)>;
+
+        /** Writes the given bytes and pads the output up to the next section boundary */
+        void writeSection(const Output &output, const void *data, size_t size) {
+            output(static_cast<const char *>(data), size);
+            const std::vector<char> padding(alignUp(size) - size, '\0');
+            output(padding.data(), padding.size());
+        }
+
+        /**
+         * Copies a section consisting of doubles, swapping the bytes if the snapshot's byte order is not native.
+         * @tparam Element an array of doubles, e.g. Array3
+         */
+        template<typename Element>
+        std::vector<Element> readDoubles(const char *data, size_t count, util::ByteOrder byteOrder) {
+            std::vector<Element> elements(count);
+            if (byteOrder == util::nativeByteOrder()) {
+                std::memcpy(elements.data(), data, count * sizeof(Element));
+            } else {
+                auto *output = reinterpret_cast<char *>(elements.data());
+                for (size_t i = 0; i < count * sizeof(Element) / sizeof(double); ++i) {
+                    const double value = util::readBinary<double>(data + i * sizeof(double), byteOrder);
+                    std::memcpy(output + i * sizeof(double), &value, sizeof(double));
+                }
+            }
+            return elements;
+        }
+
+        Polyhedron readPolyhedron(const MappedFile &file, const Header &header) {
+            std::vector<Array3> vertices = readDoubles<Array3>(file.data() + header.offsets[0], header.vertexCount, header.byteOrder);
+            std::vector<IndexArray3> faces(header.faceCount);
+            const char *faceData = file.data() + header.offsets[1];
+            if (header.byteOrder == util::nativeByteOrder() && sizeof(size_t) == sizeof(uint64_t)) {
+                std::memcpy(faces.data(), faceData, faces.size() * sizeof(IndexArray3));
+            } else {
+                for (size_t i = 0; i < faces.size(); ++i) {
+                    for (size_t j = 0; j < 3; ++j) {
+                        const auto index = util::readBinary<uint64_t>(faceData + (3 * i + j) * sizeof(uint64_t), header.byteOrder);
+                        faces[i][j] = static_cast<size_t>(std::min<uint64_t>(index, std::numeric_limits<size_t>::max()));
+                    }
+                }
+            }
+            const uint64_t vertexCount = header.vertexCount;
+            if (std::any_of(faces.cbegin(), faces.cend(), [vertexCount](const IndexArray3 &face) {
+                    return std::any_of(face.cbegin(), face.cend(), [vertexCount](size_t index) { return index >= vertexCount; });
+                })) {
+                throw std::runtime_error("The snapshot contains a face referring to a non-existing vertex.");
+            }
+            // The snapshot contains an already checked (and healed) polyhedron
+            return Polyhedron{std::move(vertices), std::move(faces), header.density, header.orientation, PolyhedronIntegrity::DISABLE, header.metricUnit,
+                              VertexIndexing::ZERO_BASED};
+        }
+
+        /**
+         * Serializes the polyhedron and (if segmentVectors is not nullptr) the face caches.
+         * The output receives exactly {@link computeSize} bytes.
+         */
+        void serialize(const Output &output, const Polyhedron &polyhedron, MeshStorage storage, uint64_t sourceDigest,
+                       const Array3Triplet *segmentVectors, const Array3 *planeUnitNormals,
+                       const Array3Triplet *segmentUnitNormals) {
+            const bool hasCaches = segmentVectors != nullptr;
+            const uint64_t vertexCount = polyhedron.countVertices();
+            const uint64_t faceCount = polyhedron.countFaces();
+            const std::array<uint64_t, 5> offsets = computeOffsets(vertexCount, faceCount, hasCaches);
+
+            std::array<char, HEADER_SIZE> header{};
+            std::memcpy(header.data(), MAGIC, sizeof(MAGIC));
+            writeValue(header.data() + 8, static_cast<uint8_t>(util::nativeByteOrder()));
+            writeValue(header.data() + 9, static_cast<uint8_t>(polyhedron.getOrientation()));
+            writeValue(header.data() + 10, static_cast<uint8_t>(polyhedron.getMeshUnit()));
+            writeValue(header.data() + 11, static_cast<uint8_t>(hasCaches));
+            writeValue(header.data() + 12, VERSION);
+            writeValue(header.data() + 16, vertexCount);
+            writeValue(header.data() + 24, faceCount);
+            writeValue(header.data() + 32, polyhedron.getDensity());
+            for (size_t section = 0; section < offsets.size(); ++section) {
+                writeValue(header.data() + 40 + section * sizeof(uint64_t), offsets[section]);
+            }
+            writeValue(header.data() + 80, static_cast<uint8_t>(storage));
+            writeValue(header.data() + 88, sourceDigest);
+
+            std::vector<uint64_t> faces{};
+            faces.reserve(3 * faceCount);
+            for (const IndexArray3 &face: polyhedron.getFaces()) {
+                faces.insert(faces.end(), face.cbegin(), face.cend());
+            }
+
+            output(header.data(), header.size());
+            writeSection(output, polyhedron.getVertices().data(), vertexCount * sizeof(Array3));
+            writeSection(output, faces.data(), faces.size() * sizeof(uint64_t));
+            if (hasCaches) {
+                writeSection(output, segmentVectors, faceCount * sizeof(Array3Triplet));
+                writeSection(output, planeUnitNormals, faceCount * sizeof(Array3));
+                writeSection(output, segmentUnitNormals, faceCount * sizeof(Array3Triplet));
+            }
+        }
+
+        void write(const std::string &filename, const Polyhedron &polyhedron, MeshStorage storage, uint64_t sourceDigest,
+                   const Array3Triplet *segmentVectors, const Array3 *planeUnitNormals, const Array3Triplet *segmentUnitNormals) {
+            POLYHEDRAL_GRAVITY_LOG_DEBUG("Writing the snapshot {}", filename);
+            // The snapshot is written to a temporary file first, so that no reader observes a partially written file
+            const std::string temporaryFilename = filename + ".tmp";
+            {
+                std::ofstream file{temporaryFilename, std::ios::binary | std::ios::trunc};
+                serialize([&file](const char *data, size_t size) {
+                    file.write(data, static_cast<std::streamsize>(size));
+                }, polyhedron, storage, sourceDigest, segmentVectors, planeUnitNormals, segmentUnitNormals);
+                if (!file) {
+                    throw std::runtime_error("The snapshot " + filename + " could not be written.");
+                }
+            }
+            if (std::rename(temporaryFilename.c_str(), filename.c_str()) != 0) {
+                std::remove(temporaryFilename.c_str());
+                throw std::runtime_error("The snapshot " + filename + " could not be written.");
+            }
+        }
+
+        /**
+         * Reads a GravityEvaluable from a mapped snapshot.
+         * The mapping is kept alive as long as the GravityEvaluable if its caches are used in-place.
+         */
+        GravityEvaluable readMappedGravityEvaluable(const std::shared_ptr<const MappedFile> &file, const std::string &filename) {
+            const Header header = readHeader(*file, filename);
+            Polyhedron polyhedron = readPolyhedron(*file, header);
+            if (!header.hasCaches) {
+                return GravityEvaluable{std::move(polyhedron), header.storage};
+            }
+            const char *segmentVectors = file->data() + header.offsets[2];
+            const char *planeUnitNormals = file->data() + header.offsets[3];
+            const char *segmentUnitNormals = file->data() + header.offsets[4];
+            // The memory-mapping is page-aligned and the sections are aligned, however the fallback buffer might not be
+            if (header.byteOrder == util::nativeByteOrder() &&
+                reinterpret_cast<uintptr_t>(file->data()) % alignof(Array3Triplet) == 0) {
+                POLYHEDRAL_GRAVITY_LOG_DEBUG("Using the face caches in-place from the snapshot");
+                return GravityEvaluable{std::move(polyhedron), file,
+                                        reinterpret_cast<const Array3Triplet *>(segmentVectors),
+                                        reinterpret_cast<const Array3 *>(planeUnitNormals),
+                                        reinterpret_cast<const Array3Triplet *>(segmentUnitNormals)};
+            }
+            return GravityEvaluable{std::move(polyhedron),
+                                    readDoubles<Array3Triplet>(segmentVectors, header.faceCount, header.byteOrder),
+                                    readDoubles<Array3>(planeUnitNormals, header.faceCount, header.byteOrder),
+                                    readDoubles<Array3Triplet>(segmentUnitNormals, header.faceCount, header.byteOrder)};
+        }
+    }
+
+    uint64_t digestSource(const std::vector<std::string> &fileNames, double weldTolerance, PolyhedronIntegrity integrity) {
+        uint64_t digest = util::FNV_OFFSET_BASIS;
+        util::fnv1a(digest, static_cast<uint64_t>(fileNames.size()));
+        for (const std::string &fileName: fileNames) {
+            // The size and modification time identify the content without reading it
+            std::error_code error{};
+            const auto size = static_cast<uint64_t>(std::filesystem::file_size(fileName, error));
+            const auto modified = static_cast<int64_t>(std::filesystem::last_write_time(fileName, error).time_since_epoch().count());
+            if (error) {
+                throw std::runtime_error("The mesh file " + fileName + " cannot be read: " + error.message());
+            }
+            util::fnv1a(digest, static_cast<uint64_t>(fileName.size()));
+            util::fnv1a(digest, fileName.data(), fileName.size());
+            util::fnv1a(digest, size);
+            util::fnv1a(digest, modified);
+        }
+        util::fnv1a(digest, weldTolerance);
+        // Healing may modify the faces, hence the integrity measures are part of the source
+        util::fnv1a(digest, static_cast<uint8_t>(integrity));
+        // Zero marks an unknown source in the header
+        return digest != 0 ? digest : 1;
+    }
+
+    void write(const std::string &filename, const Polyhedron &polyhedron, uint64_t sourceDigest) {
+        write(filename, polyhedron, MeshStorage::DOUBLE, sourceDigest, nullptr, nullptr, nullptr);
+    }
+
+    void write(const std::string &filename, const GravityEvaluable &evaluable, uint64_t sourceDigest) {
+        // The compact caches are not written, but recomputed when reading the snapshot
+        const auto [segmentVectors, planeUnitNormals, segmentUnitNormals] = evaluable.getCaches();
+        write(filename, evaluable.getPolyhedron(), evaluable.getStorage(), sourceDigest,
+              segmentVectors, planeUnitNormals, segmentUnitNormals);
+    }
+
+    Polyhedron readPolyhedron(const std::string &filename) {
+        POLYHEDRAL_GRAVITY_LOG_DEBUG("Reading the snapshot {}", filename);
+        const MappedFile file{filename};
+        return readPolyhedron(file, readHeader(file, filename));
+    }
+
+    GravityEvaluable readGravityEvaluable(const std::string &filename) {
+        POLYHEDRAL_GRAVITY_LOG_DEBUG("Reading the snapshot {}", filename);
+        return readMappedGravityEvaluable(std::make_shared<const MappedFile>(filename), filename);
+    }
+
+    void writeSharedMemory(const std::string &name, const GravityEvaluable &evaluable) {
+        POLYHEDRAL_GRAVITY_LOG_DEBUG("Writing the snapshot into the shared-memory object {}", name);
+#ifdef POLYHEDRAL_GRAVITY_MMAP
+        const Polyhedron &polyhedron = evaluable.getPolyhedron();
+        const auto [segmentVectors, planeUnitNormals, segmentUnitNormals] = evaluable.getCaches();
+        const bool hasCaches = segmentVectors != nullptr;
+        const size_t size = computeSize(computeOffsets(polyhedron.countVertices(), polyhedron.countFaces(), hasCaches),
+                                        polyhedron.countFaces(), hasCaches);
+        // An existing object is unlinked instead of truncated, processes attached to it keep their (intact) mapping.
+        // The new object is created exclusively, so that no other writer concurrently fills the same object.
+        if (::shm_unlink(name.c_str()) != 0 && errno != ENOENT) {
+            throw std::runtime_error("Could not replace the shared-memory object " + name + ".");
+        }
+        const int fileDescriptor = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+        if (fileDescriptor < 0) {
+            throw std::runtime_error("Could not create the shared-memory object " + name + ".");
+        }
+        if (::ftruncate(fileDescriptor, static_cast<off_t>(size)) != 0) {
+            ::close(fileDescriptor);
+            ::shm_unlink(name.c_str());
+            throw std::runtime_error("Could not resize the shared-memory object " + name + " to " + std::to_string(size) + " bytes.");
+        }
+        void *mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+        ::close(fileDescriptor);
+        if (mapping == MAP_FAILED) {
+            ::shm_unlink(name.c_str());
+            throw std::runtime_error("Could not memory-map the shared-memory object " + name + ".");
+        }
+        // The (zero-filled) object is no valid snapshot until its magic is written last, hence processes attaching
+        // while it is written are rejected by readHeader instead of reading incomplete caches
+        char *const begin = static_cast<char *>(mapping);
+        char *cursor = begin;
+        serialize([begin, &cursor](const char *data, size_t count) {
+            const size_t skipped = cursor == begin ? std::min(count, sizeof(MAGIC)) : 0;
+            std::memcpy(cursor + skipped, data + skipped, count - skipped);
+            cursor += count;
+        }, polyhedron, evaluable.getStorage(), 0, segmentVectors, planeUnitNormals, segmentUnitNormals);
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(begin, MAGIC, sizeof(MAGIC));
+        ::munmap(mapping, size);
+#else
+        throw std::runtime_error("Could not create the shared-memory object " + name + ", shared memory is not supported on this system.");
+#endif
+    }
+
+    GravityEvaluable readSharedMemory(const std::string &name) {
+        POLYHEDRAL_GRAVITY_LOG_DEBUG("Attaching to the shared-memory object {}", name);
+        return readMappedGravityEvaluable(MappedFile::openSharedMemory(name), name);
+    }
+
+    void removeSharedMemory(const std::string &name) {
+#ifdef POLYHEDRAL_GRAVITY_MMAP
+        if (::shm_unlink(name.c_str()) != 0) {
+            throw std::runtime_error("Could not remove the shared-memory object " + name + ".");
+        }
+#else
+        throw std::runtime_error("Could not remove the shared-memory object " + name + ", shared memory is not supported on this system.");
+#endif
+    }
+
+    Header readHeader(const MappedFile &file, const std::string &filename) {
+        if (file.size() < HEADER_SIZE || std::memcmp(file.data(), MAGIC, sizeof(MAGIC)) != 0) {
+            throw std::runtime_error("The file " + filename + " is no polyhedral gravity snapshot.");
+        }
+        // Pairs with the release fence of writeSharedMemory, which writes the magic last
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const char *data = file.data();
+        const auto byteOrder = static_cast<uint8_t>(data[8]);
+        const auto orientation = static_cast<uint8_t>(data[9]);
+        const auto metricUnit = static_cast<uint8_t>(data[10]);
+        const auto storage = static_cast<uint8_t>(data[80]);
+        if (byteOrder > static_cast<uint8_t>(util::ByteOrder::BIG) ||
+            orientation > static_cast<uint8_t>(NormalOrientation::INWARDS) ||
+            metricUnit > static_cast<uint8_t>(MetricUnit::UNITLESS) ||
+            storage > static_cast<uint8_t>(MeshStorage::COMPACT_FLOAT32)) {
+            throw std::runtime_error("The snapshot " + filename + " has a malformed header.");
+        }
+        Header header{};
+        header.byteOrder = static_cast<util::ByteOrder>(byteOrder);
+        header.orientation = static_cast<NormalOrientation>(orientation);
+        header.metricUnit = static_cast<MetricUnit>(metricUnit);
+        header.storage = static_cast<MeshStorage>(storage);
+        header.hasCaches = data[11] != 0;
+        header.version = util::readBinary<uint32_t>(data + 12, header.byteOrder);
+        if (header.version != VERSION) {
+            throw std::runtime_error("The snapshot " + filename + " has the version " + std::to_string(header.version) +
+                                     ", but only version " + std::to_string(VERSION) + " is supported.");
+        }
+        header.vertexCount = util::readBinary<uint64_t>(data + 16, header.byteOrder);
+        header.faceCount = util::readBinary<uint64_t>(data + 24, header.byteOrder);
+        header.density = util::readBinary<double>(data + 32, header.byteOrder);
+        header.sourceDigest = util::readBinary<uint64_t>(data + 88, header.byteOrder);
+        for (size_t section = 0; section < header.offsets.size(); ++section) {
+            header.offsets[section] = util::readBinary<uint64_t>(data + 40 + section * sizeof(uint64_t), header.byteOrder);
+        }
+        // The layout is fully determined by the counts, so any deviation (including truncation) is an error
+        const uint64_t maximalCount = file.size() / sizeof(double);
+        if (header.vertexCount > maximalCount || header.faceCount > maximalCount ||
+            header.offsets != computeOffsets(header.vertexCount, header.faceCount, header.hasCaches) ||
+            file.size() < computeSize(header.offsets, header.faceCount, header.hasCaches)) {
+            throw std::runtime_error("The snapshot " + filename + " is truncated or malformed.");
+        }
+        return header;
+    }
+
+}// namespace polyhedralGravity::Snapshot
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <memory>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+
+#include "PolyhedronDefinitions.h"
+#include "Polyhedron.h"
+#include "GravityEvaluable.h"
+#include "polyhedralGravity/input/MappedFile.h"
+#include "polyhedralGravity/output/Logging.h"
+#include "polyhedralGravity/util/UtilityBinary.h"
+
+/**
+ * Namespace containing the binary snapshot format of a {@link Polyhedron} and a {@link GravityEvaluable}.
+ * A snapshot contains the vertices, faces, density, orientation, and mesh unit of the polyhedron and optionally
+ * the precomputed face caches of the GravityEvaluable. Restoring it neither parses a mesh, nor runs the mesh
+ * integrity checks (the snapshot contains the already checked polyhedron), nor recomputes the caches.
+ *
+ * The file consists of a fixed-size header followed by sections aligned to {@link ALIGNMENT} bytes:
+ * vertices (3 x float64), faces (3 x uint64), and (optionally) the segment vectors (9 x float64),
+ * plane unit normals (3 x float64), and segment unit normals (9 x float64) per face.
+ * Every number is stored in the byte order given in the header. If this is the native byte order,
+ * the face caches of a GravityEvaluable are used straight from the memory-mapped file without any copy.
+ * The vertices and faces are always copied into the polyhedron's vectors (in bulk if the byte order is native),
+ * as a std::vector cannot alias the mapping. They are a fraction of the size of the caches.
+ * A GravityEvaluable in compact storage (see {@link MeshStorage}) is stored without face caches, they are
+ * recomputed in the same storage when reading the snapshot.
+ * The header optionally contains a digest of the mesh source (see {@link digestSource}), so that a stale snapshot
+ * of modified mesh files is detected.
+ */
+namespace polyhedralGravity::Snapshot {
+
+    /** The magic bytes at the beginning of every snapshot */
+    constexpr char MAGIC[8] = {'P', 'G', 'S', 'N', 'A', 'P', '\0', '\0'};
+
+    /** The version of the format, incremented on every incompatible change */
+    constexpr uint32_t VERSION = 2;
+
+    /** The alignment of the sections in bytes */
+    constexpr size_t ALIGNMENT = 64;
+
+    /**
+     * The fixed-size header of a snapshot.
+     * @note This struct is basically a named tuple
+     */
+    struct Header {
+        /** The byte order of all numbers in the file (including the rest of this header) */
+        util::ByteOrder byteOrder;
+        /** The version of the format */
+        uint32_t version;
+        /** The number of vertices */
+        uint64_t vertexCount;
+        /** The number of faces */
+        uint64_t faceCount;
+        /** The constant density of the polyhedron */
+        double density;
+        /** The orientation of the plane unit normals */
+        NormalOrientation orientation;
+        /** The unit of the mesh */
+        MetricUnit metricUnit;
+        /** True if the snapshot contains the face caches of a GravityEvaluable */
+        bool hasCaches;
+        /** The storage of the GravityEvaluable's caches, the compact caches are recomputed instead of stored */
+        MeshStorage storage;
+        /** The offsets of the vertices, faces, segment vectors, plane unit normals, and segment unit normals */
+        std::array<uint64_t, 5> offsets;
+        /** The digest of the mesh source the snapshot was created from, zero if unknown */
+        uint64_t sourceDigest;
+    };
+
+    /** The size of the header in the file */
+    constexpr size_t HEADER_SIZE = 128;
+
+    /**
+     * Computes the digest (64-bit FNV-1a) of a mesh source, i.e. of the files' names, sizes, and modification times,
+     * of the tolerance their vertices are welded with, and of the integrity measures the polyhedron is constructed with.
+     * A snapshot storing this digest can be checked for being up-to-date without reading the mesh.
+     * The content of the files is not read, a modification keeping both the size and the modification time is not detected.
+     * @param fileNames the mesh files
+     * @param weldTolerance the welding tolerance (see {@link MeshReader::getPolyhedralSource})
+     * @param integrity the integrity measures, e.g. HEAL (see {@link PolyhedronIntegrity})
+     * @return the digest
+     * @throws std::runtime_error if a file does not exist
+     */
+    uint64_t digestSource(const std::vector<std::string> &fileNames, double weldTolerance = 0.0,
+                          PolyhedronIntegrity integrity = PolyhedronIntegrity::DISABLE);
+
+    /**
+     * Writes a snapshot of a polyhedron (without face caches).
+     * @param filename the file to write to
+     * @param polyhedron the polyhedron
+     * @param sourceDigest the digest of the mesh source (see {@link digestSource}), zero if unknown
+     * @throws std::runtime_error if the file cannot be written
+     */
+    void write(const std::string &filename, const Polyhedron &polyhedron, uint64_t sourceDigest = 0);
+
+    /**
+     * Writes a snapshot of a GravityEvaluable including its polyhedron and face caches.
+     * @param filename the file to write to
+     * @param evaluable the GravityEvaluable
+     * @param sourceDigest the digest of the mesh source (see {@link digestSource}), zero if unknown
+     * @throws std::runtime_error if the file cannot be written
+     */
+    void write(const std::string &filename, const GravityEvaluable &evaluable, uint64_t sourceDigest = 0);
+
+    /**
+     * Reads the polyhedron of a snapshot.
+     * @param filename the snapshot file
+     * @return the polyhedron
+     * @throws std::runtime_error if the file is no valid snapshot
+     */
+    Polyhedron readPolyhedron(const std::string &filename);
+
+    /**
+     * Reads a GravityEvaluable from a snapshot. The file is memory-mapped and, if it is stored in the native
+     * byte order, the face caches are utilized in-place (the mapping lives as long as the GravityEvaluable).
+     * The vertices and faces are copied.
+     * If the snapshot contains no caches, they are computed.
+     * @param filename the snapshot file
+     * @return the GravityEvaluable
+     * @throws std::runtime_error if the file is no valid snapshot
+     */
+    GravityEvaluable readGravityEvaluable(const std::string &filename);
+
+    /**
+     * Writes a snapshot of a GravityEvaluable into a POSIX shared-memory object (replacing an existing one),
+     * so that multiple processes on one node can attach to a single read-only copy of the polyhedron and its
+     * face caches (see {@link readSharedMemory}). The object persists until {@link removeSharedMemory} is called.
+     * An existing object is unlinked and a new one created, processes attached to the old object keep using it.
+     * The magic of the header is written last, processes attaching before this function returned are rejected.
+     * @param name the name of the shared-memory object (e.g. "/polyhedron")
+     * @param evaluable the GravityEvaluable
+     * @throws std::runtime_error if the object cannot be created or shared memory is not supported on this system
+     */
+    void writeSharedMemory(const std::string &name, const GravityEvaluable &evaluable);
+
+    /**
+     * Attaches to a snapshot in a POSIX shared-memory object written by {@link writeSharedMemory}.
+     * The face caches are used in-place, i.e. all attached processes share the same physical memory.
+     * Every process copies the vertices and faces.
+     * @param name the name of the shared-memory object
+     * @return the GravityEvaluable
+     * @throws std::runtime_error if the object does not exist or is no valid (or not yet completely written) snapshot
+     */
+    GravityEvaluable readSharedMemory(const std::string &name);
+
+    /**
+     * Removes a POSIX shared-memory object. Attached GravityEvaluables remain valid.
+     * @param name the name of the shared-memory object
+     * @throws std::runtime_error if the object does not exist or shared memory is not supported on this system
+     */
+    void removeSharedMemory(const std::string &name);
+
+    /**
+     * Parses and validates the header of a snapshot.
+     * @param file the memory-mapped snapshot
+     * @param filename the name of the file (for error messages)
+     * @return the header
+     * @throws std::runtime_error if the file is no valid snapshot (magic, version, size)
+     */
+    Header readHeader(const MappedFile &file, const std::string &filename);
+
+}// namespace polyhedralGravity::Snapshot
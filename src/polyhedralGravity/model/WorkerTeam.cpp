@@ -0,0 +1,140 @@
+#include "WorkerTeam.h"
+
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include "Numa.h"
+#include "polyhedralGravity/output/Logging.h"
+
+namespace polyhedralGravity {
+
+    namespace {
+        /**
+         * The number of busy-wait iterations after which a waiting thread also yields its core, so that
+         * the team still makes progress if it has more threads than there are free cores
+         */
+        constexpr size_t YIELD_AFTER_SPINS = 1024;
+
+        /**
+         * Hints the processor that the calling thread busy-waits, which reduces the power consumption and
+         * frees resources for the sibling hardware thread. After a while, the thread yields its core.
+         * @param spins the number of busy-wait iterations so far
+         */
+        inline void pause(size_t spins) {
+            if (spins >= YIELD_AFTER_SPINS) {
+                std::this_thread::yield();
+                return;
+            }
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+            _mm_pause();
+#elif defined(__aarch64__)
+            asm volatile("yield");
+#else
+            std::this_thread::yield();
+#endif
+        }
+    }// namespace
+
+    thread_local std::vector<const WorkerTeam *> WorkerTeam::_runningTeams{};
+
+    WorkerTeam::WorkerTeam(size_t threads, size_t spinIterations, const std::vector<size_t> &cpus)
+        : _spinIterations{spinIterations} {
+        if (threads == 0) {
+            threads = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+        for (size_t index = 1; index < threads; ++index) {
+            const std::optional<size_t> cpu = index < cpus.size() ? std::optional<size_t>{cpus[index]} : std::nullopt;
+            _workers.emplace_back([this, index, cpu]() { this->work(index, cpu); });
+        }
+    }
+
+    WorkerTeam::~WorkerTeam() {
+        _stopped.store(true);
+        _epoch.fetch_add(1);
+        {
+            std::lock_guard<std::mutex> lock{_parkMutex};
+        }
+        _wakeUp.notify_all();
+        for (auto &worker: _workers) {
+            worker.join();
+        }
+    }
+
+    size_t WorkerTeam::countThreads() const {
+        return _workers.size() + 1;
+    }
+
+    bool WorkerTeam::isRunning() const {
+        return std::find(_runningTeams.cbegin(), _runningTeams.cend(), this) != _runningTeams.cend();
+    }
+
+    void WorkerTeam::work(size_t index, std::optional<size_t> cpu) {
+        if (cpu.has_value() && !pinCurrentThread({cpu.value()})) {
+            POLYHEDRAL_GRAVITY_LOG_DEBUG("Could not pin a worker of the team to the CPU {}", cpu.value());
+        }
+        _runningTeams.push_back(this);
+        size_t seenEpoch{0};
+        while (true) {
+            size_t spins{0};
+            while (_epoch.load(std::memory_order_acquire) == seenEpoch) {
+                if (++spins < _spinIterations) {
+                    pause(spins);
+                    continue;
+                }
+                // No job for a while, the worker releases its core until the next one
+                std::unique_lock<std::mutex> lock{_parkMutex};
+                _parked.fetch_add(1);
+                _wakeUp.wait(lock, [this, seenEpoch]() { return _epoch.load() != seenEpoch; });
+                _parked.fetch_sub(1);
+                spins = 0;
+            }
+            seenEpoch = _epoch.load(std::memory_order_acquire);
+            if (_stopped.load()) {
+                return;
+            }
+            try {
+                _invoke(_job, index);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock{_exceptionMutex};
+                if (!_exception) {
+                    _exception = std::current_exception();
+                }
+            }
+            _remaining.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    void WorkerTeam::dispatch() {
+        _exception = nullptr;
+        _remaining.store(_workers.size(), std::memory_order_relaxed);
+        _epoch.fetch_add(1);
+        if (_parked.load() > 0) {
+            {
+                std::lock_guard<std::mutex> lock{_parkMutex};
+            }
+            _wakeUp.notify_all();
+        }
+        std::exception_ptr exception{};
+        _runningTeams.push_back(this);
+        try {
+            _invoke(_job, 0);
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        _runningTeams.pop_back();
+        // The lightweight barrier, the workers complete their share of the job within the same time
+        for (size_t spins = 0; _remaining.load(std::memory_order_acquire) != 0; ++spins) {
+            pause(spins);
+        }
+        if (!exception) {
+            exception = _exception;
+        }
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+}// namespace polyhedralGravity
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace polyhedralGravity {
+
+    /**
+     * A persistent team of worker threads for latency-critical parallel work, e.g. evaluating a single point
+     * millions of times. The workers busy-wait for the next job instead of being woken by the operating system,
+     * hence starting a job and waiting for its completion costs well below a microsecond as long as the workers spin.
+     * After spinning unsuccessfully for a while, the workers park on a condition variable to release their cores.
+     * A job is a callable receiving the index of the thread running it, the calling thread takes the index zero.
+     * Jobs of several callers are run one after another.
+     * A job may itself run a job of the same team (e.g. evaluate a point with a GravityEvaluable bound to the team),
+     * the nested job is then run serially on the thread of the outer job, since the team's threads are busy.
+     */
+    class WorkerTeam {
+
+    public:
+
+        /** The default number of busy-wait iterations before a worker parks (in the order of milliseconds) */
+        static constexpr size_t DEFAULT_SPIN_ITERATIONS = 1 << 18;
+
+    private:
+
+        /** The number of busy-wait iterations before a worker parks */
+        const size_t _spinIterations;
+
+        /** The workers, whose indices start at one */
+        std::vector<std::thread> _workers{};
+
+        /** Incremented for every job, the workers run a job whenever it changes */
+        std::atomic<size_t> _epoch{0};
+
+        /** The number of workers which have not yet completed the current job */
+        std::atomic<size_t> _remaining{0};
+
+        /** True if the workers are to be stopped */
+        std::atomic<bool> _stopped{false};
+
+        /** The number of parked workers */
+        std::atomic<size_t> _parked{0};
+
+        /** The current job, a type-erased callable and its invocation function */
+        const void *_job{nullptr};
+
+        /** Invokes the current job with a thread index */
+        void (*_invoke)(const void *, size_t){nullptr};
+
+        /** The first exception thrown by a worker during the current job */
+        std::exception_ptr _exception{};
+
+        /** Guards the exception */
+        std::mutex _exceptionMutex{};
+
+        /** Guards the parking of the workers */
+        std::mutex _parkMutex{};
+
+        /** Notified if a job was started or the team is stopped */
+        std::condition_variable _wakeUp{};
+
+        /** Serializes the jobs of several callers */
+        std::mutex _runMutex{};
+
+        /** The teams whose jobs the current thread is running (a worker always runs its team's jobs) */
+        static thread_local std::vector<const WorkerTeam *> _runningTeams;
+
+        /**
+         * Checks if the current thread is running a job of this team, i.e. if a job would wait for itself.
+         * @return true if the current thread is running a job of this team
+         */
+        [[nodiscard]] bool isRunning() const;
+
+        /**
+         * The loop of every worker, runs the jobs until the team is stopped.
+         * @param index the index of the worker, starting at one
+         * @param cpu the CPU to pin the worker to, std::nullopt leaves it unpinned
+         */
+        void work(size_t index, std::optional<size_t> cpu);
+
+        /**
+         * Publishes the current job to the workers, runs it with index zero, and waits for the workers to complete it.
+         * @throws the first exception thrown by the job
+         */
+        void dispatch();
+
+    public:
+
+        /**
+         * Creates a new WorkerTeam and starts its workers.
+         * @param threads the number of threads running a job, including the calling thread
+         *          (default: zero, i.e. one thread per hardware thread)
+         * @param spinIterations the number of busy-wait iterations before a worker parks
+         * @param cpus the CPUs to pin the threads to (see {@link pinCurrentThread}), the first one for the calling
+         *          thread, which is not pinned by the team (default: empty, i.e. the workers are not pinned)
+         */
+        explicit WorkerTeam(size_t threads = 0, size_t spinIterations = DEFAULT_SPIN_ITERATIONS,
+                            const std::vector<size_t> &cpus = {});
+
+        WorkerTeam(const WorkerTeam &) = delete;
+
+        WorkerTeam &operator=(const WorkerTeam &) = delete;
+
+        /**
+         * Stops and joins the workers.
+         */
+        ~WorkerTeam();
+
+        /**
+         * Returns the number of threads running a job, i.e. the workers and the calling thread.
+         * @return the number of threads
+         */
+        [[nodiscard]] size_t countThreads() const;
+
+        /**
+         * Runs the job once on every thread of the team and returns after all threads completed it.
+         * If called from a job of this team, the job is run serially with every index on the calling thread instead.
+         * @tparam Job callable with the index of the thread, i.e. in [0, countThreads())
+         * @param job the job, it must be safe to call concurrently
+         * @throws the first exception thrown by the job
+         */
+        template<typename Job>
+        void run(const Job &job) {
+            if (this->isRunning()) {
+                for (size_t index = 0; index < this->countThreads(); ++index) {
+                    job(index);
+                }
+                return;
+            }
+            std::lock_guard<std::mutex> lock{_runMutex};
+            _job = &job;
+            _invoke = [](const void *context, size_t index) {
+                (*static_cast<const Job *>(context))(index);
+            };
+            this->dispatch();
+        }
+
+    };
+
+}// namespace polyhedralGravity
@@ -0,0 +1,32 @@
+#include "BinaryResultWriter.h"
+
+namespace polyhedralGravity {
+
+    BinaryResultWriter::BinaryResultWriter(const std::string &filename)
+        : _stream{filename, std::ios::binary | std::ios::trunc},
+          _filename{filename} {
+        if (!_stream.is_open()) {
+            throw std::runtime_error("The file " + filename + " could not be created.");
+        }
+    }
+
+    void BinaryResultWriter::write(const std::vector<Array3> &computationPoints,
+                                   const std::vector<GravityModelResult> &gravityResults) {
+        flatten(computationPoints, gravityResults, _buffer);
+        _stream.write(reinterpret_cast<const char *>(_buffer.data()),
+                      static_cast<std::streamsize>(_buffer.size() * sizeof(double)));
+        if (!_stream) {
+            throw std::runtime_error("The file " + _filename + " could not be written.");
+        }
+    }
+
+    void BinaryResultWriter::close() {
+        if (_stream.is_open()) {
+            _stream.close();
+            if (!_stream) {
+                throw std::runtime_error("The file " + _filename + " could not be written.");
+            }
+        }
+    }
+
+}
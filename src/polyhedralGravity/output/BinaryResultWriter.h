@@ -0,0 +1,44 @@
+#pragma once
+
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ResultWriter.h"
+
+namespace polyhedralGravity {
+
+    /**
+     * Writes the results as raw binary file without any header: consecutive rows of
+     * {@link ResultWriter::VALUES_PER_ROW} float64 values in the native byte order.
+     * Every chunk is written with a single write call.
+     */
+    class BinaryResultWriter final : public ResultWriter {
+
+        /** The output stream */
+        std::ofstream _stream;
+
+        /** The name of the file (for error messages) */
+        const std::string _filename;
+
+        /** Buffer for the rows of one chunk */
+        std::vector<double> _buffer{};
+
+    public:
+
+        /**
+         * Creates a new BinaryResultWriter, an existing file is truncated.
+         * @param filename the output file
+         * @throws std::runtime_error if the file cannot be created
+         */
+        explicit BinaryResultWriter(const std::string &filename);
+
+        void write(const std::vector<Array3> &computationPoints,
+                   const std::vector<GravityModelResult> &gravityResults) override;
+
+        void close() override;
+
+    };
+
+}
@@ -2,20 +2,55 @@
 
 namespace polyhedralGravity {
 
-    void CSVWriter::printResult(const std::vector<std::array<double, 3>> &computationPoints,
-                                const std::vector<GravityModelResult> &gravityResults) const {
-        _logger->info("Point P,Potential [m^2/s^2],Acceleration [m/s^2],Second Derivative Gravity Tensor [1/s^2]");
-        for (size_t i = 0; i < computationPoints.size() && i < gravityResults.size(); ++i) {
-            const std::array<double, 3> &computationPoint = computationPoints[i];
-            const auto &[potential, acceleration, secondDerivative] = gravityResults[i];
-            //Because of ADL the overload operator<< for arrays (in UtilityContainer) does not work here
-            //@related https://en.cppreference.com/w/cpp/language/adl
-            _logger->info("[{} {} {}],{},[{} {} {}],[{} {} {} {} {} {}]",
-                          computationPoint[0], computationPoint[1], computationPoint[2], potential,
-                          acceleration[0], acceleration[1], acceleration[2], secondDerivative[0], secondDerivative[1],
-                          secondDerivative[2], secondDerivative[3], secondDerivative[4], secondDerivative[5]);
+    CSVWriter::CSVWriter(const std::string &filename)
+        : _stream{filename, std::ios::binary | std::ios::trunc},
+          _filename{filename} {
+        if (!_stream.is_open()) {
+            throw std::runtime_error("The file " + filename + " could not be created.");
         }
+        _stream << "x,y,z,V,Vx,Vy,Vz,Vxx,Vyy,Vzz,Vxy,Vxz,Vyz\n";
     }
 
-}
+    void CSVWriter::write(const std::vector<Array3> &computationPoints,
+                          const std::vector<GravityModelResult> &gravityResults) {
+        flatten(computationPoints, gravityResults, _buffer);
+        const size_t rows = _buffer.size() / VALUES_PER_ROW;
+        const size_t blockCount = (rows + ROWS_PER_BLOCK - 1) / ROWS_PER_BLOCK;
+        if (_blocks.size() < blockCount) {
+            _blocks.resize(blockCount);
+        }
+        auto countingIterator = thrust::make_counting_iterator<size_t>(0);
+        thrust::for_each(thrust::device, countingIterator, countingIterator + blockCount, [&](const size_t block) {
+            const size_t firstRow = block * ROWS_PER_BLOCK;
+            const size_t lastRow = std::min(firstRow + ROWS_PER_BLOCK, rows);
+            std::string &text = _blocks[block];
+            text.resize((lastRow - firstRow) * VALUES_PER_ROW * MAX_VALUE_LENGTH);
+            char *first = text.data();
+            char *const last = text.data() + text.size();
+            for (const double *value = _buffer.data() + firstRow * VALUES_PER_ROW;
+                 value != _buffer.data() + lastRow * VALUES_PER_ROW; ++value) {
+                first = std::to_chars(first, last, *value).ptr;
+                // Every row ends with a newline, the values within a row are separated by commas
+                const bool endOfRow = (value - _buffer.data()) % VALUES_PER_ROW == VALUES_PER_ROW - 1;
+                *first++ = endOfRow ? '\n' : ',';
+            }
+            text.resize(first - text.data());
+        });
+        for (size_t block = 0; block < blockCount; ++block) {
+            _stream.write(_blocks[block].data(), static_cast<std::streamsize>(_blocks[block].size()));
+        }
+        if (!_stream) {
+            throw std::runtime_error("The file " + _filename + " could not be written.");
+        }
+    }
 
+    void CSVWriter::close() {
+        if (_stream.is_open()) {
+            _stream.close();
+            if (!_stream) {
+                throw std::runtime_error("The file " + _filename + " could not be written.");
+            }
+        }
+    }
+
+}
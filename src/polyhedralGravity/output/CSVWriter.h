@@ -1,62 +1,61 @@
 #pragma once
 
-#include <iostream>
+#include <charconv>
+#include <fstream>
+#include <stdexcept>
 #include <string>
-#include <exception>
-#include <utility>
-#include <memory>
-#include "polyhedralGravity/model/GravityModelData.h"
-#include "spdlog/spdlog.h"
-#include "spdlog/sinks/basic_file_sink.h"
-#include "spdlog/fmt/ostr.h"
+#include <vector>
+#include "ResultWriter.h"
 
 namespace polyhedralGravity {
 
 /**
- * By using spdlog, this class provides methods to print the result the polyhedral gravity model into an CSV file.
- * @note The used Logger level is "info", so this should be activated at least if output is wished!
+ * Writes the results of the polyhedral gravity model into a CSV file with one column per value,
+ * i.e. x, y, z, V, Vx, Vy, Vz, Vxx, Vyy, Vzz, Vxy, Vxz, Vyz.
+ * The rows are formatted in parallel with std::to_chars (shortest representation which round-trips)
+ * into one buffer per block of rows, the buffers are then written in order.
  */
-    class CSVWriter {
+    class CSVWriter final : public ResultWriter {
 
-        /**
-        * The logger to write to the file sink
-        */
-        std::shared_ptr<spdlog::logger> _logger;
+        /** The number of rows formatted by one task */
+        static constexpr size_t ROWS_PER_BLOCK = 4096;
+
+        /** The maximal number of characters of one value (shortest round-trip double) including its separator */
+        static constexpr size_t MAX_VALUE_LENGTH = 25;
+
+        /** The output stream */
+        std::ofstream _stream;
+
+        /** The name of the file (for error messages) */
+        const std::string _filename;
+
+        /** Buffer for the rows of one chunk */
+        std::vector<double> _buffer{};
 
+        /** The formatted text of every block of rows, the capacity is retained between chunks */
+        std::vector<std::string> _blocks{};
 
     public:
 
         /**
-         * Creates a new CSVWriter.
+         * Creates a new CSVWriter and writes the header line.
          * Results are written to "polyhedralGravityModel.csv".
+         * @throws std::runtime_error if the file cannot be created
          */
         CSVWriter() : CSVWriter("polyhedralGravityModel.csv") {}
 
         /**
-         * Creates a new CSVWriter.
+         * Creates a new CSVWriter and writes the header line, an existing file is truncated.
          * Results are written to file with filename as name.
          * @param filename a string
+         * @throws std::runtime_error if the file cannot be created
          */
-        explicit CSVWriter(const std::string &filename)
-                : _logger{
-                spdlog::basic_logger_mt<spdlog::synchronous_factory>("CSVWriter_" + filename, filename, true)} {
-            _logger->set_pattern("%v");
-        }
+        explicit CSVWriter(const std::string &filename);
 
-        /**
-         * De-Registers the logger of the CSVWriter, to ensure that a similar CSVWriter can be constructed once again.
-         */
-        ~CSVWriter() {
-            spdlog::drop(_logger->name());
-        }
+        void write(const std::vector<Array3> &computationPoints,
+                   const std::vector<GravityModelResult> &gravityResults) override;
 
-        /**
-         * Prints the result to the specified file
-         * @param computationPoints vector of computation points
-         * @param gravityResults vector of gravity results
-         */
-        void printResult(const std::vector<std::array<double, 3>> &computationPoints,
-                         const std::vector<GravityModelResult> &gravityResults) const;
+        void close() override;
 
     };
 
@@ -0,0 +1,72 @@
+#include "MappedResultFile.h"
+
+namespace polyhedralGravity {
+
+    MappedResultFile::MappedResultFile(const std::string &filename, size_t count)
+        : _filename{filename},
+          _count{count},
+          _size{HEADER_SIZE + COMPONENTS * count * sizeof(double)} {
+#ifdef POLYHEDRAL_GRAVITY_MMAP
+        const int fileDescriptor = ::open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fileDescriptor < 0) {
+            throw std::runtime_error("Could not create file " + filename + ".");
+        }
+        // The file is extended with zeros, so that every page can be mapped without writing it first
+        if (::ftruncate(fileDescriptor, static_cast<off_t>(_size)) != 0) {
+            ::close(fileDescriptor);
+            throw std::runtime_error("Could not resize file " + filename + " to " + std::to_string(_size) + " bytes.");
+        }
+        void *mapping = ::mmap(nullptr, _size, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+        ::close(fileDescriptor);
+        if (mapping == MAP_FAILED) {
+            throw std::runtime_error("Could not memory-map file " + filename + ".");
+        }
+        _data = static_cast<char *>(mapping);
+#else
+        _buffer.resize(_size, '\0');
+        _data = _buffer.data();
+#endif
+        const char *type = util::nativeByteOrder() == util::ByteOrder::LITTLE ? "<f8" : ">f8";
+        std::string header = std::string{"{'descr': '"} + type + "', 'fortran_order': False, 'shape': (" +
+                             std::to_string(COMPONENTS) + ", " + std::to_string(count) + "), }";
+        // The dictionary is padded with spaces and terminated by a newline, so that the data is 64-byte aligned
+        header.resize(HEADER_SIZE - 10 - 1, ' ');
+        header.push_back('\n');
+        const std::array<char, 10> preamble{'\x93', 'N', 'U', 'M', 'P', 'Y', '\x01', '\x00',
+                                            static_cast<char>(header.size() & 0xFF), static_cast<char>(header.size() >> 8)};
+        std::memcpy(_data, preamble.data(), preamble.size());
+        std::memcpy(_data + preamble.size(), header.data(), header.size());
+    }
+
+    MappedResultFile::~MappedResultFile() {
+#ifdef POLYHEDRAL_GRAVITY_MMAP
+        ::munmap(_data, _size);
+#else
+        try {
+            flush();
+        } catch (...) {
+        }
+#endif
+    }
+
+    GravityModelResultSpans MappedResultFile::spans() const {
+        auto *values = reinterpret_cast<double *>(_data + HEADER_SIZE);
+        const auto row = [values, this](size_t component) { return values + component * _count; };
+        return {row(0), {row(1), row(2), row(3)}, {row(4), row(5), row(6), row(7), row(8), row(9)}};
+    }
+
+    void MappedResultFile::flush() {
+#ifdef POLYHEDRAL_GRAVITY_MMAP
+        if (::msync(_data, _size, MS_SYNC) != 0) {
+            throw std::runtime_error("Could not write file " + _filename + ".");
+        }
+#else
+        std::ofstream file{_filename, std::ios::binary | std::ios::trunc};
+        file.write(_data, static_cast<std::streamsize>(_size));
+        if (!file) {
+            throw std::runtime_error("Could not write file " + _filename + ".");
+        }
+#endif
+    }
+
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "polyhedralGravity/input/MappedFile.h"
+#include "polyhedralGravity/model/GravityModelData.h"
+#include "polyhedralGravity/util/UtilityBinary.h"
+
+namespace polyhedralGravity {
+
+    /**
+     * A pre-sized, writable, memory-mapped result file for a batch of computation points.
+     * The file is a NumPy .npy file containing a float64 array of shape (10, N) in native byte order, whose rows are
+     * V, Vx, Vy, Vz, Vxx, Vyy, Vzz, Vxy, Vxz, Vyz. This is exactly the structure-of-arrays layout of
+     * {@link GravityModelResultSpans}, so that {@link GravityEvaluable::evaluate} writes the results directly into
+     * the page cache and the operating system writes them back to disk without any intermediate copy.
+     * The results hence do not need to fit into memory. The file can be opened with numpy.load(mmap_mode='r').
+     * On systems without memory-mapping, the results are buffered in memory and written by {@link flush}.
+     */
+    class MappedResultFile {
+
+        /** The size of the .npy header in bytes, a multiple of 64 */
+        static constexpr size_t HEADER_SIZE = 128;
+
+        /** The number of values per computation point */
+        static constexpr size_t COMPONENTS = 10;
+
+        /** The name of the file */
+        const std::string _filename;
+
+        /** The number of computation points */
+        const size_t _count;
+
+        /** The size of the file in bytes */
+        const size_t _size;
+
+        /** Pointer to the beginning of the file's content */
+        char *_data{nullptr};
+
+        /** The content of the file if memory-mapping is not available */
+        std::vector<char> _buffer{};
+
+    public:
+
+        /**
+         * Creates (or truncates) the file with space for the results of the given number of computation points
+         * and maps it into memory. The results are initialized with zero.
+         * @param filename the file's name
+         * @param count the number of computation points
+         * @throws std::runtime_error if the file cannot be created or mapped
+         */
+        MappedResultFile(const std::string &filename, size_t count);
+
+        MappedResultFile(const MappedResultFile &) = delete;
+
+        MappedResultFile &operator=(const MappedResultFile &) = delete;
+
+        /**
+         * Flushes and unmaps the file (errors are ignored, call {@link flush} to detect them).
+         */
+        ~MappedResultFile();
+
+        /**
+         * Returns the output arrays for the results, each with one element per computation point.
+         * @return the spans residing in the mapped file
+         */
+        [[nodiscard]] GravityModelResultSpans spans() const;
+
+        /**
+         * Returns the number of computation points.
+         * @return the number of points
+         */
+        [[nodiscard]] size_t size() const {
+            return _count;
+        }
+
+        /**
+         * Writes the results back to the file and waits for completion.
+         * @throws std::runtime_error if the file cannot be written
+         */
+        void flush();
+
+    };
+
+}
@@ -0,0 +1,89 @@
+#include "NpyResultWriter.h"
+
+namespace polyhedralGravity {
+
+    NpyResultWriter::NpyResultWriter(const std::string &filename, bool separateArrays) {
+        const std::string type = util::nativeByteOrder() == util::ByteOrder::LITTLE ? "'<f8'" : "'>f8'";
+        if (separateArrays) {
+            const size_t extension = std::min(filename.rfind(".npy"), filename.size());
+            const auto separateFilename = [&filename, extension](const std::string &suffix) {
+                return filename.substr(0, extension) + suffix + filename.substr(extension);
+            };
+            _arrays.push_back({{}, separateFilename("_points"), type, 0, 3, "3"});
+            _arrays.push_back({{}, separateFilename("_potential"), type, 3, 1, ""});
+            _arrays.push_back({{}, separateFilename("_acceleration"), type, 4, 3, "3"});
+            _arrays.push_back({{}, separateFilename("_tensor"), type, 7, 6, "6"});
+        } else {
+            const std::string descr = "[('point', " + type + ", (3,)), ('potential', " + type + "), "
+                                      "('acceleration', " + type + ", (3,)), ('tensor', " + type + ", (6,))]";
+            _arrays.push_back({{}, filename, descr, 0, VALUES_PER_ROW, ""});
+        }
+        for (Array &array: _arrays) {
+            array.stream.open(array.filename, std::ios::binary | std::ios::trunc);
+            if (!array.stream.is_open()) {
+                throw std::runtime_error("The file " + array.filename + " could not be created.");
+            }
+            writeHeader(array, 0);
+        }
+    }
+
+    NpyResultWriter::~NpyResultWriter() {
+        try {
+            close();
+        } catch (const std::exception &e) {
+            POLYHEDRAL_GRAVITY_LOG_ERROR("{}", e.what());
+        }
+    }
+
+    void NpyResultWriter::write(const std::vector<Array3> &computationPoints,
+                                const std::vector<GravityModelResult> &gravityResults) {
+        flatten(computationPoints, gravityResults, _buffer);
+        const size_t rows = _buffer.size() / VALUES_PER_ROW;
+        for (Array &array: _arrays) {
+            const double *data = _buffer.data();
+            // The structured array has the same layout as the rows, the separate arrays are gathered first
+            if (array.width != VALUES_PER_ROW) {
+                _column.resize(rows * array.width);
+                for (size_t i = 0; i < rows; ++i) {
+                    std::copy_n(_buffer.data() + i * VALUES_PER_ROW + array.first, array.width,
+                                _column.data() + i * array.width);
+                }
+                data = _column.data();
+            }
+            array.stream.write(reinterpret_cast<const char *>(data),
+                               static_cast<std::streamsize>(rows * array.width * sizeof(double)));
+            if (!array.stream) {
+                throw std::runtime_error("The file " + array.filename + " could not be written.");
+            }
+        }
+        _rows += rows;
+    }
+
+    void NpyResultWriter::close() {
+        for (Array &array: _arrays) {
+            if (!array.stream.is_open()) {
+                continue;
+            }
+            array.stream.seekp(0);
+            writeHeader(array, _rows);
+            array.stream.close();
+            if (!array.stream) {
+                throw std::runtime_error("The file " + array.filename + " could not be written.");
+            }
+        }
+    }
+
+    void NpyResultWriter::writeHeader(Array &array, size_t rows) {
+        const std::string shape = "(" + std::to_string(rows) + (array.rowShape.empty() ? ",)" : ", " + array.rowShape + ")");
+        std::string header = "{'descr': " + array.descr + ", 'fortran_order': False, 'shape': " + shape + ", }";
+        // The dictionary is padded with spaces and terminated by a newline, so that the data is 64-byte aligned.
+        // The longest dictionary (structured array with a 20-digit row count) has less than 200 characters.
+        header.resize(HEADER_SIZE - 10 - 1, ' ');
+        header.push_back('\n');
+        std::array<char, 10> preamble{'\x93', 'N', 'U', 'M', 'P', 'Y', '\x01', '\x00',
+                                      static_cast<char>(header.size() & 0xFF), static_cast<char>(header.size() >> 8)};
+        array.stream.write(preamble.data(), preamble.size());
+        array.stream.write(header.data(), static_cast<std::streamsize>(header.size()));
+    }
+
+}
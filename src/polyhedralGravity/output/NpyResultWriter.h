@@ -0,0 +1,92 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ResultWriter.h"
+#include "polyhedralGravity/output/Logging.h"
+#include "polyhedralGravity/util/UtilityBinary.h"
+
+namespace polyhedralGravity {
+
+    /**
+     * Writes the results as NumPy .npy file(s) of float64 values in the native byte order.
+     * Either one structured array of shape (N,) with the fields point (3), potential, acceleration (3), and
+     * tensor (6) is written, or four separate arrays of the shapes (N, 3), (N,), (N, 3), and (N, 6) whose
+     * files are suffixed with _points, _potential, _acceleration, and _tensor.
+     * Every chunk is written with a single write call per file. Since the number of rows is not known in advance,
+     * the header is written with a fixed size and its shape is completed by {@link close}.
+     * @see Refer to https://numpy.org/doc/stable/reference/generated/numpy.lib.format.html for the format
+     */
+    class NpyResultWriter final : public ResultWriter {
+
+        /** The size of the header (including magic string and version) in bytes, a multiple of 64 */
+        static constexpr size_t HEADER_SIZE = 256;
+
+        /**
+         * One .npy file containing some of the values of every row.
+         * @note This struct is basically a named tuple
+         */
+        struct Array {
+            /** The output stream */
+            std::ofstream stream;
+            /** The name of the file */
+            std::string filename;
+            /** The data type of one row in NumPy's notation */
+            std::string descr;
+            /** The index of the first value of a row contained in this file */
+            size_t first;
+            /** The number of values of a row contained in this file */
+            size_t width;
+            /** The shape of one row, empty for scalars and the structured array */
+            std::string rowShape;
+        };
+
+        /** The output files, one if the array is structured */
+        std::vector<Array> _arrays{};
+
+        /** The number of rows written so far */
+        size_t _rows{0};
+
+        /** Buffer for the rows of one chunk */
+        std::vector<double> _buffer{};
+
+        /** Buffer for the values of one separate array */
+        std::vector<double> _column{};
+
+    public:
+
+        /**
+         * Creates a new NpyResultWriter, existing files are truncated.
+         * @param filename the output file, with separate arrays the suffixes are inserted before the extension
+         * @param separateArrays if true, four separate arrays are written instead of one structured array
+         * @throws std::runtime_error if a file cannot be created
+         */
+        NpyResultWriter(const std::string &filename, bool separateArrays);
+
+        /**
+         * Completes the headers if {@link close} has not been called yet (errors are only logged).
+         */
+        ~NpyResultWriter() override;
+
+        void write(const std::vector<Array3> &computationPoints,
+                   const std::vector<GravityModelResult> &gravityResults) override;
+
+        void close() override;
+
+    private:
+
+        /**
+         * Writes the fixed-size header of one array at the current position of its stream.
+         * @param array the array
+         * @param rows the number of rows
+         */
+        static void writeHeader(Array &array, size_t rows);
+
+    };
+
+}
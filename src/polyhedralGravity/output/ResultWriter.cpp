@@ -0,0 +1,40 @@
+#include "ResultWriter.h"
+
+#include "BinaryResultWriter.h"
+#include "CSVWriter.h"
+#include "NpyResultWriter.h"
+#include "polyhedralGravity/util/UtilityString.h"
+
+namespace polyhedralGravity {
+
+    std::unique_ptr<ResultWriter> ResultWriter::fromFile(const std::string &filename, bool separateArrays) {
+        if (util::ends_with(filename, ".npy")) {
+            return std::make_unique<NpyResultWriter>(filename, separateArrays);
+        } else if (util::ends_with(filename, ".bin")) {
+            return std::make_unique<BinaryResultWriter>(filename);
+        } else {
+            return std::make_unique<CSVWriter>(filename);
+        }
+    }
+
+    void ResultWriter::flatten(const std::vector<Array3> &computationPoints,
+                               const std::vector<GravityModelResult> &gravityResults, std::vector<double> &buffer) {
+        const size_t rows = countRows(computationPoints, gravityResults);
+        buffer.resize(rows * VALUES_PER_ROW);
+        auto countingIterator = thrust::make_counting_iterator<size_t>(0);
+        thrust::for_each(thrust::device, countingIterator, countingIterator + rows, [&](const size_t i) {
+            const auto &[potential, acceleration, secondDerivative] = gravityResults[i];
+            double *row = buffer.data() + i * VALUES_PER_ROW;
+            std::copy(computationPoints[i].cbegin(), computationPoints[i].cend(), row);
+            row[3] = potential;
+            std::copy(acceleration.cbegin(), acceleration.cend(), row + 4);
+            std::copy(secondDerivative.cbegin(), secondDerivative.cend(), row + 7);
+        });
+    }
+
+    size_t ResultWriter::countRows(const std::vector<Array3> &computationPoints,
+                                   const std::vector<GravityModelResult> &gravityResults) {
+        return std::min(computationPoints.size(), gravityResults.size());
+    }
+
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "polyhedralGravity/model/GravityModelData.h"
+#include "polyhedralGravity/model/PolyhedronDefinitions.h"
+#include "thrust/for_each.h"
+#include "thrust/execution_policy.h"
+#include "thrust/iterator/counting_iterator.h"
+
+namespace polyhedralGravity {
+
+    /**
+     * Interface for writing the results of the polyhedral gravity model to a file.
+     * Every row consists of the computation point, the potential, the acceleration, and the second derivative
+     * gravity tensor, i.e. {@link VALUES_PER_ROW} values: x, y, z, V, Vx, Vy, Vz, Vxx, Vyy, Vzz, Vxy, Vxz, Vyz.
+     * The results may be appended chunk by chunk via repeated calls of {@link write}.
+     */
+    class ResultWriter {
+
+    public:
+
+        /** The number of values of one computation point and its result */
+        static constexpr size_t VALUES_PER_ROW = 13;
+
+        /** Default Virtual Destructor */
+        virtual ~ResultWriter() = default;
+
+        /**
+         * Appends the results to the file.
+         * @param computationPoints vector of computation points
+         * @param gravityResults vector of gravity results (one per computation point)
+         * @throws std::runtime_error if the file cannot be written
+         */
+        virtual void write(const std::vector<Array3> &computationPoints,
+                           const std::vector<GravityModelResult> &gravityResults) = 0;
+
+        /**
+         * Finalizes and closes the file. Writers which must complete their file's header (e.g. the .npy writer)
+         * do so here. Called by the destructor if not called explicitly, however only an explicit call reports errors.
+         * @throws std::runtime_error if the file cannot be written
+         */
+        virtual void close() {}
+
+        /**
+         * Creates a writer for the given file. The format is determined by the suffix:
+         * .npy (NumPy array), .bin (raw binary float64 values in native byte order), otherwise CSV.
+         * @param filename the output file
+         * @param separateArrays only for .npy, if true the points, potentials, accelerations, and tensors are written
+         * to four separate .npy files instead of one structured array
+         * @return the writer
+         * @throws std::runtime_error if the file cannot be created
+         */
+        static std::unique_ptr<ResultWriter> fromFile(const std::string &filename, bool separateArrays = false);
+
+    protected:
+
+        /**
+         * Flattens the computation points and their results into consecutive rows of {@link VALUES_PER_ROW} doubles.
+         * The rows are filled in parallel.
+         * @param computationPoints vector of computation points
+         * @param gravityResults vector of gravity results
+         * @param buffer the output, resized to the number of rows times VALUES_PER_ROW (its capacity is retained)
+         */
+        static void flatten(const std::vector<Array3> &computationPoints,
+                            const std::vector<GravityModelResult> &gravityResults, std::vector<double> &buffer);
+
+        /**
+         * Returns the number of complete rows, i.e. the minimum of the number of points and results.
+         * @param computationPoints vector of computation points
+         * @param gravityResults vector of gravity results
+         * @return the number of rows
+         */
+        static size_t countRows(const std::vector<Array3> &computationPoints,
+                                const std::vector<GravityModelResult> &gravityResults);
+
+    };
+
+}
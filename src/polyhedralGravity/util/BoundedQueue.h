@@ -0,0 +1,163 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace polyhedralGravity::util {
+
+    /**
+     * The occupancy of a {@link BoundedQueue} over its lifetime.
+     * @note This struct is basically a named tuple
+     */
+    struct QueueOccupancy {
+        /** The maximal number of elements the queue can hold */
+        size_t capacity;
+        /** The time-weighted mean number of elements */
+        double mean;
+        /** The maximal number of elements */
+        size_t maximum;
+    };
+
+    /**
+     * A thread-safe FIFO queue with a fixed capacity connecting a producer and a consumer.
+     * Pushing blocks while the queue is full, popping blocks while it is empty. This bounds the memory of a pipeline
+     * and makes a faster stage wait for a slower one.
+     * The queue additionally records its time-weighted occupancy, i.e. whether it is usually full
+     * (the consumer is the bottleneck) or empty (the producer is the bottleneck).
+     * @tparam T the type of the elements
+     */
+    template<typename T>
+    class BoundedQueue {
+
+        /** The maximal number of elements */
+        const size_t _capacity;
+
+        /** The elements */
+        std::deque<T> _elements{};
+
+        /** True if no more elements are pushed */
+        bool _closed{false};
+
+        /** Guards every member */
+        mutable std::mutex _mutex{};
+
+        /** Notified if an element was pushed or the queue was closed */
+        std::condition_variable _notEmpty{};
+
+        /** Notified if an element was popped or the queue was closed */
+        std::condition_variable _notFull{};
+
+        /** The point in time (in seconds) the queue was created */
+        const double _created{now()};
+
+        /** The point in time (in seconds) the number of elements last changed */
+        double _lastChange{_created};
+
+        /** The integral of the number of elements over time in seconds */
+        double _occupancyIntegral{0.0};
+
+        /** The maximal number of elements */
+        size_t _maximum{0};
+
+    public:
+
+        /**
+         * Creates a new empty BoundedQueue.
+         * @param capacity the maximal number of elements, at least one
+         */
+        explicit BoundedQueue(size_t capacity) : _capacity{std::max<size_t>(capacity, 1)} {}
+
+        /**
+         * Appends an element, blocks while the queue is full.
+         * @param element the element
+         * @return true if the element was appended, false if the queue has been closed
+         */
+        bool push(T element) {
+            std::unique_lock lock{_mutex};
+            _notFull.wait(lock, [this] { return _closed || _elements.size() < _capacity; });
+            if (_closed) {
+                return false;
+            }
+            recordOccupancy();
+            _elements.push_back(std::move(element));
+            _maximum = std::max(_maximum, _elements.size());
+            lock.unlock();
+            _notEmpty.notify_one();
+            return true;
+        }
+
+        /**
+         * Removes the first element, blocks while the queue is empty and not closed.
+         * The remaining elements of a closed queue are still returned.
+         * @return the element or std::nullopt if the queue is closed and empty
+         */
+        std::optional<T> pop() {
+            std::unique_lock lock{_mutex};
+            _notEmpty.wait(lock, [this] { return _closed || !_elements.empty(); });
+            if (_elements.empty()) {
+                return std::nullopt;
+            }
+            recordOccupancy();
+            std::optional<T> element{std::move(_elements.front())};
+            _elements.pop_front();
+            lock.unlock();
+            _notFull.notify_one();
+            return element;
+        }
+
+        /**
+         * Closes the queue, i.e. no more elements can be pushed and waiting threads are woken up.
+         * @param discard if true, the remaining elements are dropped as well (e.g. if a stage failed)
+         */
+        void close(bool discard = false) {
+            {
+                std::lock_guard lock{_mutex};
+                _closed = true;
+                if (discard) {
+                    recordOccupancy();
+                    _elements.clear();
+                }
+            }
+            _notEmpty.notify_all();
+            _notFull.notify_all();
+        }
+
+        /**
+         * Returns the occupancy of the queue since its creation.
+         * @return the capacity, the time-weighted mean, and the maximal number of elements
+         */
+        QueueOccupancy occupancy() const {
+            std::lock_guard lock{_mutex};
+            const double current = now();
+            const double integral = _occupancyIntegral + static_cast<double>(_elements.size()) * (current - _lastChange);
+            const double lifetime = current - _created;
+            return {_capacity, lifetime > 0.0 ? integral / lifetime : 0.0, _maximum};
+        }
+
+    private:
+
+        /**
+         * Adds the duration of the current number of elements to the occupancy integral, called before any change.
+         */
+        void recordOccupancy() {
+            const double current = now();
+            _occupancyIntegral += static_cast<double>(_elements.size()) * (current - _lastChange);
+            _lastChange = current;
+        }
+
+        /**
+         * Returns the current point in time of a monotonic clock.
+         * @return the time in seconds
+         */
+        static double now() {
+            return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+    };
+
+}
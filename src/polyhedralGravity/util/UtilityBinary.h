@@ -0,0 +1,81 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace polyhedralGravity::util {
+
+    /**
+     * The byte order of binary data.
+     */
+    enum class ByteOrder : char {
+        /** Least significant byte first */
+        LITTLE,
+        /** Most significant byte first */
+        BIG,
+    };
+
+    /**
+     * Returns the byte order of the machine running the program.
+     * @return the native byte order
+     */
+    inline ByteOrder nativeByteOrder() {
+        const uint16_t probe = 1;
+        unsigned char firstByte;
+        std::memcpy(&firstByte, &probe, 1);
+        return firstByte == 1 ? ByteOrder::LITTLE : ByteOrder::BIG;
+    }
+
+    /**
+     * Reads a trivially copyable value from (possibly unaligned) binary data.
+     * @tparam T the type of the value
+     * @param data pointer to the first byte of the value
+     * @param byteOrder the byte order of the data, the bytes are swapped if it differs from the native byte order
+     * @return the value
+     */
+    template<typename T>
+    inline T readBinary(const char *data, ByteOrder byteOrder) {
+        unsigned char bytes[sizeof(T)];
+        std::memcpy(bytes, data, sizeof(T));
+        if (byteOrder != nativeByteOrder()) {
+            std::reverse(bytes, bytes + sizeof(T));
+        }
+        T value;
+        std::memcpy(&value, bytes, sizeof(T));
+        return value;
+    }
+
+    /** The offset basis of the 64-bit FNV-1a hash */
+    constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+
+    /** The prime of the 64-bit FNV-1a hash */
+    constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+    /**
+     * Continues a 64-bit FNV-1a hash with the given bytes.
+     * @param hash the hash so far, initially {@link FNV_OFFSET_BASIS}
+     * @param data pointer to the first byte
+     * @param size the number of bytes
+     */
+    inline void fnv1a(uint64_t &hash, const char *data, size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= static_cast<unsigned char>(data[i]);
+            hash *= FNV_PRIME;
+        }
+    }
+
+    /**
+     * Continues a 64-bit FNV-1a hash with the bytes of a trivially copyable value.
+     * @tparam T the type of the value
+     * @param hash the hash so far, initially {@link FNV_OFFSET_BASIS}
+     * @param value the value
+     */
+    template<typename T>
+    inline void fnv1a(uint64_t &hash, const T &value) {
+        char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        fnv1a(hash, bytes, sizeof(T));
+    }
+
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace polyhedralGravity::util {
+
+    /**
+     * The number of bits per coordinate of the space-filling curve keys, three coordinates fit into a 64-bit key.
+     */
+    constexpr unsigned int SPACE_FILLING_CURVE_BITS = 21;
+
+    /**
+     * Interleaves the bits of three coordinates, the most significant bit of the first coordinate becomes the
+     * most significant bit of the key.
+     * @param coordinates the coordinates with {@link SPACE_FILLING_CURVE_BITS} bits each
+     * @return the interleaved 63-bit key
+     */
+    inline uint64_t interleaveBits(const std::array<uint32_t, 3> &coordinates) {
+        uint64_t key{0};
+        for (unsigned int bit = SPACE_FILLING_CURVE_BITS; bit-- > 0;) {
+            for (const uint32_t coordinate: coordinates) {
+                key = (key << 1) | ((coordinate >> bit) & 1u);
+            }
+        }
+        return key;
+    }
+
+    /**
+     * Returns the position of a grid cell along the Morton (Z-order) curve.
+     * @param coordinates the cell's coordinates with {@link SPACE_FILLING_CURVE_BITS} bits each
+     * @return the Morton key
+     */
+    inline uint64_t mortonKey(const std::array<uint32_t, 3> &coordinates) {
+        return interleaveBits(coordinates);
+    }
+
+    /**
+     * Returns the position of a grid cell along the Hilbert curve. In contrast to the Morton curve,
+     * consecutive cells along the Hilbert curve are always neighbours.
+     * The coordinates are transformed into the transposed Hilbert index (J. Skilling, "Programming the Hilbert curve",
+     * AIP Conference Proceedings 707, 2004), whose interleaved bits form the key.
+     * @param coordinates the cell's coordinates with {@link SPACE_FILLING_CURVE_BITS} bits each
+     * @return the Hilbert key
+     */
+    inline uint64_t hilbertKey(std::array<uint32_t, 3> coordinates) {
+        auto &x = coordinates;
+        // Inverse undo of the excess work
+        for (uint32_t q = 1u << (SPACE_FILLING_CURVE_BITS - 1); q > 1; q >>= 1) {
+            const uint32_t p = q - 1;
+            for (size_t i = 0; i < x.size(); ++i) {
+                if (x[i] & q) {
+                    x[0] ^= p;
+                } else {
+                    const uint32_t t = (x[0] ^ x[i]) & p;
+                    x[0] ^= t;
+                    x[i] ^= t;
+                }
+            }
+        }
+        // Gray encoding
+        for (size_t i = 1; i < x.size(); ++i) {
+            x[i] ^= x[i - 1];
+        }
+        uint32_t t{0};
+        for (uint32_t q = 1u << (SPACE_FILLING_CURVE_BITS - 1); q > 1; q >>= 1) {
+            if (x[x.size() - 1] & q) {
+                t ^= q - 1;
+            }
+        }
+        for (uint32_t &value: x) {
+            value ^= t;
+        }
+        return interleaveBits(x);
+    }
+
+    /**
+     * Quantizes points to the cells of the space-filling curves. The grid of
+     * 2^{@link SPACE_FILLING_CURVE_BITS} cells per axis spans the bounding cube of a set of points,
+     * so that the cells are cubes. Points outside the cube are clamped to its boundary.
+     */
+    class SpaceFillingCurveGrid {
+
+        /** The corner of the bounding cube with the minimal coordinates */
+        std::array<double, 3> _minimum{};
+
+        /** The number of cells per unit of length */
+        double _scale{0.0};
+
+    public:
+
+        /**
+         * Creates the grid spanning the bounding cube of the given points.
+         * @tparam InputIt an input iterator whose elements are std::array<double, 3>
+         * @param first the beginning of the points
+         * @param last the end of the points
+         */
+        template<typename InputIt>
+        SpaceFillingCurveGrid(InputIt first, InputIt last) {
+            constexpr double infinity = std::numeric_limits<double>::infinity();
+            std::array<double, 3> maximum{-infinity, -infinity, -infinity};
+            _minimum = {infinity, infinity, infinity};
+            for (; first != last; ++first) {
+                for (size_t axis = 0; axis < _minimum.size(); ++axis) {
+                    _minimum[axis] = std::min(_minimum[axis], (*first)[axis]);
+                    maximum[axis] = std::max(maximum[axis], (*first)[axis]);
+                }
+            }
+            double extent{0.0};
+            for (size_t axis = 0; axis < _minimum.size(); ++axis) {
+                extent = std::max(extent, maximum[axis] - _minimum[axis]);
+            }
+            _scale = extent > 0.0 ? static_cast<double>((1u << SPACE_FILLING_CURVE_BITS) - 1) / extent : 0.0;
+        }
+
+        /**
+         * Returns the cell containing the given point.
+         * @param point the point
+         * @return the cell's coordinates with {@link SPACE_FILLING_CURVE_BITS} bits each
+         */
+        [[nodiscard]] std::array<uint32_t, 3> cell(const std::array<double, 3> &point) const {
+            constexpr double maximalCell = static_cast<double>((1u << SPACE_FILLING_CURVE_BITS) - 1);
+            std::array<uint32_t, 3> cell{};
+            for (size_t axis = 0; axis < cell.size(); ++axis) {
+                // The negated comparison maps NaN to the first cell
+                const double position = (point[axis] - _minimum[axis]) * _scale;
+                cell[axis] = !(position > 0.0) ? 0u : static_cast<uint32_t>(std::min(position, maximalCell));
+            }
+            return cell;
+        }
+
+    };
+
+}
@@ -1,7 +1,13 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <vector>
 #include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
 
 namespace polyhedralGravity::util {
 
@@ -22,4 +28,116 @@ namespace polyhedralGravity::util {
         }
         return false;
     }
-}
\ No newline at end of file
+
+    /**
+     * Returns true if the character is a space, a tab or a carriage return, i.e. whitespace within a line.
+     * @param c the character
+     * @return true if whitespace
+     */
+    inline bool isBlank(char c) {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+    }
+
+    /**
+     * Skips the whitespace within a line.
+     * @param first the beginning of the character range
+     * @param last the end of the character range
+     * @return pointer to the first non-whitespace character or last
+     */
+    inline const char *skipBlanks(const char *first, const char *last) {
+        while (first != last && isBlank(*first)) {
+            ++first;
+        }
+        return first;
+    }
+
+    /**
+     * Skips the current token, i.e. everything until the next whitespace.
+     * @param first the beginning of the character range
+     * @param last the end of the character range
+     * @return pointer to the first whitespace character after the token or last
+     */
+    inline const char *skipToken(const char *first, const char *last) {
+        while (first != last && !isBlank(*first)) {
+            ++first;
+        }
+        return first;
+    }
+
+    /**
+     * Parses a number after skipping leading whitespace without allocating, i.e. the character range
+     * does not need to be null-terminated (e.g. a memory-mapped file).
+     * Integers are parsed with std::from_chars. Floating point numbers are parsed with std::from_chars where
+     * the standard library supports it, otherwise with std::strtod on a small copy of the token.
+     * @tparam T the type of the number
+     * @param first the beginning of the character range
+     * @param last the end of the character range
+     * @param value the parsed value
+     * @return pointer to the first character after the number or nullptr if no number could be parsed
+     */
+    template<typename T>
+    inline const char *parseNumber(const char *first, const char *last, T &value) {
+        first = skipBlanks(first, last);
+        if (first != last && *first == '+') {
+            ++first;
+        }
+        if constexpr (std::is_floating_point_v<T>) {
+#if defined(__cpp_lib_to_chars)
+            const auto [end, error] = std::from_chars(first, last, value);
+            return error == std::errc{} ? end : nullptr;
+#else
+            char token[64]{};
+            const size_t length = std::min<size_t>(skipToken(first, last) - first, sizeof(token) - 1);
+            std::memcpy(token, first, length);
+            char *end = nullptr;
+            value = static_cast<T>(std::strtod(token, &end));
+            return end != token ? first + (end - token) : nullptr;
+#endif
+        } else {
+            const auto [end, error] = std::from_chars(first, last, value);
+            return error == std::errc{} ? end : nullptr;
+        }
+    }
+
+    /**
+     * Splits a text into (roughly) equally sized chunks whose boundaries are line boundaries.
+     * Used to parse large files in parallel, since every chunk contains only complete lines.
+     * @param text the text
+     * @param chunkCount the desired number of chunks, fewer chunks are returned if the text has fewer lines
+     * @return the chunks, together they cover the whole text
+     */
+    inline std::vector<std::string_view> splitIntoLineChunks(std::string_view text, size_t chunkCount) {
+        std::vector<std::string_view> chunks{};
+        chunks.reserve(chunkCount);
+        const size_t chunkSize = text.size() / std::max<size_t>(chunkCount, 1) + 1;
+        size_t begin = 0;
+        while (begin < text.size()) {
+            size_t end = std::min(begin + chunkSize, text.size());
+            // Move the end behind the next line break, so that no line is split
+            const size_t lineBreak = text.find('\n', end == 0 ? 0 : end - 1);
+            end = lineBreak == std::string_view::npos ? text.size() : lineBreak + 1;
+            chunks.push_back(text.substr(begin, end - begin));
+            begin = end;
+        }
+        return chunks;
+    }
+
+    /**
+     * Calls the given function for every line of the text (without the line break).
+     * @tparam Function callable with a std::string_view
+     * @param text the text
+     * @param function the function called for every line
+     */
+    template<typename Function>
+    inline void forEachLine(std::string_view text, Function &&function) {
+        size_t begin = 0;
+        while (begin < text.size()) {
+            size_t end = text.find('\n', begin);
+            if (end == std::string_view::npos) {
+                end = text.size();
+            }
+            function(text.substr(begin, end - begin));
+            begin = end + 1;
+        }
+    }
+}
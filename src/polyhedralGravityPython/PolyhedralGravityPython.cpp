@@ -1,20 +1,331 @@
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
 #include <tuple>
 #include <variant>
 #include <string>
+#include <string_view>
 #include <array>
 #include <vector>
 #include "pybind11/pybind11.h"
+#include "pybind11/numpy.h"
 #include "pybind11/stl.h"
 
 #include "polyhedralGravity/Info.h"
+#include "polyhedralGravity/input/PointSource.h"
+#include "polyhedralGravity/model/CoalescingGravityEvaluable.h"
 #include "polyhedralGravity/model/GravityEvaluable.h"
 #include "polyhedralGravity/model/GravityModel.h"
 #include "polyhedralGravity/model/GravityModelData.h"
+#include "polyhedralGravity/model/IntegrityCache.h"
+#include "polyhedralGravity/model/NumaGravityEvaluable.h"
+#include "polyhedralGravity/model/Parallelization.h"
+#include "polyhedralGravity/model/Snapshot.h"
+#include "polyhedralGravity/model/WorkerTeam.h"
 #include "polyhedralGravity/model/Polyhedron.h"
+#include "polyhedralGravity/util/UtilityBinary.h"
 
 
 namespace py = pybind11;
 
+namespace {
+
+    /**
+     * Calls the given function with the GIL released, so that other Python threads run in the meantime.
+     * The function must not touch Python objects, i.e. all its inputs must already be converted to C++.
+     * @param function the function to call
+     * @return the function's result
+     */
+    template<typename Function>
+    auto withoutGil(Function &&function) {
+        py::gil_scoped_release release{};
+        return function();
+    }
+
+    /**
+     * Overrides the number of threads of the current thread's evaluations if a number is given.
+     * The scope must live on the thread running the evaluation, i.e. around the call of {@link withoutGil}.
+     * @param scope the scope to emplace
+     * @param threads the maximal number of threads or std::nullopt to keep the current settings
+     */
+    void limitThreads(std::optional<polyhedralGravity::ParallelizationScope> &scope, const std::optional<size_t> &threads) {
+        if (threads.has_value()) {
+            scope.emplace(threads.value());
+        }
+    }
+
+    /**
+     * Point source drawing the computation points from an arbitrary Python iterable (e.g. a generator),
+     * so that the points are only materialized chunk by chunk.
+     * It may be read with the GIL released, it acquires the GIL itself.
+     */
+    class IterablePointSource final : public polyhedralGravity::PointSource {
+
+        py::iterator _iterator;
+
+    public:
+
+        explicit IterablePointSource(const py::iterable &iterable) : _iterator{py::iter(iterable)} {}
+
+        size_t read(std::vector<polyhedralGravity::Array3> &points, size_t maxCount) override {
+            py::gil_scoped_acquire acquire{};
+            points.clear();
+            for (; _iterator != py::iterator::sentinel() && points.size() < maxCount; ++_iterator) {
+                points.push_back(_iterator->cast<polyhedralGravity::Array3>());
+            }
+            return points.size();
+        }
+
+        [[nodiscard]] std::optional<size_t> size() const override {
+            return std::nullopt;
+        }
+
+    };
+
+    /** A C-contiguous float64 NumPy array */
+    using NumpyArray = py::array_t<double, py::array::c_style>;
+
+    static_assert(sizeof(polyhedralGravity::Array3) == 3 * sizeof(double), "Array3 must match a NumPy row of shape (3,)");
+    static_assert(sizeof(polyhedralGravity::Array6) == 6 * sizeof(double), "Array6 must match a NumPy row of shape (6,)");
+
+    /**
+     * Copies the rows of an (N, 3) NumPy array into a vector with a single memcpy, i.e. without per-element conversion.
+     * @param array the C-contiguous array
+     * @param name the name of the array used in the error message
+     * @return the rows
+     * @throws std::invalid_argument if the array is not of shape (N, 3)
+     */
+    template<typename T>
+    std::vector<std::array<T, 3>> copyRows(const py::array_t<T, py::array::c_style | py::array::forcecast> &array,
+                                           const std::string &name) {
+        if (array.ndim() != 2 || array.shape(1) != 3) {
+            throw std::invalid_argument("The " + name + " must be an array of shape (N, 3).");
+        }
+        std::vector<std::array<T, 3>> rows(static_cast<size_t>(array.shape(0)));
+        std::memcpy(rows.data(), array.data(), rows.size() * sizeof(std::array<T, 3>));
+        return rows;
+    }
+
+    /**
+     * Returns a read-only NumPy view of shape (N, 3) onto the given rows without copying them.
+     * The view keeps the owner of the rows alive.
+     * @param rows the rows, they must not be modified during the owner's lifetime
+     * @param owner the Python object owning the rows
+     * @return the view
+     */
+    template<typename T>
+    py::array_t<T> readOnlyView(const std::vector<std::array<T, 3>> &rows, const py::handle &owner) {
+        py::array_t<T> view({static_cast<py::ssize_t>(rows.size()), py::ssize_t{3}},
+                            reinterpret_cast<const T *>(rows.data()), owner);
+        view.attr("flags").attr("writeable") = false;
+        return view;
+    }
+
+    /**
+     * Returns a read-only NumPy byte array viewing the given memory without copying it.
+     * The view keeps the owner of the memory alive.
+     * @param data the memory, it must not be modified during the owner's lifetime
+     * @param size the size in bytes
+     * @param owner the Python object owning the memory
+     * @return the view
+     */
+    py::array_t<uint8_t> readOnlyBytes(const void *data, size_t size, const py::handle &owner) {
+        py::array_t<uint8_t> view({static_cast<py::ssize_t>(size)}, static_cast<const uint8_t *>(data), owner);
+        view.attr("flags").attr("writeable") = false;
+        return view;
+    }
+
+    /**
+     * Returns the bytes of a C-contiguous buffer, e.g. of a bytes object or a pickle.PickleBuffer.
+     * @param buffer the buffer
+     * @return the bytes, valid as long as the buffer
+     * @throws std::invalid_argument if the buffer is not contiguous
+     */
+    std::string_view contiguousBytes(const py::buffer_info &buffer) {
+        py::ssize_t stride = buffer.itemsize;
+        for (py::ssize_t dimension = buffer.ndim - 1; dimension >= 0; --dimension) {
+            if (buffer.shape[dimension] > 1 && buffer.strides[dimension] != stride) {
+                throw std::invalid_argument("The buffers of a pickled GravityEvaluable must be contiguous.");
+            }
+            stride *= buffer.shape[dimension];
+        }
+        return {static_cast<const char *>(buffer.ptr), static_cast<size_t>(buffer.size * buffer.itemsize)};
+    }
+
+    /** The number of elements of the pickled state of a GravityEvaluable */
+    constexpr size_t GRAVITY_EVALUABLE_STATE_SIZE = 10;
+
+    /** The number of elements of the pickled state of a GravityEvaluable before the compact storage was introduced */
+    constexpr size_t DOUBLE_GRAVITY_EVALUABLE_STATE_SIZE = 9;
+
+    /**
+     * Returns the pickled state of a GravityEvaluable. The vertices, faces, and face caches are contiguous
+     * buffers in native byte order, so that no element is converted to a Python object.
+     * @param self the GravityEvaluable
+     * @param outOfBand if true, the buffers are pickle.PickleBuffer views (pickle protocol 5), otherwise bytes copies
+     * @return the state (byte order, density, orientation, metric unit, vertices, faces, segment vectors,
+     *          plane unit normals, segment unit normals, storage), the caches are empty in compact storage
+     */
+    py::tuple gravityEvaluableState(const py::object &self, bool outOfBand) {
+        using namespace polyhedralGravity;
+        const auto &evaluable = self.cast<const GravityEvaluable &>();
+        const Polyhedron &polyhedron = evaluable.getPolyhedron();
+        const auto [segmentVectors, planeUnitNormals, segmentUnitNormals] = evaluable.getCaches();
+        const size_t faceCount = polyhedron.countFaces();
+        const py::object pickleBuffer = py::module_::import("pickle").attr("PickleBuffer");
+        const auto buffer = [&](const void *data, size_t size) -> py::object {
+            // The compact caches are recomputed when unpickling
+            if (data == nullptr) {
+                return py::bytes{};
+            }
+            if (outOfBand) {
+                return pickleBuffer(readOnlyBytes(data, size, self));
+            }
+            return py::bytes(static_cast<const char *>(data), size);
+        };
+        return py::make_tuple(static_cast<int>(util::nativeByteOrder()), polyhedron.getDensity(),
+                              polyhedron.getOrientation(), polyhedron.getMeshUnit(),
+                              buffer(polyhedron.getVertices().data(), polyhedron.countVertices() * sizeof(Array3)),
+                              buffer(polyhedron.getFaces().data(), faceCount * sizeof(IndexArray3)),
+                              buffer(segmentVectors, faceCount * sizeof(Array3Triplet)),
+                              buffer(planeUnitNormals, faceCount * sizeof(Array3)),
+                              buffer(segmentUnitNormals, faceCount * sizeof(Array3Triplet)),
+                              evaluable.getStorage());
+    }
+
+    /**
+     * Restores a GravityEvaluable from its pickled state (see {@link gravityEvaluableState}).
+     * The face caches are used in-place if the buffers are suitably aligned (e.g. out-of-band buffers residing
+     * in shared memory), the buffers are then kept alive as long as the GravityEvaluable.
+     * @param state the state
+     * @return the GravityEvaluable
+     * @throws std::runtime_error if the state is malformed or of a foreign byte order
+     */
+    polyhedralGravity::GravityEvaluable gravityEvaluableFromState(const py::tuple &state) {
+        using namespace polyhedralGravity;
+        if (state[0].cast<int>() != static_cast<int>(util::nativeByteOrder())) {
+            throw std::runtime_error("Invalid state! The GravityEvaluable was pickled with a foreign byte order.");
+        }
+        const MeshStorage storage = state.size() == GRAVITY_EVALUABLE_STATE_SIZE ? state[9].cast<MeshStorage>() : MeshStorage::DOUBLE;
+        auto buffers = std::make_shared<std::vector<py::buffer_info>>();
+        std::vector<std::string_view> bytes{};
+        for (size_t i = 4; i < DOUBLE_GRAVITY_EVALUABLE_STATE_SIZE; ++i) {
+            buffers->push_back(state[i].cast<py::buffer>().request());
+            bytes.push_back(contiguousBytes(buffers->back()));
+        }
+        const size_t vertexCount = bytes[0].size() / sizeof(Array3);
+        const size_t faceCount = bytes[1].size() / sizeof(IndexArray3);
+        const size_t cacheCount = storage == MeshStorage::DOUBLE ? faceCount : 0;
+        if (bytes[0].size() != vertexCount * sizeof(Array3) || bytes[1].size() != faceCount * sizeof(IndexArray3) ||
+            bytes[2].size() != cacheCount * sizeof(Array3Triplet) || bytes[3].size() != cacheCount * sizeof(Array3) ||
+            bytes[4].size() != cacheCount * sizeof(Array3Triplet)) {
+            throw std::runtime_error("Invalid state! The buffers of the GravityEvaluable have inconsistent sizes.");
+        }
+        std::vector<Array3> vertices(vertexCount);
+        std::memcpy(vertices.data(), bytes[0].data(), bytes[0].size());
+        std::vector<IndexArray3> faces(faceCount);
+        std::memcpy(faces.data(), bytes[1].data(), bytes[1].size());
+        for (const IndexArray3 &face: faces) {
+            if (face[0] >= vertexCount || face[1] >= vertexCount || face[2] >= vertexCount) {
+                throw std::runtime_error("Invalid state! A face refers to a non-existing vertex.");
+            }
+        }
+        // The pickled polyhedron has already been checked (and healed)
+        Polyhedron polyhedron{std::move(vertices), std::move(faces), state[1].cast<double>(), state[2].cast<NormalOrientation>(),
+                              PolyhedronIntegrity::DISABLE, state[3].cast<MetricUnit>(), VertexIndexing::ZERO_BASED};
+        if (storage != MeshStorage::DOUBLE) {
+            return GravityEvaluable{std::move(polyhedron), storage};
+        }
+        const bool aligned = std::all_of(bytes.cbegin() + 2, bytes.cend(), [](const std::string_view &cache) {
+            return reinterpret_cast<uintptr_t>(cache.data()) % alignof(Array3Triplet) == 0;
+        });
+        if (!aligned) {
+            const auto copy = [](const std::string_view &cache, auto element) {
+                std::vector<decltype(element)> elements(cache.size() / sizeof(element));
+                std::memcpy(elements.data(), cache.data(), cache.size());
+                return elements;
+            };
+            return GravityEvaluable{std::move(polyhedron), copy(bytes[2], Array3Triplet{}), copy(bytes[3], Array3{}),
+                                    copy(bytes[4], Array3Triplet{})};
+        }
+        // The buffers may be released by any thread, however releasing them requires the GIL
+        const std::shared_ptr<const void> cacheOwner{buffers.get(), [buffers](const void *) mutable {
+            py::gil_scoped_acquire acquire{};
+            buffers.reset();
+        }};
+        return GravityEvaluable{std::move(polyhedron), cacheOwner, reinterpret_cast<const Array3Triplet *>(bytes[2].data()),
+                                reinterpret_cast<const Array3 *>(bytes[3].data()),
+                                reinterpret_cast<const Array3Triplet *>(bytes[4].data())};
+    }
+
+    /**
+     * Returns the given out array if it is a writable, C-contiguous float64 array of the given shape.
+     * @throws std::invalid_argument otherwise (ValueError in Python)
+     */
+    NumpyArray outputArray(const py::handle &array, const std::vector<py::ssize_t> &shape) {
+        if (!py::isinstance<NumpyArray>(array)) {
+            throw std::invalid_argument("The out arrays must be C-contiguous float64 NumPy arrays.");
+        }
+        auto result = py::reinterpret_borrow<NumpyArray>(array);
+        if (!result.writeable() || std::vector<py::ssize_t>(result.shape(), result.shape() + result.ndim()) != shape) {
+            throw std::invalid_argument("The out arrays must be writable and of shapes (N,), (N, 3) and (N, 6).");
+        }
+        return result;
+    }
+
+    /**
+     * Evaluates the polyhedral gravity model directly on the buffer of an (N, 3) array of computation points
+     * (it is only copied if it is no C-contiguous float64 array) and writes the results into NumPy arrays of
+     * shapes (N,), (N, 3) and (N, 6), which are either the given out arrays or newly allocated.
+     * @tparam Evaluable a GravityEvaluable or NumaGravityEvaluable
+     * @param evaluable the evaluable
+     * @param computationPoints an array-like of shape (N, 3)
+     * @param parallel if true, the points are evaluated in parallel
+     * @param out None or a tuple of three arrays (potential, acceleration, tensor) to reuse
+     * @param sortPoints if true, the points are evaluated along a Morton curve
+     * @return the tuple (potential, acceleration, tensor) of NumPy arrays
+     */
+    template<typename Evaluable>
+    py::tuple evaluateNumpy(const Evaluable &evaluable, const py::object &computationPoints,
+                            bool parallel, const py::object &out, bool sortPoints = false) {
+        using namespace polyhedralGravity;
+        const auto points = py::array_t<double, py::array::c_style | py::array::forcecast>::ensure(computationPoints);
+        if (!points || points.ndim() != 2 || points.shape(1) != 3) {
+            throw std::invalid_argument("The computation points must be an array of shape (N, 3).");
+        }
+        const py::ssize_t count = points.shape(0);
+        NumpyArray potential, acceleration, tensor;
+        if (out.is_none()) {
+            potential = NumpyArray(count);
+            acceleration = NumpyArray({count, py::ssize_t{3}});
+            tensor = NumpyArray({count, py::ssize_t{6}});
+        } else {
+            const auto arrays = out.cast<py::tuple>();
+            if (arrays.size() != 3) {
+                throw std::invalid_argument("The out argument must be a tuple (potential, acceleration, tensor).");
+            }
+            potential = outputArray(arrays[0], {count});
+            acceleration = outputArray(arrays[1], {count, 3});
+            tensor = outputArray(arrays[2], {count, 6});
+        }
+        const auto *pointsData = reinterpret_cast<const Array3 *>(points.data());
+        double *potentialData = potential.mutable_data();
+        auto *accelerationData = reinterpret_cast<Array3 *>(acceleration.mutable_data());
+        auto *tensorData = reinterpret_cast<Array6 *>(tensor.mutable_data());
+        // The arrays are kept alive by this frame, hence their buffers stay valid without the GIL
+        withoutGil([&]() {
+            evaluable.evaluate(pointsData, static_cast<size_t>(count), potentialData, accelerationData, tensorData, parallel,
+                               sortPoints);
+        });
+        return py::make_tuple(potential, acceleration, tensor);
+    }
+
+}
+
 PYBIND11_MODULE(_core, m, py::mod_gil_not_used()) {
     using namespace polyhedralGravity;
     m.doc() = R"mydelimiter(
@@ -105,7 +416,14 @@ PYBIND11_MODULE(_core, m, py::mod_gil_not_used()) {
 
     // We embedded the version and compilation information into the Python Interface
     m.attr("__version__") = POLYHEDRAL_GRAVITY_VERSION;
-    m.attr("__parallelization__") = POLYHEDRAL_GRAVITY_PARALLELIZATION;
+    // The backends compiled into this build, the default one is returned by get_parallelization()
+    py::list backends{};
+    for (const ParallelizationBackend backend: Parallelization::availableBackends()) {
+        std::stringstream name{};
+        name << backend;
+        backends.append(name.str());
+    }
+    m.attr("__parallelization__") = backends;
     m.attr("__commit__") = POLYHEDRAL_GRAVITY_COMMIT_HASH;
     m.attr("__logging__") = POLYHEDRAL_GRAVITY_LOGGING_LEVEL;
 
@@ -126,13 +444,77 @@ PYBIND11_MODULE(_core, m, py::mod_gil_not_used()) {
                "All activities regarding MeshChecking are disabled. No runtime overhead!")
         .value("VERIFY", PolyhedronIntegrity::VERIFY,
                "Only verification of the NormalOrientation. "
-               "A misalignment (e.g. specified OUTWARDS, but is not) leads to a runtime_error. Runtime Cost :math:`O(n^2)`")
+               "A misalignment (e.g. specified OUTWARDS, but is not) leads to a runtime_error. "
+               "Runtime Cost :math:`O(n \\log n)` for closed manifold meshes, otherwise :math:`O(n^2)`")
         .value("AUTOMATIC", PolyhedronIntegrity::AUTOMATIC,
                "Like :code:`VERIFY`, but also informs the user about the option in any case on the runtime costs. "
-               "This is the implicit default option. Runtime Cost: :math:`O(n^2)` and output to stdout in every case!")
+               "This is the implicit default option. Runtime Cost: like :code:`VERIFY` and output to stdout in every case!")
         .value("HEAL", PolyhedronIntegrity::HEAL,
                "Verification and Automatic Healing of the NormalOrientation. "
-               "A misalignment does not lead to a runtime_error, but to an internal correction of vertices ordering. Runtime Cost: :math:`O(n^2)`");
+               "A misalignment does not lead to a runtime_error, but to an internal correction of vertices ordering. Runtime Cost: like :code:`VERIFY`");
+
+    py::enum_<OrientationCheckStrategy>(m, "OrientationCheckStrategy", R"mydelimiter(
+        The strategy used to determine the orientation of the plane unit normals of a polyhedron.
+        )mydelimiter")
+        .value("TOPOLOGICAL", OrientationCheckStrategy::TOPOLOGICAL,
+               "Flood fill over the shared edges of the mesh. The global direction is settled with a signed volume test "
+               "or a few ray casts per component. Open or non-manifold meshes fall back to :code:`RAY_CASTING`. "
+               "Runtime Cost :math:`O(n \\log n)` for closed manifold meshes")
+        .value("RAY_CASTING", OrientationCheckStrategy::RAY_CASTING,
+               "Casts one ray per face and counts the intersections with the polyhedron. Runtime Cost :math:`O(n^2)`");
+
+    py::enum_<SpaceFillingCurve>(m, "SpaceFillingCurve", R"mydelimiter(
+        The space-filling curve along which :py:meth:`polyhedral_gravity.Polyhedron.reordered` sorts the vertices and faces.
+        )mydelimiter")
+        .value("MORTON", SpaceFillingCurve::MORTON,
+               "The Morton (Z-order) curve. Cheapest to compute, but with jumps between the octants")
+        .value("HILBERT", SpaceFillingCurve::HILBERT,
+               "The Hilbert curve, whose consecutive cells are always neighbours. Better locality than the Morton curve");
+
+    py::enum_<ParallelizationBackend>(m, "ParallelizationBackend", R"mydelimiter(
+        The thrust host system executing the parallel algorithms. Only the backends listed in
+        :code:`polyhedral_gravity.__parallelization__` are compiled into this build.
+        )mydelimiter")
+        .value("CPP", ParallelizationBackend::CPP, "Serial execution, always available")
+        .value("OMP", ParallelizationBackend::OMP, "Parallel execution with OpenMP")
+        .value("TBB", ParallelizationBackend::TBB, "Parallel execution with Intel's Threading Building Blocks");
+
+    py::enum_<MeshStorage>(m, "MeshStorage", R"mydelimiter(
+        The storage of the per-face data a :py:class:`polyhedral_gravity.GravityEvaluable` caches for its evaluations.
+        The compact modes trade a little recomputation during the evaluation for less memory per face.
+        The polyhedron's faces with 64-bit vertex indices (24 bytes per face) are retained in every mode, the
+        totals stated in parentheses include them.
+        )mydelimiter")
+        .value("DOUBLE", MeshStorage::DOUBLE,
+               "Double precision segment vectors, plane unit normals, and segment unit normals. Memory: 168 bytes per face (192 bytes in total)")
+        .value("COMPACT", MeshStorage::COMPACT,
+               "32-bit vertex indices and double precision unit normals, the segment vectors are recomputed. "
+               "The results are identical to :code:`DOUBLE`. Memory: 108 bytes per face (132 bytes in total)")
+        .value("COMPACT_FLOAT32", MeshStorage::COMPACT_FLOAT32,
+               "Like :code:`COMPACT`, but single precision unit normals which are widened to double precision for the "
+               "evaluation. The relative error of the results is in the order of 1e-7. Memory: 60 bytes per face (84 bytes in total)");
+
+    py::class_<MeshTopology>(m, "MeshTopology", R"mydelimiter(
+        The result of the edge adjacency analysis of a polyhedral mesh.
+        )mydelimiter")
+        .def_readonly("open_edges", &MeshTopology::openEdges, R"mydelimiter(
+        (K, 2)-array-like of :py:class:`int`: The edges (as pair of vertex indices) which are only part of one face
+        )mydelimiter")
+        .def_readonly("non_manifold_edges", &MeshTopology::nonManifoldEdges, R"mydelimiter(
+        (K, 2)-array-like of :py:class:`int`: The edges (as pair of vertex indices) which are shared by more than two faces
+        )mydelimiter")
+        .def_readonly("face_components", &MeshTopology::faceComponents, R"mydelimiter(
+        (M)-array-like of :py:class:`int`: The index of the connected component each face belongs to
+        )mydelimiter")
+        .def_readonly("component_count", &MeshTopology::componentCount, R"mydelimiter(
+        :py:class:`int`: The number of disconnected components of the mesh
+        )mydelimiter")
+        .def_readonly("orientable", &MeshTopology::orientable, R"mydelimiter(
+        :py:class:`bool`: True if the faces can be oriented consistently
+        )mydelimiter")
+        .def("is_closed_manifold", &MeshTopology::isClosedManifold, R"mydelimiter(
+        Returns true if the mesh has no open or non-manifold edges and is consistently orientable.
+        )mydelimiter");
 
     py::enum_<MetricUnit>(m, "MetricUnit", R"mydelimiter(
         The metric unit of for example a polyhedral mesh source.
@@ -151,7 +533,35 @@ PYBIND11_MODULE(_core, m, py::mod_gil_not_used()) {
             of the polyhedron. Otherwise the results are negated.
             The class by default enforces this constraints and offers utility to (automatically) make the input data obey to this constraint.
             )mydelimiter")
-            .def(py::init<const std::variant<PolyhedralSource, PolyhedralFiles> &, double, const NormalOrientation &, const PolyhedronIntegrity &, const MetricUnit &>(), R"mydelimiter(
+            .def(py::init([](const std::tuple<py::array_t<double, py::array::c_style | py::array::forcecast>,
+                                              py::array_t<size_t, py::array::c_style | py::array::forcecast>> &polyhedralSource,
+                             double density, const NormalOrientation &orientation, const PolyhedronIntegrity &integrity,
+                             const MetricUnit &metricUnit) {
+                const auto &[vertices, faces] = polyhedralSource;
+                PolyhedralSource source{copyRows(vertices, "vertices"), copyRows(faces, "faces")};
+                return withoutGil([&]() {
+                    return Polyhedron{std::move(source), density, orientation, integrity, metricUnit};
+                });
+            }), R"mydelimiter(
+            Creates a new Polyhedron from NumPy arrays of vertices and faces and a constant density.
+            The arrays are copied in bulk without converting their elements one by one.
+            See the overload below for the description of the arguments.
+            )mydelimiter",
+                 py::arg("polyhedral_source"),
+                 py::arg("density"),
+                 py::arg("normal_orientation") = NormalOrientation::OUTWARDS,
+                 py::arg("integrity_check") = PolyhedronIntegrity::AUTOMATIC,
+                 py::arg("metric_unit") = MetricUnit::METER
+                    )
+            .def(py::init([](std::variant<PolyhedralSource, PolyhedralFiles> polyhedralSource, double density,
+                             const NormalOrientation &orientation, const PolyhedronIntegrity &integrity,
+                             const MetricUnit &metricUnit, double weldTolerance) {
+                if (std::holds_alternative<PolyhedralFiles>(polyhedralSource)) {
+                    return Polyhedron{MeshReader::getPolyhedralSource(std::get<PolyhedralFiles>(polyhedralSource), weldTolerance),
+                                      density, orientation, integrity, metricUnit};
+                }
+                return Polyhedron{std::move(polyhedralSource), density, orientation, integrity, metricUnit};
+            }), R"mydelimiter(
             Creates a new Polyhedron from vertices and faces and a constant density.
             If the integrity_check is not set to DISABLE, the mesh integrity is checked
             (so that it fits the specification of the polyhedral model by *Tsoulis et al.*)
@@ -168,18 +578,22 @@ PYBIND11_MODULE(_core, m, py::mod_gil_not_used()) {
 
                                         * :code:`AUTOMATIC` (Default): Prints to stdout and throws ValueError if normal_orientation is wrong/ inconsistent
                                         * :code:`VERIFY`: Like :code:`AUTOMATIC`, but does not print to stdout
-                                        * :code:`DISABLE`: Recommend, when you are familiar with the mesh to avoid :math:`O(n^2)` runtime cost. Disables ALL checks
+                                        * :code:`DISABLE`: Recommend, when you are familiar with the mesh to avoid the runtime cost. Disables ALL checks
                                         * :code:`HEAL`: Automatically fixes the normal_orientation and vertex ordering to the correct values
                 metric_unit:        The metric unit of the mesh. Can be either :code:`METER`, :code:`KILOMETER`, or :code:`UNITLESS`.
                                     (default: :code:`METER`)
+                weld_tolerance:     The distance up to which the vertices of binary STL and PLY files given as :code:`polyhedral_source`
+                                    are merged (default: :code:`0.0`, i.e. only identical vertices are merged)
 
             Raises:
                 ValueError: If :code:`integrity_check` is set to :code:`AUTOMATIC` or :code:`VERIFY` and the mesh is inconsistent
+                            or the :code:`weld_tolerance` is negative
                 RuntimeError: If files given as :code:`polyhedral_source` do not exist
 
             Note:
                 The :code:`integrity_check` is automatically enabled to avoid wrong results due to the wrong vertex ordering.
-                The check requires :math:`O(n^2)` operations. You want to turn this off, when you know you mesh!
+                The check requires :math:`O(n \log n)` operations for closed manifold meshes and :math:`O(n^2)` otherwise.
+                You want to turn this off, when you know you mesh!
                 The faces array's indexing is shifted by -1 if the indexing started previously from vertex one (i.e., the first index is referred to as one).
                 In other words, the first vertex is always referred to as vertex zero not one!
             )mydelimiter",
@@ -187,7 +601,8 @@ PYBIND11_MODULE(_core, m, py::mod_gil_not_used()) {
                  py::arg("density"),
                  py::arg("normal_orientation") = NormalOrientation::OUTWARDS,
                  py::arg("integrity_check") = PolyhedronIntegrity::AUTOMATIC,
-                 py::arg("metric_unit") = MetricUnit::METER
+                 py::arg("metric_unit") = MetricUnit::METER,
+                 py::arg("weld_tolerance") = 0.0
                     )
             .def("check_normal_orientation", &Polyhedron::checkPlaneUnitNormalOrientation, R"mydelimiter(
             Returns a tuple consisting of majority plane unit normal orientation,
@@ -196,6 +611,10 @@ PYBIND11_MODULE(_core, m, py::mod_gil_not_used()) {
             The set of indices violating the property is empty if the mesh has a clear ordering.
             The set contains values if the mesh is inconsistent.
 
+            Args:
+                strategy:   The strategy used to determine the orientation. One of :py:class:`polyhedral_gravity.OrientationCheckStrategy`.
+                            (default: :code:`TOPOLOGICAL`)
+
             Returns:
                 Tuple consisting consisting of majority plane unit normal orientation and the indices of the faces violating this orientation.
 
@@ -205,7 +624,27 @@ PYBIND11_MODULE(_core, m, py::mod_gil_not_used()) {
                 If set to :code:`HEAL`, this method should return an empty set (but maybe a different ordering than initially specified)
                 Only if set to :code:`DISABLE`, then this method might actually return a set with faulty indices.
                 Hence, if you want to know your mesh error. Construct the polyhedron with :code:`integrity_check=DISABLE` and call this method.
+            )mydelimiter", py::arg("strategy") = OrientationCheckStrategy::TOPOLOGICAL)
+            .def("check_mesh_topology", &Polyhedron::checkMeshTopology, R"mydelimiter(
+            Analyzes the edge adjacency of the mesh, i.e., reports open and non-manifold edges,
+            the connected components, and whether the faces can be oriented consistently.
+
+            Returns:
+                :py:class:`polyhedral_gravity.MeshTopology`: The topology of the mesh
             )mydelimiter")
+            .def("reordered", &Polyhedron::reordered, py::call_guard<py::gil_scoped_release>(), R"mydelimiter(
+            Returns a copy of this polyhedron whose vertices and faces are sorted along a space-filling curve
+            (the face indices are remapped accordingly). Consecutive faces then reference nearby vertices, which
+            speeds up the evaluation of large meshes. The orientation of the faces is preserved.
+            The mapping to the original order is given by :py:attr:`polyhedral_gravity.Polyhedron.vertex_permutation`
+            and :py:attr:`polyhedral_gravity.Polyhedron.face_permutation`.
+
+            Args:
+                curve:  The space-filling curve. One of :py:class:`polyhedral_gravity.SpaceFillingCurve` (default: :code:`HILBERT`)
+
+            Returns:
+                :py:class:`polyhedral_gravity.Polyhedron`: The reordered polyhedron
+            )mydelimiter", py::arg("curve") = SpaceFillingCurve::HILBERT)
             .def("__getitem__", &Polyhedron::getResolvedFace, R"mydelimiter(
             Returns the the three coordinates of the vertices making the face at the requested index.
             This does not return the face as list of vertex indices, but resolved with the actual coordinates.
@@ -222,11 +661,32 @@ PYBIND11_MODULE(_core, m, py::mod_gil_not_used()) {
             .def("__repr__", &Polyhedron::toString, R"mydelimiter(
             :py:class:`str`: A string representation of this polyhedron
             )mydelimiter")
-            .def_property_readonly("vertices", &Polyhedron::getVertices, R"mydelimiter(
-            (N, 3)-array-like of :py:class:`float`: The vertices of the polyhedron. Coordinates in the unit of the mesh (Read-Only).
+            .def_property_readonly("vertices", [](const py::object &self) {
+                return readOnlyView(self.cast<const Polyhedron &>().getVertices(), self);
+            }, R"mydelimiter(
+            (N, 3)-:py:class:`numpy.ndarray` of :py:class:`float`: The vertices of the polyhedron. Coordinates in the unit of the mesh (Read-Only).
+            The array is a read-only view onto the polyhedron's storage, i.e. it is not copied.
+            )mydelimiter")
+            .def_property_readonly("faces", [](const py::object &self) {
+                return readOnlyView(self.cast<const Polyhedron &>().getFaces(), self);
+            }, R"mydelimiter(
+            (M, 3)-:py:class:`numpy.ndarray` of :py:class:`int`: The faces of the polyhedron (Read-Only).
+            The array is a read-only view onto the polyhedron's storage, i.e. it is not copied.
             )mydelimiter")
-            .def_property_readonly("faces", &Polyhedron::getFaces, R"mydelimiter(
-            (M, 3)-array-like of :py:class:`int`: The faces of the polyhedron (Read-Only).
+            .def_property_readonly("vertex_permutation", [](const Polyhedron &polyhedron) {
+                const std::vector<size_t> permutation = polyhedron.getVertexPermutation();
+                return py::array_t<size_t>(static_cast<py::ssize_t>(permutation.size()), permutation.data());
+            }, R"mydelimiter(
+            (N)-:py:class:`numpy.ndarray` of :py:class:`int`: The index of every vertex in the input of the polyhedron,
+            i.e. the identity unless the polyhedron was :py:meth:`polyhedral_gravity.Polyhedron.reordered` (Read-Only).
+            )mydelimiter")
+            .def_property_readonly("face_permutation", [](const Polyhedron &polyhedron) {
+                const std::vector<size_t> permutation = polyhedron.getFacePermutation();
+                return py::array_t<size_t>(static_cast<py::ssize_t>(permutation.size()), permutation.data());
+            }, R"mydelimiter(
+            (M)-:py:class:`numpy.ndarray` of :py:class:`int`: The index of every face in the input of the polyhedron,
+            i.e. the identity unless the polyhedron was :py:meth:`polyhedral_gravity.Polyhedron.reordered` (Read-Only).
+            Results per face are reported in the original order via :code:`original[face_permutation] = results`.
             )mydelimiter")
             .def_property("density", &Polyhedron::getDensity, &Polyhedron::setDensity, R"mydelimiter(
             :py:class:`float`: The density of the polyhedron in :math:`[kg/X^3]` with X being the unit of the mesh (Read/ Write).
@@ -240,6 +700,28 @@ PYBIND11_MODULE(_core, m, py::mod_gil_not_used()) {
             .def_property_readonly("density_unit", &Polyhedron::getDensityUnit, R"mydelimiter(
             :py:class:`str`: The metric unit of the density (Read-Only).
             )mydelimiter")
+            .def("save", [](const Polyhedron &polyhedron, const std::string &filename) {
+                Snapshot::write(filename, polyhedron);
+            }, R"mydelimiter(
+            Writes the polyhedron to a binary snapshot file. In contrast to a mesh file, the snapshot
+            additionally contains the density, normal orientation, and mesh unit and is restored
+            without parsing and without re-running the mesh integrity check.
+
+            Args:
+                filename:   The file to write to
+            )mydelimiter", py::arg("filename"))
+            .def_static("load", &Snapshot::readPolyhedron, R"mydelimiter(
+            Restores a polyhedron from a binary snapshot file written by :py:meth:`polyhedral_gravity.Polyhedron.save`.
+
+            Args:
+                filename:   The snapshot file
+
+            Returns:
+                :py:class:`polyhedral_gravity.Polyhedron`: The polyhedron
+
+            Raises:
+                RuntimeError if the file is no valid snapshot
+            )mydelimiter", py::arg("filename"))
             .def(py::pickle(
                     [](const Polyhedron &polyhedron) {
                         const auto &[vertices, faces, density, orientation, metricUnit] = polyhedron.getState();
@@ -253,32 +735,107 @@ PYBIND11_MODULE(_core, m, py::mod_gil_not_used()) {
                         Polyhedron polyhedron{
                                 tuple[0].cast<std::vector<Array3>>(), tuple[1].cast<std::vector<IndexArray3>>(),
                                 tuple[2].cast<double>(), tuple[3].cast<NormalOrientation>(), PolyhedronIntegrity::DISABLE,
-                                tuple[4].cast<MetricUnit>()
+                                tuple[4].cast<MetricUnit>(), VertexIndexing::ZERO_BASED
                         };
                         return polyhedron;
                     }
                     ));
 
+    m.def("set_integrity_cache_directory", &IntegrityCache::setDirectory, R"mydelimiter(
+            Sets the directory of the on-disk cache of the mesh integrity checks.
+            The outcome of the checks (orientation, violating faces, degeneracy) is stored per mesh, keyed by a content hash
+            over the vertices, faces, and specified normal orientation. Constructing the same polyhedron again skips the checks.
+            An empty string disables the cache. Overrides the environment variable :code:`POLYHEDRAL_GRAVITY_INTEGRITY_CACHE`.
+
+            Args:
+                directory:  The directory to store the cache files in, created if it does not exist
+            )mydelimiter", py::arg("directory"));
+
+    m.def("get_integrity_cache_directory", &IntegrityCache::getDirectory, R"mydelimiter(
+            Returns the directory of the on-disk cache of the mesh integrity checks. Empty if the cache is disabled.
+
+            Returns:
+                :py:class:`str`: The cache directory
+            )mydelimiter");
+
+    m.def("set_parallelization", [](ParallelizationBackend backend, size_t threads) {
+                Parallelization::setDefault({backend, threads});
+            }, R"mydelimiter(
+            Sets the process-wide parallelization backend and number of threads of all evaluations (with :code:`parallel=True`)
+            and mesh checks. Overrides the environment variables :code:`POLYHEDRAL_GRAVITY_BACKEND` and
+            :code:`POLYHEDRAL_GRAVITY_THREADS`, which are read once on the first evaluation.
+
+            Args:
+                backend:    The backend, one of :code:`polyhedral_gravity.__parallelization__`
+                threads:    The maximal number of threads, zero is the backend's default, i.e. usually one thread per core (default: 0)
+
+            Raises:
+                ValueError if the backend is not compiled into this build
+            )mydelimiter", py::arg("backend"), py::arg("threads") = 0);
+
+    m.def("get_parallelization", []() {
+                const ParallelizationSettings settings = Parallelization::getDefault();
+                return std::make_tuple(settings.backend, settings.threads);
+            }, R"mydelimiter(
+            Returns the process-wide parallelization backend and number of threads.
+
+            Returns:
+                :py:class:`tuple`: The backend and the maximal number of threads (zero is the backend's default)
+            )mydelimiter");
+
     py::class_<GravityEvaluable>(m, "GravityEvaluable", R"mydelimiter(
              A class to evaluate the polyhedral gravity model for a given constant density polyhedron at a given computation point.
              It provides a :py:meth:`polyhedral_gravity.GravityEvaluable.__call__` method to evaluate the polyhedral gravity model for computation points while
              also caching the polyhedron & intermediate results over the lifetime of the object.
+
+             A GravityEvaluable is immutable, hence it is safe to call it from multiple threads concurrently.
+             The evaluation releases the GIL, so that other Python threads (e.g. of a thread pool or an asyncio executor)
+             run in the meantime. The caller must not modify the NumPy arrays passed to an ongoing evaluation.
              )mydelimiter")
-            .def(py::init<const Polyhedron &>(),R"mydelimiter(
+            .def(py::init<const Polyhedron &, MeshStorage>(), py::call_guard<py::gil_scoped_release>(), R"mydelimiter(
              Creates a new GravityEvaluable for a given constant density polyhedron.
              It provides a :py:meth:`polyhedral_gravity.GravityEvaluable.__call__` method to evaluate the polyhedral gravity model for computation points while
              also caching the polyhedron & intermediate results over the lifetime of the object.
 
              Args:
                  polyhedron: The polyhedron for which to evaluate the gravity model
-             )mydelimiter", py::arg("polyhedron"))
+                 storage:    The storage of the cached per-face data. One of :py:class:`polyhedral_gravity.MeshStorage` (default: :code:`DOUBLE`)
+
+             Raises:
+                 ValueError if the polyhedron has too many vertices for the compact storage or
+                 if a unit normal cannot be stored in single precision (:code:`COMPACT_FLOAT32`)
+             )mydelimiter", py::arg("polyhedron"), py::arg("storage") = MeshStorage::DOUBLE)
+            .def(py::init(&Snapshot::readSharedMemory), py::call_guard<py::gil_scoped_release>(), R"mydelimiter(
+             Attaches to a GravityEvaluable in a POSIX shared-memory object written by :py:meth:`polyhedral_gravity.GravityEvaluable.share_memory`.
+             The polyhedron and the face caches are read from the shared memory without recomputing them. The face caches are used in-place,
+             i.e. all attached processes share a single read-only copy, while every process holds its own copy of the vertices and faces.
+
+             Args:
+                 shared_memory: The name of the shared-memory object
+
+             Raises:
+                 RuntimeError if the object does not exist or is no valid GravityEvaluable
+             )mydelimiter", py::kw_only(), py::arg("shared_memory"))
+            .def_property_readonly("storage", &GravityEvaluable::getStorage, R"mydelimiter(
+            :py:class:`polyhedral_gravity.MeshStorage`: The storage of the cached per-face data (Read-Only)
+            )mydelimiter")
             .def_property_readonly("output_units", &GravityEvaluable::getOutputMetricUnit,R"mydelimiter(
             (3)-array-like of :py:class:`str`: A human-readable string representation of the output units. This depends on the polyhedron's definition (Read-Only).
             )mydelimiter")
             .def("__repr__", &GravityEvaluable::toString,R"mydelimiter(
             :py:class:`str`: A string representation of this GravityEvaluable.
             )mydelimiter")
-            .def("__call__", &GravityEvaluable::operator(),
+            .def("__call__", [](const GravityEvaluable &evaluable, const py::object &computationPoints, bool parallel,
+                                const py::object &out, bool asNumpy, bool sortPoints,
+                                const std::optional<size_t> &threads) -> py::object {
+                std::optional<ParallelizationScope> scope{};
+                limitThreads(scope, threads);
+                if (asNumpy || !out.is_none()) {
+                    return evaluateNumpy(evaluable, computationPoints, parallel, out, sortPoints);
+                }
+                const auto points = computationPoints.cast<std::variant<Array3, std::vector<Array3>>>();
+                return py::cast(withoutGil([&]() { return evaluable(points, parallel, sortPoints); }));
+            },
              R"mydelimiter(
              Evaluates the polyhedral gravity model for a given constant density polyhedron at a given computation point.
 
@@ -287,44 +844,270 @@ PYBIND11_MODULE(_core, m, py::mod_gil_not_used()) {
              In case the polyhedron is unitless, the results are **not** multiplied with the Gravitational Constant :math:`G`, but returned raw.
 
              Args:
-                 computation_points: The computation points as tuple or list of points
-                 parallel:           If :code:`True`, the computation is done in parallel on the CPU using the technology specified by
-                                     :code:`polyhedral_gravity.__parallelization__` (default: :code:`True`)
+                 computation_points: The computation points as tuple or list of points, or as array of shape (N, 3)
+                 parallel:           If :code:`True`, the computation is done in parallel on the CPU using the backend selected by
+                                     :py:func:`polyhedral_gravity.set_parallelization` (default: :code:`True`)
+                 out:                A tuple of writable, C-contiguous float64 arrays of shapes (N,), (N, 3) and (N, 6) to write the results into,
+                                     e.g. the arrays returned by a previous call. Implies :code:`as_numpy` (default: :code:`None`)
+                 as_numpy:           If :code:`True`, the points are read directly from the array's buffer (without copying if it is a C-contiguous
+                                     float64 array) and the results are returned as NumPy arrays (default: :code:`False`)
+                 sort_points:        If :code:`True`, multiple points are evaluated along a Morton curve, so that spatially close points are
+                                     evaluated after each other. The results are still returned in the order of the points (default: :code:`False`)
+                 threads:            The maximal number of threads of this call, :code:`None` keeps the process-wide setting (default: :code:`None`)
 
              Returns:
                  Either a triplet of potential :math:`V`, acceleration :math:`[V_x, V_y, V_z]`
                  and second derivatives :math:`[V_{xx}, V_{yy}, V_{zz}, V_{xy},V_{xz}, V_{yz}]` at the computation points or
-                 if multiple computation points are given a list of these triplets
-             )mydelimiter", py::arg("computation_points"), py::arg("parallel") = true)
+                 if multiple computation points are given a list of these triplets.
+                 With :code:`as_numpy` or :code:`out`, the triplet of arrays of shapes (N,), (N, 3) and (N, 6)
+
+             Raises:
+                 ValueError if the points are no array of shape (N, 3) or the out arrays do not match (only with :code:`as_numpy` or :code:`out`)
+             )mydelimiter", py::arg("computation_points"), py::arg("parallel") = true, py::kw_only(),
+             py::arg("out") = py::none(), py::arg("as_numpy") = false, py::arg("sort_points") = false,
+             py::arg("threads") = py::none())
+            .def("stream", [](const GravityEvaluable &evaluable, const py::iterable &computationPoints,
+                              const py::function &callback, size_t chunkSize, bool parallel) {
+                IterablePointSource pointSource{computationPoints};
+                // Only the evaluation runs without the GIL, reading the points and the callback acquire it
+                return withoutGil([&]() {
+                    return evaluable.stream(pointSource, [&callback](size_t firstIndex, const std::vector<Array3> &points,
+                                                                     const std::vector<GravityModelResult> &results) {
+                        py::gil_scoped_acquire acquire{};
+                        // Only an explicit False stops the evaluation, a callback without return value continues
+                        return !callback(firstIndex, points, results).is(py::bool_(false));
+                    }, chunkSize, parallel);
+                });
+            }, R"mydelimiter(
+             Evaluates the polyhedral gravity model for an iterable of computation points chunk by chunk.
+             Every completed chunk is passed to the callback before the next chunk is drawn from the iterable.
+             Hence, arbitrarily many points (e.g. produced by a generator) can be evaluated while only a single
+             chunk of points and results resides in memory.
+
+             Args:
+                 computation_points: An iterable of computation points, it is only traversed once
+                 callback:           Called with :code:`(first_index, points, results)` for every completed chunk, where
+                                     :code:`first_index` is the index of the chunk's first point. Returning :code:`False`
+                                     stops the evaluation
+                 chunk_size:         The maximal number of points per chunk (default: :code:`65536`)
+                 parallel:           If :code:`True`, the points of a chunk are evaluated in parallel (default: :code:`True`)
+
+             Returns:
+                 :py:class:`int`: The number of evaluated points
+
+             Raises:
+                 ValueError if the chunk size is zero
+             )mydelimiter", py::arg("computation_points"), py::arg("callback"), py::arg("chunk_size") = 65536,
+             py::arg("parallel") = true)
+            .def("with_worker_team", [](const GravityEvaluable &evaluable, size_t threads) {
+                return evaluable.withWorkerTeam(std::make_shared<WorkerTeam>(threads));
+            }, py::call_guard<py::gil_scoped_release>(), R"mydelimiter(
+            Returns a GravityEvaluable sharing the polyhedron and the cached per-face data of this one, which evaluates single
+            points (with :code:`parallel=True`) on a persistent team of busy-waiting worker threads. Every thread sums up a fixed
+            range of faces, which avoids the overhead of starting a parallel loop for every call, e.g. when a propagator
+            evaluates one point after another. The workers release their cores if no point is evaluated for a few milliseconds.
+            Evaluations from within a job of the same team (e.g. a callback running on a worker) are run serially instead of deadlocking.
+
+            Args:
+                threads:    The number of threads including the calling one, zero is one thread per core (default: 0)
+
+            Returns:
+                :py:class:`polyhedral_gravity.GravityEvaluable`: The latency-optimized GravityEvaluable
+            )mydelimiter", py::arg("threads") = 0)
+            .def("save", [](const GravityEvaluable &evaluable, const std::string &filename) {
+                Snapshot::write(filename, evaluable);
+            }, R"mydelimiter(
+            Writes the GravityEvaluable, i.e. its polyhedron and all precomputed face caches, to a binary snapshot file.
+
+            Args:
+                filename:   The file to write to
+            )mydelimiter", py::arg("filename"))
+            .def("share_memory", [](const GravityEvaluable &evaluable, const std::string &name) {
+                Snapshot::writeSharedMemory(name, evaluable);
+            }, py::call_guard<py::gil_scoped_release>(), R"mydelimiter(
+            Writes the GravityEvaluable, i.e. its polyhedron and all precomputed face caches, into a POSIX shared-memory object
+            (replacing an existing one with the same name). Processes on the same node can then attach to a single read-only copy
+            via :code:`GravityEvaluable(shared_memory=name)`. The object persists until
+            :py:meth:`polyhedral_gravity.GravityEvaluable.remove_shared_memory` is called.
+            Processes attached to a replaced object keep using the old copy, processes attaching before the writing finished are rejected.
+
+            Args:
+                name:       The name of the shared-memory object, e.g. :code:`"/eros"`
+
+            Raises:
+                RuntimeError if the object cannot be created or shared memory is not supported on this system
+            )mydelimiter", py::arg("name"))
+            .def_static("remove_shared_memory", &Snapshot::removeSharedMemory, R"mydelimiter(
+            Removes a POSIX shared-memory object created by :py:meth:`polyhedral_gravity.GravityEvaluable.share_memory`.
+            GravityEvaluables attached to it remain valid.
+
+            Args:
+                name:       The name of the shared-memory object
+
+            Raises:
+                RuntimeError if the object does not exist
+            )mydelimiter", py::arg("name"))
+            .def_static("load", &Snapshot::readGravityEvaluable, R"mydelimiter(
+            Restores a GravityEvaluable from a binary snapshot file written by :py:meth:`polyhedral_gravity.GravityEvaluable.save`
+            (or :py:meth:`polyhedral_gravity.Polyhedron.save`, then the caches are computed).
+            The file is memory-mapped and the caches are used in-place without copying them, the vertices and faces are copied.
+
+            Args:
+                filename:   The snapshot file
+
+            Returns:
+                :py:class:`polyhedral_gravity.GravityEvaluable`: The GravityEvaluable
+
+            Raises:
+                RuntimeError if the file is no valid snapshot
+            )mydelimiter", py::arg("filename"))
+            .def("__reduce_ex__", [](const py::object &self, int protocol) -> py::object {
+                // Protocol 5 passes the arrays as out-of-band buffers, older protocols use __getstate__
+                if (protocol < 5) {
+                    return py::module_::import("builtins").attr("object").attr("__reduce_ex__")(self, protocol);
+                }
+                return py::make_tuple(py::module_::import("copyreg").attr("__newobj__"), py::make_tuple(py::type::of(self)),
+                                      gravityEvaluableState(self, true));
+            })
             .def(py::pickle(
-                    [](const GravityEvaluable &evaluable) {
-                        const auto &[polyhedron, segmentVectors, planeUnitNormals, segmentUnitNormals] = evaluable.getState();
-                        return py::make_tuple(polyhedron, segmentVectors, planeUnitNormals, segmentUnitNormals);
+                    [](const py::object &self) {
+                        return gravityEvaluableState(self, false);
                     },
                     [](const py::tuple &tuple) {
-                        constexpr size_t GRAVITY_EVALUABLE_STATE_SIZE = 4;
-                        if (tuple.size() != GRAVITY_EVALUABLE_STATE_SIZE) {
+                        // The former state consisting of the polyhedron and the caches as nested lists
+                        constexpr size_t LEGACY_GRAVITY_EVALUABLE_STATE_SIZE = 4;
+                        if (tuple.size() == LEGACY_GRAVITY_EVALUABLE_STATE_SIZE) {
+                            return GravityEvaluable{
+                                    tuple[0].cast<Polyhedron>(), tuple[1].cast<std::vector<Array3Triplet>>(),
+                                    tuple[2].cast<std::vector<Array3>>(), tuple[3].cast<std::vector<Array3Triplet>>()
+                            };
+                        }
+                        if (tuple.size() != GRAVITY_EVALUABLE_STATE_SIZE && tuple.size() != DOUBLE_GRAVITY_EVALUABLE_STATE_SIZE) {
                             throw std::runtime_error("Invalid state!");
                         }
-                        GravityEvaluable evaluable{
-                                tuple[0].cast<Polyhedron>(), tuple[1].cast<std::vector<Array3Triplet>>(),
-                                tuple[2].cast<std::vector<Array3>>(), tuple[3].cast<std::vector<Array3Triplet>>()
-                        };
-                        return evaluable;
+                        return gravityEvaluableFromState(tuple);
                     }
                     ));
 
-    m.def("evaluate", [](const Polyhedron &polyhedron,
-                         const std::variant<Array3, std::vector<Array3>> &computationPoints,
-                         bool parallel) -> std::variant<GravityModelResult, std::vector<GravityModelResult>> {
+    py::class_<NumaGravityEvaluable>(m, "NumaGravityEvaluable", R"mydelimiter(
+             A NUMA-aware :py:class:`polyhedral_gravity.GravityEvaluable` for machines with several sockets.
+             The polyhedron and the cached per-face data are replicated in the local memory of every NUMA node and
+             every node evaluates its share of the computation points with threads pinned to its CPUs. Hence, no thread
+             reads the caches across the socket interconnect, at the cost of one copy of the caches per node.
+             The threads are independent of :py:func:`polyhedral_gravity.set_parallelization`.
+             )mydelimiter")
+            .def(py::init([](const Polyhedron &polyhedron, MeshStorage storage) {
+                return NumaGravityEvaluable{polyhedron, storage};
+            }), py::call_guard<py::gil_scoped_release>(), R"mydelimiter(
+             Creates a new NumaGravityEvaluable, replicating the polyhedron and its caches on every NUMA node of the machine.
+
+             Args:
+                 polyhedron: The polyhedron for which to evaluate the gravity model
+                 storage:    The storage of the cached per-face data. One of :py:class:`polyhedral_gravity.MeshStorage` (default: :code:`DOUBLE`)
+
+             Raises:
+                 ValueError if the caches cannot be created in the given storage
+             )mydelimiter", py::arg("polyhedron"), py::arg("storage") = MeshStorage::DOUBLE)
+            .def_property_readonly("nodes", [](const NumaGravityEvaluable &evaluable) {
+                std::vector<std::tuple<size_t, std::vector<size_t>>> nodes{};
+                for (const auto &node: evaluable.getNodes()) {
+                    nodes.emplace_back(node.id, node.cpus);
+                }
+                return nodes;
+            }, R"mydelimiter(
+            :py:class:`list`: The NUMA nodes holding a replica as tuples of the node's index and its CPUs (Read-Only)
+            )mydelimiter")
+            .def("__call__", [](const NumaGravityEvaluable &evaluable, const py::object &computationPoints, bool parallel,
+                                const py::object &out, bool asNumpy, bool sortPoints) -> py::object {
+                if (asNumpy || !out.is_none()) {
+                    return evaluateNumpy(evaluable, computationPoints, parallel, out, sortPoints);
+                }
+                const auto points = computationPoints.cast<std::variant<Array3, std::vector<Array3>>>();
+                return py::cast(withoutGil([&]() { return evaluable(points, parallel, sortPoints); }));
+            }, R"mydelimiter(
+             Evaluates the polyhedral gravity model like :py:meth:`polyhedral_gravity.GravityEvaluable.__call__`.
+             Multiple points are split between the NUMA nodes, a single point is evaluated with the replica of the calling thread's node.
+
+             Args:
+                 computation_points: The computation points as tuple or list of points, or as array of shape (N, 3)
+                 parallel:           If :code:`True`, the computation is done in parallel on every NUMA node (default: :code:`True`)
+                 out:                A tuple of writable, C-contiguous float64 arrays of shapes (N,), (N, 3) and (N, 6) to write the results into.
+                                     Implies :code:`as_numpy` (default: :code:`None`)
+                 as_numpy:           If :code:`True`, the results are returned as NumPy arrays (default: :code:`False`)
+                 sort_points:        If :code:`True`, every node evaluates its share of the points along a Morton curve (default: :code:`False`)
+
+             Returns:
+                 Either a triplet of potential :math:`V`, acceleration :math:`[V_x, V_y, V_z]`
+                 and second derivatives :math:`[V_{xx}, V_{yy}, V_{zz}, V_{xy},V_{xz}, V_{yz}]` at the computation points or
+                 if multiple computation points are given a list of these triplets.
+                 With :code:`as_numpy` or :code:`out`, the triplet of arrays of shapes (N,), (N, 3) and (N, 6)
+
+             Raises:
+                 ValueError if the points are no array of shape (N, 3) or the out arrays do not match (only with :code:`as_numpy` or :code:`out`)
+             )mydelimiter", py::arg("computation_points"), py::arg("parallel") = true, py::kw_only(),
+             py::arg("out") = py::none(), py::arg("as_numpy") = false, py::arg("sort_points") = false);
+
+    py::class_<CoalescingGravityEvaluable>(m, "CoalescingGravityEvaluable", R"mydelimiter(
+             A thread-safe front end of a :py:class:`polyhedral_gravity.GravityEvaluable` for services in which many threads
+             each ask for the gravity at a single point. The concurrent requests are collected into micro-batches, which are
+             evaluated in parallel over their points. A batch is evaluated as soon as it is full or its first request has
+             waited for :code:`max_wait` seconds. Calls release the GIL while waiting for their result.
+             )mydelimiter")
+            .def(py::init([](const GravityEvaluable &evaluable, size_t maxBatchSize, double maxWait, bool parallel) {
+                if (maxWait < 0.0) {
+                    throw std::invalid_argument("The maximal wait must not be negative.");
+                }
+                const std::chrono::microseconds wait{static_cast<std::chrono::microseconds::rep>(maxWait * 1e6)};
+                return std::make_unique<CoalescingGravityEvaluable>(evaluable, maxBatchSize, wait, parallel);
+            }), R"mydelimiter(
+             Creates a new CoalescingGravityEvaluable and starts its dispatcher thread.
+
+             Args:
+                 evaluable:      The GravityEvaluable evaluating the batches
+                 max_batch_size: The maximal number of points per batch (default: 1024)
+                 max_wait:       The maximal time in seconds the first request of a batch waits for further requests (default: 1e-4)
+                 parallel:       If :code:`True`, the points of a batch are evaluated in parallel (default: :code:`True`)
+
+             Raises:
+                 ValueError if the maximal batch size is zero or the maximal wait is negative
+             )mydelimiter", py::arg("evaluable"), py::arg("max_batch_size") = CoalescingGravityEvaluable::DEFAULT_MAX_BATCH_SIZE,
+             py::arg("max_wait") = 1e-4, py::arg("parallel") = true)
+            .def_property_readonly("statistics", [](const CoalescingGravityEvaluable &evaluable) {
+                const auto statistics = evaluable.getStatistics();
+                return std::make_tuple(statistics.requests, statistics.batches, statistics.maximalBatchSize);
+            }, R"mydelimiter(
+            :py:class:`tuple`: The number of evaluated requests, the number of evaluated batches, and the largest batch (Read-Only)
+            )mydelimiter")
+            .def("__call__", [](CoalescingGravityEvaluable &evaluable, const Array3 &computationPoint) {
+                return evaluable(computationPoint);
+            }, py::call_guard<py::gil_scoped_release>(), R"mydelimiter(
+             Evaluates the polyhedral gravity model at a single computation point, together with the concurrent calls
+             of other threads.
+
+             Args:
+                 computation_point: The computation point as tuple or list of three coordinates
+
+             Returns:
+                 A triplet of potential :math:`V`, acceleration :math:`[V_x, V_y, V_z]`
+                 and second derivatives :math:`[V_{xx}, V_{yy}, V_{zz}, V_{xy},V_{xz}, V_{yz}]` at the computation point
+             )mydelimiter", py::arg("computation_point"));
+
+    m.def("evaluate", [](const Polyhedron &polyhedron, const py::object &computationPoints, bool parallel,
+                         const py::object &out, bool asNumpy, const std::optional<size_t> &threads) -> py::object {
+                    std::optional<ParallelizationScope> scope{};
+                    limitThreads(scope, threads);
+                    if (asNumpy || !out.is_none()) {
+                        const GravityEvaluable evaluable = withoutGil([&]() { return GravityEvaluable{polyhedron}; });
+                        return evaluateNumpy(evaluable, computationPoints, parallel, out);
+                    }
                     return std::visit(util::overloaded{
                             [&](const Array3 &point) {
-                                return std::variant<GravityModelResult, std::vector<GravityModelResult>>(GravityModel::evaluate(polyhedron, point, parallel));
+                                return py::cast(withoutGil([&]() { return GravityModel::evaluate(polyhedron, point, parallel); }));
                             },
                             [&](const std::vector<Array3> &points) {
-                                return std::variant<GravityModelResult, std::vector<GravityModelResult>>(GravityModel::evaluate(polyhedron, points, parallel));
+                                return py::cast(withoutGil([&]() { return GravityModel::evaluate(polyhedron, points, parallel); }));
                             }
-                        }, computationPoints);
+                        }, computationPoints.cast<std::variant<Array3, std::vector<Array3>>>());
           }, R"mydelimiter(
              Evaluates the polyhedral gravity model for a given constant density polyhedron at a given computation point.
 
@@ -334,14 +1117,24 @@ PYBIND11_MODULE(_core, m, py::mod_gil_not_used()) {
 
              Args:
                  polyhedron:            The polyhedron for which to evaluate the gravity model
-                 computation_points:    The computation points as tuple or list of points
-                 parallel:              If :code:`True`, the computation is done in parallel on the CPU using the technology specified by
-                                        :code:`polyhedral_gravity.__parallelization__` (default: :code:`True`)
+                 computation_points:    The computation points as tuple or list of points, or as array of shape (N, 3)
+                 parallel:              If :code:`True`, the computation is done in parallel on the CPU using the backend selected by
+                                        :py:func:`polyhedral_gravity.set_parallelization` (default: :code:`True`)
+                 out:                   A tuple of writable, C-contiguous float64 arrays of shapes (N,), (N, 3) and (N, 6) to write the results into,
+                                        e.g. the arrays returned by a previous call. Implies :code:`as_numpy` (default: :code:`None`)
+                 as_numpy:              If :code:`True`, the points are read directly from the array's buffer (without copying if it is a C-contiguous
+                                        float64 array) and the results are returned as NumPy arrays (default: :code:`False`)
+                 threads:               The maximal number of threads of this call, :code:`None` keeps the process-wide setting (default: :code:`None`)
 
              Returns:
                  Either a triplet of potential :math:`V`, acceleration :math:`[V_x, V_y, V_z]`
                  and second derivatives :math:`[V_{xx}, V_{yy}, V_{zz}, V_{xy},V_{xz}, V_{yz}]` at the computation points or
-                 if multiple computation points are given a list of these triplets
-             )mydelimiter", py::arg("polyhedron"), py::arg("computation_points"), py::arg("parallel") = true);
+                 if multiple computation points are given a list of these triplets.
+                 With :code:`as_numpy` or :code:`out`, the triplet of arrays of shapes (N,), (N, 3) and (N, 6)
+
+             Raises:
+                 ValueError if the points are no array of shape (N, 3) or the out arrays do not match (only with :code:`as_numpy` or :code:`out`)
+             )mydelimiter", py::arg("polyhedron"), py::arg("computation_points"), py::arg("parallel") = true, py::kw_only(),
+          py::arg("out") = py::none(), py::arg("as_numpy") = false, py::arg("threads") = py::none());
 
 }
\ No newline at end of file
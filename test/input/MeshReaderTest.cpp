@@ -1,6 +1,11 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
 #include <string>
 #include <vector>
 #include "polyhedralGravity/input/MeshReader.h"
@@ -9,6 +14,31 @@ class MeshReaderTest : public ::testing::Test {
 
 protected:
 
+    const std::filesystem::path _plyFile{std::filesystem::temp_directory_path() / "polyhedral-gravity-mesh-reader-test.ply"};
+
+    void TearDown() override {
+        std::filesystem::remove(_plyFile);
+    }
+
+    /**
+     * Writes a little endian PLY file with float vertices and faces as list of int indices
+     * @param header the header's lines following the format line up to (excluding) end_header
+     * @param vertices the vertices
+     * @param faces the faces' counts and indices
+     */
+    void writePly(const std::string &header, const std::vector<std::array<float, 3>> &vertices,
+                  const std::vector<std::pair<int8_t, std::vector<int32_t>>> &faces) const {
+        std::ofstream file{_plyFile, std::ios::binary};
+        file << "ply\nformat binary_little_endian 1.0\n" << header << "end_header\n";
+        for (const auto &vertex: vertices) {
+            file.write(reinterpret_cast<const char *>(vertex.data()), sizeof(vertex));
+        }
+        for (const auto &[count, indices]: faces) {
+            file.write(reinterpret_cast<const char *>(&count), sizeof(count));
+            file.write(reinterpret_cast<const char *>(indices.data()), static_cast<std::streamsize>(indices.size() * sizeof(int32_t)));
+        }
+    }
+
     std::vector<std::array<double, 3>> _expectedVertices = {
             {-20, 0,  25},
             {0,   0,  25},
@@ -64,6 +94,44 @@ TEST_F(MeshReaderTest, readSimpleFace) {
     ASSERT_THAT(actualFaces, ContainerEq(_expectedFaces));
 }
 
+TEST_F(MeshReaderTest, readNodeFaceWithMarkers) {
+    using namespace testing;
+    using namespace ::polyhedralGravity;
+
+    // One-based indexing, an attribute column, boundary markers, comments, blank lines, and the reversed file order
+    const std::vector<std::string> markerFiles{
+            "resources/MeshReaderTestReadMarkers.face",
+            "resources/MeshReaderTestReadMarkers.node"
+    };
+    const auto&[actualVertices, actualFaces] = MeshReader::getPolyhedralSource(markerFiles);
+
+    std::vector<std::array<size_t, 3>> expectedFaces{_expectedFaces};
+    for (auto &face: expectedFaces) {
+        std::transform(face.cbegin(), face.cend(), face.begin(), [](size_t index) { return index + 1; });
+    }
+    ASSERT_THAT(actualVertices, ContainerEq(_expectedVertices));
+    ASSERT_THAT(actualFaces, ContainerEq(expectedFaces));
+}
+
+TEST_F(MeshReaderTest, readNodeFaceMalformed) {
+    using namespace testing;
+    using namespace ::polyhedralGravity;
+
+    // The face file announces more faces than it contains
+    const std::vector<std::string> truncatedFiles{
+            "resources/MeshReaderTestReadSimple.node",
+            "resources/MeshReaderTestReadTruncated.face"
+    };
+    ASSERT_THROW(MeshReader::getPolyhedralSource(truncatedFiles), std::runtime_error);
+
+    // The one-based faces refer to a node beyond the zero-based nodes
+    const std::vector<std::string> mixedFiles{
+            "resources/MeshReaderTestReadSimple.node",
+            "resources/MeshReaderTestReadMarkers.face"
+    };
+    ASSERT_THROW(MeshReader::getPolyhedralSource(mixedFiles), std::runtime_error);
+}
+
 TEST_F(MeshReaderTest, readSimpleMesh) {
     using namespace testing;
     using namespace ::polyhedralGravity;
@@ -116,6 +184,170 @@ TEST_F(MeshReaderTest, readSimpleStl) {
     ASSERT_EQ(_expectedFaces.size(), actualFaces.size());
 }
 
+TEST_F(MeshReaderTest, readBinaryStl) {
+    using namespace testing;
+    using namespace ::polyhedralGravity;
+
+    // The STL triangle soup contains every vertex multiple times, they are welded together
+    const std::vector<std::string> simpleFiles{"resources/MeshReaderTestReadSimpleBinary.stl"};
+    const auto&[actualVertices, actualFaces] = MeshReader::getPolyhedralSource(simpleFiles);
+
+    ASSERT_THAT(actualVertices, UnorderedElementsAreArray(_expectedVertices));
+    ASSERT_EQ(actualFaces.size(), _expectedFaces.size());
+    for (size_t face = 0; face < _expectedFaces.size(); ++face) {
+        for (size_t corner = 0; corner < 3; ++corner) {
+            ASSERT_EQ(actualVertices[actualFaces[face][corner]], _expectedVertices[_expectedFaces[face][corner]]);
+        }
+    }
+}
+
+TEST_F(MeshReaderTest, readBinaryPly) {
+    using namespace testing;
+    using namespace ::polyhedralGravity;
+
+    // Little endian with an additional vertex property
+    const std::vector<std::string> simpleFiles{"resources/MeshReaderTestReadSimpleBinary.ply"};
+    const auto&[actualVertices, actualFaces] = MeshReader::getPolyhedralSource(simpleFiles);
+
+    ASSERT_THAT(actualVertices, ContainerEq(_expectedVertices));
+    ASSERT_THAT(actualFaces, ContainerEq(_expectedFaces));
+}
+
+TEST_F(MeshReaderTest, readBigEndianPly) {
+    using namespace testing;
+    using namespace ::polyhedralGravity;
+
+    // Big endian with quads and an additional face property
+    const std::vector<std::string> simpleFiles{"resources/MeshReaderTestReadSimpleBigEndian.ply"};
+    const auto&[actualVertices, actualFaces] = MeshReader::getPolyhedralSource(simpleFiles);
+
+    const std::vector<std::array<size_t, 3>> expectedFaces = {
+            {0, 1, 2},
+            {0, 2, 3},
+            {4, 7, 6},
+            {4, 6, 5},
+            {0, 4, 5},
+            {0, 5, 1},
+            {1, 5, 6},
+            {1, 6, 2},
+            {2, 6, 7},
+            {2, 7, 3},
+            {3, 7, 4},
+            {3, 4, 0}
+    };
+    ASSERT_THAT(actualVertices, ContainerEq(_expectedVertices));
+    ASSERT_THAT(actualFaces, ContainerEq(expectedFaces));
+}
+
+TEST_F(MeshReaderTest, weldVerticesWithTolerance) {
+    using namespace testing;
+    using namespace ::polyhedralGravity;
+
+    const std::vector<std::array<double, 3>> vertices = {
+            {0.0, 0.0, 0.0},
+            {1.0, 0.0, 0.0},
+            {0.0, 1.0, 0.0},
+            {1.0 + 1e-9, 0.0, 0.0},
+            {0.0, 1.0 - 1e-9, 0.0},
+            {0.0, 0.0, 1.0}
+    };
+    const std::vector<std::array<size_t, 3>> faces = {{0, 1, 2}, {3, 4, 5}};
+
+    // Without tolerance only identical vertices are merged
+    const auto &[exactVertices, exactFaces] = MeshReader::weldVertices(vertices, faces);
+    ASSERT_EQ(exactVertices.size(), 6);
+    ASSERT_THAT(exactFaces, ContainerEq(faces));
+
+    const auto &[weldedVertices, weldedFaces] = MeshReader::weldVertices(vertices, faces, 1e-6);
+    ASSERT_THAT(weldedVertices, ElementsAre(vertices[0], vertices[1], vertices[2], vertices[5]));
+    ASSERT_THAT(weldedFaces, ElementsAre(std::array<size_t, 3>{0, 1, 2}, std::array<size_t, 3>{1, 2, 3}));
+}
+
+TEST_F(MeshReaderTest, weldVerticesAcrossCellBoundaries) {
+    using namespace testing;
+    using namespace ::polyhedralGravity;
+
+    const std::vector<std::array<double, 3>> vertices = {
+            {0.999, 0.0, 0.0},
+            {0.0, 1.0, 0.0},
+            {0.0, 0.0, 1.0},
+            // Within the tolerance of the first vertex, but in the neighbouring cell
+            {1.001, 0.0, 0.0},
+            // In the same cell as the next one, but farther apart than the tolerance
+            {0.0001, 0.0001, 0.0001},
+            {0.0099, 0.0099, 0.0099}
+    };
+    const std::vector<std::array<size_t, 3>> faces = {{0, 1, 2}, {3, 2, 1}, {4, 5, 1}};
+
+    const auto &[weldedVertices, weldedFaces] = MeshReader::weldVertices(vertices, faces, 0.01);
+    ASSERT_THAT(weldedVertices, ElementsAre(vertices[0], vertices[1], vertices[2], vertices[4], vertices[5]));
+    ASSERT_THAT(weldedFaces, ElementsAre(std::array<size_t, 3>{0, 1, 2}, std::array<size_t, 3>{0, 2, 1},
+                                         std::array<size_t, 3>{3, 4, 1}));
+    ASSERT_THROW(MeshReader::weldVertices(vertices, faces, -1.0), std::invalid_argument);
+
+    // The cells of non-finite or huge coordinates are not representable
+    const std::vector<std::array<double, 3>> infiniteVertices = {
+            {0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, std::numeric_limits<double>::infinity(), 0.0}};
+    ASSERT_THROW(MeshReader::weldVertices(infiniteVertices, {{0, 1, 2}}, 0.01), std::invalid_argument);
+    const std::vector<std::array<double, 3>> nanVertices = {
+            {0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 0.0, std::numeric_limits<double>::quiet_NaN()}};
+    ASSERT_THROW(MeshReader::weldVertices(nanVertices, {{0, 1, 2}}, 0.01), std::invalid_argument);
+    const std::vector<std::array<double, 3>> hugeVertices = {{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {1e17, 0.0, 0.0}};
+    ASSERT_THROW(MeshReader::weldVertices(hugeVertices, {{0, 1, 2}}, 0.01), std::invalid_argument);
+    ASSERT_NO_THROW(MeshReader::weldVertices(hugeVertices, {{0, 1, 2}}, 1.0));
+}
+
+TEST_F(MeshReaderTest, readPlyWithWeldTolerance) {
+    using namespace testing;
+    using namespace ::polyhedralGravity;
+
+    // A blank line in the header must not repeat the preceding property
+    writePly("element vertex 4\nproperty float x\nproperty float y\nproperty float z\n\n"
+             "element face 2\nproperty list char int vertex_indices\n",
+             {{0.0F, 0.0F, 0.0F}, {1.0F, 0.0F, 0.0F}, {0.0F, 1.0F, 0.0F}, {1e-4F, 0.0F, 0.0F}},
+             {{3, {0, 1, 2}}, {3, {3, 2, 1}}});
+    const std::vector<std::string> files{_plyFile.string()};
+
+    const auto &[exactVertices, exactFaces] = MeshReader::getPolyhedralSource(files);
+    ASSERT_EQ(exactVertices.size(), 4);
+    ASSERT_EQ(exactFaces.size(), 2);
+
+    const auto &[weldedVertices, weldedFaces] = MeshReader::getPolyhedralSource(files, 1e-3);
+    ASSERT_EQ(weldedVertices.size(), 3);
+    ASSERT_THAT(weldedFaces, ElementsAre(std::array<size_t, 3>{0, 1, 2}, std::array<size_t, 3>{0, 2, 1}));
+}
+
+TEST_F(MeshReaderTest, readPlyWithInvalidListSize) {
+    using namespace testing;
+    using namespace ::polyhedralGravity;
+
+    writePly("element vertex 3\nproperty float x\nproperty float y\nproperty float z\n"
+             "element face 1\nproperty list char int vertex_indices\n",
+             {{0.0F, 0.0F, 0.0F}, {1.0F, 0.0F, 0.0F}, {0.0F, 1.0F, 0.0F}},
+             {{-1, {0, 1, 2}}});
+    ASSERT_THROW(MeshReader::getPolyhedralSource({_plyFile.string()}), std::runtime_error);
+
+    writePly("element vertex 3\nproperty float x\nproperty float y\nproperty float z\n"
+             "element face 1\nproperty list char int vertex_indices\n",
+             {{0.0F, 0.0F, 0.0F}, {1.0F, 0.0F, 0.0F}, {0.0F, 1.0F, 0.0F}},
+             {{100, {0, 1, 2}}});
+    ASSERT_THROW(MeshReader::getPolyhedralSource({_plyFile.string()}), std::runtime_error);
+}
+
+TEST_F(MeshReaderTest, readPlyWithInvalidFaceIndex) {
+    using namespace testing;
+    using namespace ::polyhedralGravity;
+
+    // Negative and out of range corners are rejected before they are converted to an index
+    for (const int32_t index: {-1, 3, std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max()}) {
+        writePly("element vertex 3\nproperty float x\nproperty float y\nproperty float z\n"
+                 "element face 1\nproperty list char int vertex_indices\n",
+                 {{0.0F, 0.0F, 0.0F}, {1.0F, 0.0F, 0.0F}, {0.0F, 1.0F, 0.0F}},
+                 {{3, {0, 1, index}}});
+        ASSERT_THROW(MeshReader::getPolyhedralSource({_plyFile.string()}), std::runtime_error) << index;
+    }
+}
+
 TEST_F(MeshReaderTest, readSimpleObj) {
     using namespace testing;
     using namespace ::polyhedralGravity;
@@ -129,6 +361,32 @@ TEST_F(MeshReaderTest, readSimpleObj) {
     ASSERT_EQ(_expectedFaces.size(), actualFaces.size());
 }
 
+TEST_F(MeshReaderTest, readComplexObj) {
+    using namespace testing;
+    using namespace ::polyhedralGravity;
+
+    // Contains v/vt/vn index forms, negative indices, quads, and CRLF line endings
+    const std::vector<std::string> complexFiles{"resources/MeshReaderTestReadComplex.obj"};
+    const auto&[actualVertices, actualFaces] = MeshReader::getPolyhedralSource(complexFiles);
+
+    const std::vector<std::array<size_t, 3>> expectedFaces = {
+            {1, 2, 3},
+            {1, 3, 4},
+            {5, 8, 7},
+            {5, 7, 6},
+            {1, 5, 6},
+            {1, 6, 2},
+            {2, 6, 7},
+            {2, 7, 3},
+            {3, 7, 8},
+            {3, 8, 4},
+            {4, 8, 5},
+            {4, 5, 1}
+    };
+    ASSERT_THAT(actualVertices, ContainerEq(_expectedVertices));
+    ASSERT_THAT(actualFaces, ContainerEq(expectedFaces));
+}
+
 TEST_F(MeshReaderTest, readSimpleTab) {
     using namespace testing;
     using namespace ::polyhedralGravity;
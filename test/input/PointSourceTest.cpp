@@ -0,0 +1,177 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "polyhedralGravity/input/PointSource.h"
+
+/**
+ * Contains Tests for reading the computation points in chunks from the different file formats
+ */
+class PointSourceTest : public ::testing::Test {
+
+protected:
+    const std::filesystem::path _directory{std::filesystem::temp_directory_path() / "polyhedral-gravity-point-source-test"};
+
+    const std::vector<polyhedralGravity::Array3> _points{
+            {0.0, 0.0, 0.0}, {1.5, -2.0, 3.25}, {-1e3, 0.0078125, 42.0}, {7.0, 8.0, 9.0}, {-0.5, 0.25, -0.125}};
+
+    void SetUp() override {
+        std::filesystem::remove_all(_directory);
+        std::filesystem::create_directories(_directory);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(_directory);
+    }
+
+    static void writeBytes(const std::filesystem::path &path, const std::string &bytes) {
+        std::ofstream file{path, std::ios::binary};
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    /** Encodes a value in the given byte order */
+    template<typename T>
+    static std::string encode(T value, polyhedralGravity::util::ByteOrder byteOrder) {
+        std::string bytes(sizeof(T), '\0');
+        std::memcpy(bytes.data(), &value, sizeof(T));
+        if (byteOrder != polyhedralGravity::util::nativeByteOrder()) {
+            std::reverse(bytes.begin(), bytes.end());
+        }
+        return bytes;
+    }
+
+    /** Encodes the points as consecutive triples of T */
+    template<typename T>
+    std::string encodePoints(polyhedralGravity::util::ByteOrder byteOrder) const {
+        std::string bytes{};
+        for (const auto &point: _points) {
+            for (const double coordinate: point) {
+                bytes += encode(static_cast<T>(coordinate), byteOrder);
+            }
+        }
+        return bytes;
+    }
+
+    /** Creates a version 1.0 .npy file with the given header dictionary padded to 64 bytes */
+    static std::string npy(std::string dictionary, const std::string &data) {
+        const size_t length = 10 + dictionary.size() + 1;
+        dictionary.append((64 - length % 64) % 64, ' ');
+        dictionary.push_back('\n');
+        return std::string{"\x93NUMPY\x01\x00", 8} +
+               encode(static_cast<uint16_t>(dictionary.size()), polyhedralGravity::util::ByteOrder::LITTLE) +
+               dictionary + data;
+    }
+
+    /** Reads every point of the source in chunks of the given size */
+    static std::vector<polyhedralGravity::Array3> readAll(polyhedralGravity::PointSource &source, size_t chunkSize) {
+        std::vector<polyhedralGravity::Array3> points{}, chunk{};
+        while (source.read(chunk, chunkSize) > 0) {
+            EXPECT_LE(chunk.size(), chunkSize);
+            points.insert(points.end(), chunk.cbegin(), chunk.cend());
+        }
+        return points;
+    }
+
+};
+
+TEST_F(PointSourceTest, ReadVector) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    VectorPointSource source{_points};
+
+    EXPECT_EQ(source.size(), _points.size());
+    EXPECT_THAT(readAll(source, 2), ContainerEq(_points));
+}
+
+TEST_F(PointSourceTest, ReadRawBinary) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const std::filesystem::path path = _directory / "points.bin";
+    writeBytes(path, encodePoints<double>(util::ByteOrder::LITTLE));
+
+    const auto source = PointSource::fromFile(path.string());
+    EXPECT_EQ(source->size(), _points.size());
+    EXPECT_THAT(readAll(*source, 2), ContainerEq(_points));
+
+    // The size must be a multiple of three float64 values
+    writeBytes(path, encodePoints<double>(util::ByteOrder::LITTLE) + "x");
+    EXPECT_THROW(PointSource::fromFile(path.string()), std::runtime_error);
+}
+
+TEST_F(PointSourceTest, ReadNpy) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const std::filesystem::path path = _directory / "points.npy";
+
+    writeBytes(path, npy("{'descr': '<f8', 'fortran_order': False, 'shape': (5, 3), }",
+                         encodePoints<double>(util::ByteOrder::LITTLE)));
+    auto source = PointSource::fromFile(path.string());
+    EXPECT_EQ(source->size(), _points.size());
+    EXPECT_THAT(readAll(*source, 3), ContainerEq(_points));
+
+    // float32 in big endian byte order (all test coordinates are exactly representable)
+    writeBytes(path, npy("{'descr': '>f4', 'fortran_order': False, 'shape': (5, 3), }",
+                         encodePoints<float>(util::ByteOrder::BIG)));
+    source = PointSource::fromFile(path.string());
+    EXPECT_THAT(readAll(*source, 10), ContainerEq(_points));
+}
+
+TEST_F(PointSourceTest, ReadNpyUnsupported) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const std::filesystem::path path = _directory / "points.npy";
+    const std::string data = encodePoints<double>(util::ByteOrder::LITTLE);
+
+    writeBytes(path, npy("{'descr': '<i8', 'fortran_order': False, 'shape': (5, 3), }", data));
+    EXPECT_THROW(PointSource::fromFile(path.string()), std::runtime_error);
+
+    writeBytes(path, npy("{'descr': '<f8', 'fortran_order': True, 'shape': (5, 3), }", data));
+    EXPECT_THROW(PointSource::fromFile(path.string()), std::runtime_error);
+
+    writeBytes(path, npy("{'descr': '<f8', 'fortran_order': False, 'shape': (15,), }", data));
+    EXPECT_THROW(PointSource::fromFile(path.string()), std::runtime_error);
+
+    writeBytes(path, "no numpy file at all");
+    EXPECT_THROW(PointSource::fromFile(path.string()), std::runtime_error);
+
+    // The header promises more points than the file contains
+    writeBytes(path, npy("{'descr': '<f8', 'fortran_order': False, 'shape': (6, 3), }", data));
+    const auto source = PointSource::fromFile(path.string());
+    EXPECT_THROW(readAll(*source, 10), std::runtime_error);
+}
+
+TEST_F(PointSourceTest, ReadCSV) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const std::filesystem::path path = _directory / "points.csv";
+    writeBytes(path, "x,y,z\r\n"
+                     "0,0,0\r\n"
+                     "# a comment\n"
+                     "1.5, -2.0, 3.25\n"
+                     "\n"
+                     "-1e3;7.8125e-3;42\n"
+                     "7 8 9\n"
+                     "  -0.5\t0.25\t-0.125  \n");
+
+    const auto source = PointSource::fromFile(path.string());
+    EXPECT_FALSE(source->size().has_value());
+    EXPECT_THAT(readAll(*source, 2), ContainerEq(_points));
+}
+
+TEST_F(PointSourceTest, ReadCSVMalformed) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const std::filesystem::path path = _directory / "points.csv";
+    writeBytes(path, "0,0,0\n1,2\n");
+
+    const auto source = PointSource::fromFile(path.string());
+    EXPECT_THAT([&source]() { readAll(*source, 10); },
+                ThrowsMessage<std::runtime_error>(HasSubstr("line 2")));
+
+    EXPECT_THROW(PointSource::fromFile((_directory / "missing.csv").string()), std::runtime_error);
+}
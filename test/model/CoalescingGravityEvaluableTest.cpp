@@ -0,0 +1,97 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "polyhedralGravity/model/CoalescingGravityEvaluable.h"
+#include "polyhedralGravity/model/GravityEvaluable.h"
+#include "polyhedralGravity/model/Polyhedron.h"
+#include "CubePolyhedron.h"
+
+/**
+ * Contains Tests for coalescing concurrent single-point requests into batches
+ */
+class CoalescingGravityEvaluableTest : public ::testing::Test {
+
+protected:
+    const polyhedralGravity::GravityEvaluable _evaluable{polyhedralGravity::CubePolyhedron::create()};
+
+    /** Returns the i-th computation point of a test */
+    static polyhedralGravity::Array3 point(size_t i) {
+        return {0.1 * static_cast<double>(i % 50) - 2.0, 0.5, 0.05 * static_cast<double>(i % 7)};
+    }
+
+};
+
+TEST_F(CoalescingGravityEvaluableTest, ConcurrentRequests) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    constexpr size_t threadCount = 8;
+    constexpr size_t requestsPerThread = 50;
+    std::atomic<size_t> mismatches{0};
+    CoalescingStatistics statistics{};
+    {
+        CoalescingGravityEvaluable coalescing{_evaluable, 16, std::chrono::microseconds{2000}};
+        std::vector<std::thread> callers{};
+        for (size_t thread = 0; thread < threadCount; ++thread) {
+            callers.emplace_back([&, thread]() {
+                for (size_t i = 0; i < requestsPerThread; ++i) {
+                    const Array3 computationPoint = point(thread * requestsPerThread + i);
+                    const auto expected = std::get<GravityModelResult>(_evaluable(computationPoint, false));
+                    if (coalescing(computationPoint) != expected) {
+                        ++mismatches;
+                    }
+                }
+            });
+        }
+        for (auto &caller: callers) {
+            caller.join();
+        }
+        statistics = coalescing.getStatistics();
+    }
+    EXPECT_EQ(mismatches.load(), 0);
+    EXPECT_EQ(statistics.requests, threadCount * requestsPerThread);
+    EXPECT_LE(statistics.maximalBatchSize, 16);
+    // The concurrent requests have been coalesced
+    EXPECT_LT(statistics.batches, statistics.requests);
+}
+
+TEST_F(CoalescingGravityEvaluableTest, BatchSizeAndWait) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    CoalescingGravityEvaluable coalescing{_evaluable, 4, std::chrono::microseconds{50000}};
+    std::vector<std::future<GravityModelResult>> futures{};
+    for (size_t i = 0; i < 10; ++i) {
+        futures.push_back(coalescing.submit(point(i)));
+    }
+    // Two full batches are evaluated immediately, the remaining two requests after the maximal wait
+    for (size_t i = 0; i < futures.size(); ++i) {
+        EXPECT_EQ(futures[i].get(), std::get<GravityModelResult>(_evaluable(point(i), false))) << i;
+    }
+    const auto statistics = coalescing.getStatistics();
+    EXPECT_EQ(statistics.requests, 10);
+    EXPECT_EQ(statistics.batches, 3);
+    EXPECT_EQ(statistics.maximalBatchSize, 4);
+}
+
+TEST_F(CoalescingGravityEvaluableTest, PendingRequestsOnDestruction) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    std::future<GravityModelResult> future{};
+    {
+        CoalescingGravityEvaluable coalescing{_evaluable, 1024, std::chrono::microseconds{10000000}};
+        future = coalescing.submit(point(3));
+    }
+    ASSERT_EQ(future.wait_for(std::chrono::seconds{0}), std::future_status::ready);
+    EXPECT_EQ(future.get(), std::get<GravityModelResult>(_evaluable(point(3), false)));
+}
+
+TEST_F(CoalescingGravityEvaluableTest, InvalidBatchSize) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    EXPECT_THROW(CoalescingGravityEvaluable(_evaluable, 0), std::invalid_argument);
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <vector>
+#include "polyhedralGravity/model/Polyhedron.h"
+#include "polyhedralGravity/model/PolyhedronDefinitions.h"
+
+/**
+ * Contains the cube with edge length two centered at the origin, which many tests evaluate as small example mesh.
+ * It is the same mesh as the one of GravityModelCubeTest and the resources cube.node and cube.face.
+ */
+namespace polyhedralGravity::CubePolyhedron {
+
+    /** The vertices of the cube */
+    inline const std::vector<Array3> VERTICES{
+            {-1.0, -1.0, -1.0}, {1.0, -1.0, -1.0}, {1.0, 1.0, -1.0}, {-1.0, 1.0, -1.0},
+            {-1.0, -1.0, 1.0}, {1.0, -1.0, 1.0}, {1.0, 1.0, 1.0}, {-1.0, 1.0, 1.0}};
+
+    /** The faces of the cube, their plane unit normals point outwards */
+    inline const std::vector<IndexArray3> FACES{
+            {1, 3, 2}, {0, 3, 1}, {0, 1, 5}, {0, 5, 4}, {0, 7, 3}, {0, 4, 7},
+            {1, 2, 6}, {1, 6, 5}, {2, 3, 6}, {3, 7, 6}, {4, 5, 6}, {4, 6, 7}};
+
+    /**
+     * Creates the cube without checking its (known to be correct) mesh.
+     * @param density the constant density
+     * @param metricUnit the unit of the mesh
+     * @return the cube
+     */
+    inline Polyhedron create(double density = 1.0, const MetricUnit &metricUnit = MetricUnit::METER) {
+        return Polyhedron{VERTICES, FACES, density, NormalOrientation::OUTWARDS, PolyhedronIntegrity::DISABLE, metricUnit};
+    }
+
+}// namespace polyhedralGravity::CubePolyhedron
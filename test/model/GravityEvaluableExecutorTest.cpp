@@ -0,0 +1,100 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "polyhedralGravity/model/Executor.h"
+#include "polyhedralGravity/model/GravityEvaluable.h"
+#include "polyhedralGravity/model/Polyhedron.h"
+#include "ResultComparison.h"
+
+/**
+ * Contains Tests for running the parallel loops of a GravityEvaluable on a user-supplied executor
+ */
+class GravityEvaluableExecutorTest : public ::testing::Test {
+
+protected:
+    const polyhedralGravity::Polyhedron _polyhedron{
+            std::vector<std::string>{"resources/GravityModelBigTest.node", "resources/GravityModelBigTest.face"},
+            1.0, polyhedralGravity::NormalOrientation::OUTWARDS, polyhedralGravity::PolyhedronIntegrity::DISABLE};
+
+    const std::vector<polyhedralGravity::Array3> _points{polyhedralGravity::ResultComparison::POINTS};
+
+    /** Counts the calls of the user-supplied parallel for */
+    std::atomic<size_t> _calls{0};
+
+    /** Executor splitting every loop into four std::threads */
+    const std::shared_ptr<const polyhedralGravity::Executor> _threadExecutor{
+            std::make_shared<polyhedralGravity::FunctionExecutor>(
+                    [this](size_t count, const polyhedralGravity::Executor::RangeBody &body) {
+                        ++_calls;
+                        constexpr size_t threadCount = 4;
+                        std::vector<std::thread> threads{};
+                        for (size_t thread = 0; thread < threadCount; ++thread) {
+                            threads.emplace_back(body, count * thread / threadCount,
+                                                 count * (thread + 1) / threadCount);
+                        }
+                        for (auto &thread: threads) {
+                            thread.join();
+                        }
+                    })};
+
+};
+
+TEST_F(GravityEvaluableExecutorTest, IdenticalToDefault) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const GravityEvaluable expected{_polyhedron};
+    const GravityEvaluable serial{_polyhedron, MeshStorage::DOUBLE, std::make_shared<SerialExecutor>()};
+    const GravityEvaluable threaded{_polyhedron, MeshStorage::DOUBLE, _threadExecutor};
+    for (const auto &point: _points) {
+        const auto expectedResult = std::get<GravityModelResult>(expected(point, true));
+        const auto serialResult = std::get<GravityModelResult>(serial(point, true));
+        const auto threadedResult = std::get<GravityModelResult>(threaded(point, true));
+        ResultComparison::expectNear(serialResult, expectedResult);
+        // The fixed partitioning of the sum makes the result independent of the executor
+        EXPECT_EQ(threadedResult, serialResult);
+    }
+    EXPECT_GT(_calls.load(), 0);
+}
+
+TEST_F(GravityEvaluableExecutorTest, MultiplePoints) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const GravityEvaluable expected{_polyhedron};
+    const GravityEvaluable threaded{_polyhedron, MeshStorage::DOUBLE, _threadExecutor};
+    const auto expectedResults = std::get<std::vector<GravityModelResult>>(expected(_points, false));
+    for (const bool sortPoints: {false, true}) {
+        const size_t callsBefore = _calls.load();
+        const auto actualResults = std::get<std::vector<GravityModelResult>>(threaded(_points, true, sortPoints));
+        EXPECT_EQ(actualResults, expectedResults);
+        // The points are distributed by the executor, each one evaluated serially
+        EXPECT_EQ(_calls.load(), callsBefore + 1);
+    }
+}
+
+TEST_F(GravityEvaluableExecutorTest, CompactStorage) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const GravityEvaluable expected{_polyhedron, MeshStorage::COMPACT};
+    const GravityEvaluable threaded{_polyhedron, MeshStorage::COMPACT, _threadExecutor};
+    for (const auto &point: _points) {
+        ResultComparison::expectNear(std::get<GravityModelResult>(threaded(point, true)),
+                                     std::get<GravityModelResult>(expected(point, true)));
+    }
+}
+
+TEST_F(GravityEvaluableExecutorTest, WithExecutorSharesCaches) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const GravityEvaluable evaluable{_polyhedron};
+    EXPECT_EQ(evaluable.getExecutor(), nullptr);
+    const GravityEvaluable serial = evaluable.withExecutor(std::make_shared<SerialExecutor>());
+    EXPECT_NE(serial.getExecutor(), nullptr);
+    EXPECT_EQ(serial.getCaches(), evaluable.getCaches());
+    ResultComparison::expectNear(std::get<GravityModelResult>(serial(_points[1])),
+                                 std::get<GravityModelResult>(evaluable(_points[1])));
+}
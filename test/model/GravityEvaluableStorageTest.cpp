@@ -0,0 +1,63 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <stdexcept>
+#include <vector>
+#include "polyhedralGravity/model/GravityEvaluable.h"
+#include "polyhedralGravity/model/Polyhedron.h"
+#include "CubePolyhedron.h"
+#include "ResultComparison.h"
+
+/**
+ * Contains Tests for the compact storage of the caches of a GravityEvaluable
+ */
+class GravityEvaluableStorageTest : public ::testing::Test {
+
+protected:
+    const polyhedralGravity::Polyhedron _cube{polyhedralGravity::CubePolyhedron::create()};
+
+    const std::vector<polyhedralGravity::Array3> _points{polyhedralGravity::ResultComparison::pointsWith({{1.0, 0.0, 0.0}})};
+
+};
+
+TEST_F(GravityEvaluableStorageTest, CompactIsIdentical) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const GravityEvaluable expected{_cube};
+    const GravityEvaluable actual{_cube, MeshStorage::COMPACT};
+    EXPECT_EQ(actual.getStorage(), MeshStorage::COMPACT);
+
+    // The recomputed segment vectors equal the cached ones, hence so do the results
+    EXPECT_EQ(actual(_points, false), expected(_points, false));
+    const auto &[expectedPolyhedron, expectedSegmentVectors, expectedPlaneUnitNormals, expectedSegmentUnitNormals] = expected.getState();
+    const auto &[actualPolyhedron, actualSegmentVectors, actualPlaneUnitNormals, actualSegmentUnitNormals] = actual.getState();
+    EXPECT_EQ(actualSegmentVectors, expectedSegmentVectors);
+    EXPECT_EQ(actualPlaneUnitNormals, expectedPlaneUnitNormals);
+    EXPECT_EQ(actualSegmentUnitNormals, expectedSegmentUnitNormals);
+
+    const auto [segmentVectors, planeUnitNormals, segmentUnitNormals] = actual.getCaches();
+    EXPECT_EQ(segmentVectors, nullptr);
+    EXPECT_NE(planeUnitNormals, nullptr);
+}
+
+TEST_F(GravityEvaluableStorageTest, CompactFloat32IsAccurate) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const auto expected = std::get<std::vector<GravityModelResult>>(GravityEvaluable{_cube}(_points, true));
+    const GravityEvaluable compact{_cube, MeshStorage::COMPACT_FLOAT32};
+    const auto actual = std::get<std::vector<GravityModelResult>>(compact(_points, true));
+    EXPECT_THAT(compact.getCaches(), FieldsAre(nullptr, nullptr, nullptr));
+
+    ResultComparison::expectNear(actual, expected, 1e-6);
+}
+
+TEST_F(GravityEvaluableStorageTest, CompactFloat32RejectsDegeneratedFaces) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    std::vector<IndexArray3> faces{_cube.getFaces()};
+    faces.push_back({0, 1, 1});
+    const Polyhedron degenerated{_cube.getVertices(), faces, 1.0, NormalOrientation::OUTWARDS, PolyhedronIntegrity::DISABLE};
+
+    EXPECT_THAT([&]() { GravityEvaluable(degenerated, MeshStorage::COMPACT_FLOAT32); },
+                ThrowsMessage<std::invalid_argument>(HasSubstr("face 12")));
+}
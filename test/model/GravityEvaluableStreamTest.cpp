@@ -0,0 +1,94 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <functional>
+#include <list>
+#include <stdexcept>
+#include <vector>
+#include "polyhedralGravity/input/PointSource.h"
+#include "polyhedralGravity/model/GravityEvaluable.h"
+#include "polyhedralGravity/model/Polyhedron.h"
+#include "CubePolyhedron.h"
+#include "ResultComparison.h"
+
+/**
+ * Contains Tests for the streamed (chunk by chunk) evaluation of a GravityEvaluable
+ */
+class GravityEvaluableStreamTest : public ::testing::Test {
+
+protected:
+    const polyhedralGravity::GravityEvaluable _evaluable{polyhedralGravity::CubePolyhedron::create()};
+
+    const std::vector<polyhedralGravity::Array3> _points{
+            polyhedralGravity::ResultComparison::pointsWith({{5.0, 5.0, 5.0}, {-2.0, 0.0, 0.0}})};
+
+    /** Collects every chunk passed to the sink */
+    struct CollectingSink {
+        std::vector<size_t> firstIndices{};
+        std::vector<size_t> chunkSizes{};
+        std::vector<polyhedralGravity::GravityModelResult> results{};
+
+        bool operator()(size_t firstIndex, const std::vector<polyhedralGravity::Array3> &points,
+                        const std::vector<polyhedralGravity::GravityModelResult> &chunkResults) {
+            EXPECT_EQ(points.size(), chunkResults.size());
+            firstIndices.push_back(firstIndex);
+            chunkSizes.push_back(points.size());
+            results.insert(results.end(), chunkResults.cbegin(), chunkResults.cend());
+            return true;
+        }
+    };
+
+};
+
+TEST_F(GravityEvaluableStreamTest, StreamRange) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const auto expected = std::get<std::vector<GravityModelResult>>(_evaluable(_points, true));
+    CollectingSink sink{};
+
+    // A single pass range, i.e. no random access
+    const std::list<Array3> points{_points.cbegin(), _points.cend()};
+    const size_t evaluated = _evaluable.stream(points.cbegin(), points.cend(), std::ref(sink), 3);
+
+    EXPECT_EQ(evaluated, _points.size());
+    EXPECT_THAT(sink.firstIndices, ElementsAre(0, 3, 6));
+    EXPECT_THAT(sink.chunkSizes, ElementsAre(3, 3, 1));
+    EXPECT_EQ(sink.results, expected);
+}
+
+TEST_F(GravityEvaluableStreamTest, StreamPointSource) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const auto expected = std::get<std::vector<GravityModelResult>>(_evaluable(_points, false));
+    VectorPointSource source{_points};
+    CollectingSink sink{};
+
+    EXPECT_EQ(_evaluable.stream(source, std::ref(sink), 4, false), _points.size());
+    EXPECT_THAT(sink.firstIndices, ElementsAre(0, 4));
+    EXPECT_EQ(sink.results, expected);
+}
+
+TEST_F(GravityEvaluableStreamTest, EarlyTermination) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    VectorPointSource source{_points};
+    size_t calls{0};
+
+    // The sink stops after the second chunk, the remaining points are neither read nor evaluated
+    const size_t evaluated = _evaluable.stream(source, [&calls](size_t, const auto &, const auto &) {
+        return ++calls < 2;
+    }, 2);
+
+    EXPECT_EQ(calls, 2);
+    EXPECT_EQ(evaluated, 4);
+    std::vector<Array3> remaining{};
+    EXPECT_EQ(source.read(remaining, 10), 3);
+}
+
+TEST_F(GravityEvaluableStreamTest, InvalidChunkSize) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    EXPECT_THROW(_evaluable.stream(_points.cbegin(), _points.cend(), [](size_t, const auto &, const auto &) {
+        return true;
+    }, 0), std::invalid_argument);
+}
@@ -0,0 +1,109 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <filesystem>
+#include <fstream>
+#include "polyhedralGravity/model/IntegrityCache.h"
+#include "polyhedralGravity/model/Polyhedron.h"
+#include "CubePolyhedron.h"
+
+/**
+ * Contains Tests for the on-disk cache of the mesh integrity checks
+ */
+class IntegrityCacheTest : public ::testing::Test {
+
+protected:
+    const std::filesystem::path _directory{std::filesystem::temp_directory_path() / "polyhedral-gravity-integrity-test"};
+
+    // CubePolyhedron::FACES, but faces 0 and 4 have inwards pointing normals
+    const std::vector<polyhedralGravity::IndexArray3> _facesOutwardsMajority{
+            {3, 1, 2},
+            {0, 3, 1},
+            {0, 1, 5},
+            {0, 5, 4},
+            {7, 0, 3},
+            {0, 4, 7},
+            {1, 2, 6},
+            {1, 6, 5},
+            {2, 3, 6},
+            {3, 7, 6},
+            {4, 5, 6},
+            {4, 6, 7}
+    };
+
+    void SetUp() override {
+        std::filesystem::remove_all(_directory);
+        polyhedralGravity::IntegrityCache::setDirectory(_directory.string());
+    }
+
+    void TearDown() override {
+        polyhedralGravity::IntegrityCache::setDirectory("");
+        std::filesystem::remove_all(_directory);
+    }
+
+    [[nodiscard]] size_t countCacheFiles() const {
+        return std::distance(std::filesystem::directory_iterator{_directory}, std::filesystem::directory_iterator{});
+    }
+};
+
+TEST_F(IntegrityCacheTest, HashDependsOnContent) {
+    using namespace polyhedralGravity;
+    const uint64_t hash = IntegrityCache::hash(CubePolyhedron::VERTICES, CubePolyhedron::FACES, NormalOrientation::OUTWARDS);
+    EXPECT_EQ(hash, IntegrityCache::hash(CubePolyhedron::VERTICES, CubePolyhedron::FACES, NormalOrientation::OUTWARDS));
+    EXPECT_NE(hash, IntegrityCache::hash(CubePolyhedron::VERTICES, CubePolyhedron::FACES, NormalOrientation::INWARDS));
+    EXPECT_NE(hash, IntegrityCache::hash(CubePolyhedron::VERTICES, _facesOutwardsMajority, NormalOrientation::OUTWARDS));
+}
+
+TEST_F(IntegrityCacheTest, StoreAndLoad) {
+    using namespace polyhedralGravity;
+    using namespace testing;
+    EXPECT_EQ(IntegrityCache::load(42, 12), std::nullopt);
+    IntegrityCache::store(42, 12, {false, NormalOrientation::INWARDS, {3, 7}});
+
+    const auto record = IntegrityCache::load(42, 12);
+    ASSERT_TRUE(record.has_value());
+    EXPECT_FALSE(record->degenerated);
+    EXPECT_EQ(record->actualOrientation, NormalOrientation::INWARDS);
+    EXPECT_THAT(record->violatingIndices, ContainerEq(std::set<size_t>({3, 7})));
+
+    // A different number of faces is treated as stale record
+    EXPECT_EQ(IntegrityCache::load(42, 13), std::nullopt);
+}
+
+TEST_F(IntegrityCacheTest, MatchingHashSkipsCheck) {
+    using namespace polyhedralGravity;
+    // The first construction runs the checks and stores the outcome
+    EXPECT_NO_THROW(Polyhedron(CubePolyhedron::VERTICES, CubePolyhedron::FACES, 1.0, NormalOrientation::OUTWARDS, PolyhedronIntegrity::VERIFY));
+    EXPECT_EQ(countCacheFiles(), 1);
+
+    // Tamper with the record, the next construction trusts the cache and does not run the checks
+    const uint64_t key = IntegrityCache::hash(CubePolyhedron::VERTICES, CubePolyhedron::FACES, NormalOrientation::OUTWARDS);
+    IntegrityCache::store(key, CubePolyhedron::FACES.size(), {false, NormalOrientation::OUTWARDS, {5}});
+    EXPECT_THROW(Polyhedron(CubePolyhedron::VERTICES, CubePolyhedron::FACES, 1.0, NormalOrientation::OUTWARDS, PolyhedronIntegrity::VERIFY), std::invalid_argument);
+    IntegrityCache::store(key, CubePolyhedron::FACES.size(), {true, NormalOrientation::OUTWARDS, {}});
+    EXPECT_THROW(Polyhedron(CubePolyhedron::VERTICES, CubePolyhedron::FACES, 1.0, NormalOrientation::OUTWARDS, PolyhedronIntegrity::VERIFY), std::invalid_argument);
+}
+
+TEST_F(IntegrityCacheTest, HealIsReplayed) {
+    using namespace polyhedralGravity;
+    using namespace testing;
+    const Polyhedron healed(CubePolyhedron::VERTICES, _facesOutwardsMajority, 1.0, NormalOrientation::INWARDS, PolyhedronIntegrity::HEAL);
+    const uint64_t key = IntegrityCache::hash(CubePolyhedron::VERTICES, _facesOutwardsMajority, NormalOrientation::INWARDS);
+    const auto record = IntegrityCache::load(key, _facesOutwardsMajority.size());
+    ASSERT_TRUE(record.has_value());
+    EXPECT_EQ(record->actualOrientation, NormalOrientation::OUTWARDS);
+    EXPECT_THAT(record->violatingIndices, ContainerEq(std::set<size_t>({0, 4})));
+
+    // Replaying the record leads to the same healed polyhedron
+    const Polyhedron replayed(CubePolyhedron::VERTICES, _facesOutwardsMajority, 1.0, NormalOrientation::INWARDS, PolyhedronIntegrity::HEAL);
+    EXPECT_EQ(replayed.getOrientation(), NormalOrientation::OUTWARDS);
+    EXPECT_THAT(replayed.getFaces(), ContainerEq(CubePolyhedron::FACES));
+    EXPECT_THAT(replayed.getFaces(), ContainerEq(healed.getFaces()));
+}
+
+TEST_F(IntegrityCacheTest, DisabledCache) {
+    using namespace polyhedralGravity;
+    IntegrityCache::setDirectory("");
+    EXPECT_NO_THROW(Polyhedron(CubePolyhedron::VERTICES, CubePolyhedron::FACES, 1.0, NormalOrientation::OUTWARDS, PolyhedronIntegrity::VERIFY));
+    EXPECT_FALSE(std::filesystem::exists(_directory));
+}
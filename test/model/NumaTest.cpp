@@ -0,0 +1,137 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "polyhedralGravity/model/GravityEvaluable.h"
+#include "polyhedralGravity/model/Numa.h"
+#include "polyhedralGravity/model/NumaGravityEvaluable.h"
+#include "polyhedralGravity/model/Polyhedron.h"
+#include "CubePolyhedron.h"
+#include "ResultComparison.h"
+
+/**
+ * Contains Tests for the NUMA topology, the pinned thread pools, and the NUMA-aware evaluation
+ */
+class NumaTest : public ::testing::Test {
+
+protected:
+    const polyhedralGravity::Polyhedron _polyhedron{
+            std::vector<std::string>{"resources/GravityModelBigTest.node", "resources/GravityModelBigTest.face"},
+            1.0, polyhedralGravity::NormalOrientation::OUTWARDS, polyhedralGravity::PolyhedronIntegrity::DISABLE};
+
+    const std::vector<polyhedralGravity::Array3> _points{
+            polyhedralGravity::ResultComparison::pointsWith({{4.0, -2.0, 1.0}, {-1.0, -1.0, -1.0}})};
+
+    /**
+     * Two fake nodes sharing the CPUs of the first detected node, so that the replication is tested on any machine
+     */
+    static std::vector<polyhedralGravity::NumaNode> twoNodes() {
+        const std::vector<size_t> cpus = polyhedralGravity::detectNumaNodes().front().cpus;
+        return {{0, cpus}, {1, std::vector<size_t>(cpus.begin(), cpus.begin() + (cpus.size() + 1) / 2)}};
+    }
+
+};
+
+TEST_F(NumaTest, ParseCpuList) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    EXPECT_THAT(parseCpuList("0-3,8-9"), ElementsAre(0, 1, 2, 3, 8, 9));
+    EXPECT_THAT(parseCpuList("5\n"), ElementsAre(5));
+    EXPECT_THAT(parseCpuList(""), IsEmpty());
+    EXPECT_THAT(parseCpuList("4,2-3,2"), ElementsAre(2, 3, 4));
+    EXPECT_THROW(parseCpuList("3-1"), std::invalid_argument);
+    EXPECT_THROW(parseCpuList("a-b"), std::invalid_argument);
+    EXPECT_THROW(parseCpuList("1:2"), std::invalid_argument);
+}
+
+TEST_F(NumaTest, DetectNodes) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const auto nodes = detectNumaNodes();
+    ASSERT_THAT(nodes, Not(IsEmpty()));
+    for (const auto &node: nodes) {
+        EXPECT_THAT(node.cpus, Not(IsEmpty()));
+    }
+}
+
+TEST_F(NumaTest, PinnedThreadPool) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const PinnedThreadPool pool{std::vector<size_t>{0, 0, 0, 0}};
+    EXPECT_EQ(pool.countThreads(), 4);
+    // Every index is visited exactly once, also by nested loops
+    std::vector<std::atomic<size_t>> visits(1000);
+    pool.parallelFor(10, [&pool, &visits](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            pool.parallelFor(100, [&visits, i](size_t innerBegin, size_t innerEnd) {
+                for (size_t j = innerBegin; j < innerEnd; ++j) {
+                    ++visits[i * 100 + j];
+                }
+            });
+        }
+    });
+    for (const auto &count: visits) {
+        EXPECT_EQ(count.load(), 1);
+    }
+    EXPECT_THROW(pool.parallelFor(100, [](size_t begin, size_t) {
+        if (begin == 0) {
+            throw std::runtime_error("failure");
+        }
+    }), std::runtime_error);
+}
+
+TEST_F(NumaTest, IdenticalToGravityEvaluable) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const GravityEvaluable expected{_polyhedron};
+    const NumaGravityEvaluable numaEvaluable{_polyhedron, MeshStorage::DOUBLE, twoNodes()};
+    ASSERT_EQ(numaEvaluable.getNodes().size(), 2);
+    // The replicas own copies of the mesh
+    EXPECT_NE(&numaEvaluable.getReplica(0).getPolyhedron().getVertices(), &_polyhedron.getVertices());
+    EXPECT_NE(&numaEvaluable.getReplica(0).getPolyhedron().getVertices(),
+              &numaEvaluable.getReplica(1).getPolyhedron().getVertices());
+
+    const auto expectedResults = std::get<std::vector<GravityModelResult>>(expected(_points, false));
+    for (const bool sortPoints: {false, true}) {
+        const auto actualResults = std::get<std::vector<GravityModelResult>>(numaEvaluable(_points, true, sortPoints));
+        ResultComparison::expectDoubleEq(actualResults, expectedResults);
+    }
+
+    std::vector<double> potential(_points.size());
+    numaEvaluable.evaluate(_points.data(), _points.size(), potential.data(), nullptr, nullptr);
+    for (size_t i = 0; i < _points.size(); ++i) {
+        EXPECT_DOUBLE_EQ(potential[i], std::get<0>(expectedResults[i]));
+    }
+
+    const auto singleResult = std::get<GravityModelResult>(numaEvaluable(_points[1]));
+    ResultComparison::expectNear(singleResult, expectedResults[1]);
+}
+
+TEST_F(NumaTest, UnreferencedVertex) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    // The cube preceded by an unreferenced vertex with index zero
+    std::vector<Array3> vertices{{-5.0, -5.0, -5.0}};
+    vertices.insert(vertices.end(), CubePolyhedron::VERTICES.cbegin(), CubePolyhedron::VERTICES.cend());
+    std::vector<IndexArray3> faces{};
+    for (const IndexArray3 &face: CubePolyhedron::FACES) {
+        faces.push_back({face[0] + 1, face[1] + 1, face[2] + 1});
+    }
+    const Polyhedron polyhedron{vertices, faces, 1.0, NormalOrientation::OUTWARDS, PolyhedronIntegrity::DISABLE,
+                                MetricUnit::METER, VertexIndexing::ZERO_BASED};
+
+    // The replicas keep the indexing of the polyhedron, although its vertex with index zero is unreferenced
+    const NumaGravityEvaluable numaEvaluable{polyhedron, MeshStorage::DOUBLE, twoNodes()};
+    EXPECT_THAT(numaEvaluable.getReplica(0).getPolyhedron().getFaces(), ContainerEq(faces));
+    EXPECT_THAT(numaEvaluable.getReplica(1).getPolyhedron().getFaces(), ContainerEq(faces));
+}
+
+TEST_F(NumaTest, InvalidNodes) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    EXPECT_THROW(NumaGravityEvaluable(_polyhedron, MeshStorage::DOUBLE, {}), std::invalid_argument);
+    EXPECT_THROW(NumaGravityEvaluable(_polyhedron, MeshStorage::DOUBLE, {NumaNode{0, {}}}), std::invalid_argument);
+}
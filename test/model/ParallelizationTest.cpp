@@ -0,0 +1,140 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "polyhedralGravity/model/GravityEvaluable.h"
+#include "polyhedralGravity/model/Parallelization.h"
+#include "polyhedralGravity/model/Polyhedron.h"
+#include "CubePolyhedron.h"
+#include "ResultComparison.h"
+
+/**
+ * Contains Tests for the runtime selection of the parallelization backend
+ */
+class ParallelizationTest : public ::testing::Test {
+
+protected:
+    const polyhedralGravity::GravityEvaluable _evaluable{polyhedralGravity::CubePolyhedron::create()};
+
+    const std::vector<polyhedralGravity::Array3> _points{polyhedralGravity::ResultComparison::POINTS};
+
+    /** The default settings before the test, restored afterward */
+    const polyhedralGravity::ParallelizationSettings _default{polyhedralGravity::Parallelization::getDefault()};
+
+    void TearDown() override {
+        polyhedralGravity::Parallelization::setDefault(_default);
+    }
+
+};
+
+TEST_F(ParallelizationTest, AvailableBackends) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const auto backends = Parallelization::availableBackends();
+    EXPECT_THAT(backends, Contains(ParallelizationBackend::CPP));
+    EXPECT_THAT(backends, Contains(Parallelization::getDefault().backend));
+    EXPECT_TRUE(Parallelization::isAvailable(ParallelizationBackend::CPP));
+
+    EXPECT_EQ(readParallelizationBackend("TBB"), ParallelizationBackend::TBB);
+    EXPECT_THROW(readParallelizationBackend("CUDA"), std::invalid_argument);
+}
+
+TEST_F(ParallelizationTest, ScopeOverridesDefault) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    Parallelization::setDefault({ParallelizationBackend::CPP, 0});
+    {
+        const ParallelizationScope scope{ParallelizationSettings{ParallelizationBackend::CPP, 2}};
+        EXPECT_EQ(Parallelization::current().threads, 2);
+        {
+            // Only the number of threads is replaced
+            const ParallelizationScope innerScope{1};
+            EXPECT_EQ(Parallelization::current().backend, ParallelizationBackend::CPP);
+            EXPECT_EQ(Parallelization::current().threads, 1);
+        }
+        EXPECT_EQ(Parallelization::current().threads, 2);
+        // The default does not apply within the scope
+        EXPECT_EQ(Parallelization::getDefault().threads, 0);
+    }
+    EXPECT_EQ(Parallelization::current().threads, 0);
+}
+
+TEST_F(ParallelizationTest, ConcurrentDefault) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const ParallelizationBackend other = Parallelization::availableBackends().back();
+    Parallelization::setDefault({ParallelizationBackend::CPP, 1});
+    EXPECT_EQ(Parallelization::getDefault().threads, 1);
+    Parallelization::setDefault({ParallelizationBackend::CPP, std::numeric_limits<size_t>::max()});
+    EXPECT_EQ(Parallelization::getDefault().threads, std::numeric_limits<uint64_t>::max() >> 8);
+    Parallelization::setDefault({ParallelizationBackend::CPP, 1});
+
+    // Readers always observe one of the set defaults, never a mix of two
+    std::atomic<bool> done{false};
+    std::atomic<size_t> mixed{0};
+    std::thread reader{[&]() {
+        while (!done) {
+            const ParallelizationSettings settings = Parallelization::getDefault();
+            const bool first = settings.backend == ParallelizationBackend::CPP && settings.threads == 1;
+            const bool second = settings.backend == other && settings.threads == 2;
+            if (!first && !second) {
+                ++mixed;
+            }
+            std::this_thread::yield();
+        }
+    }};
+    for (size_t i = 0; i < 1000; ++i) {
+        Parallelization::setDefault({ParallelizationBackend::CPP, 1});
+        Parallelization::setDefault({other, 2});
+    }
+    done = true;
+    reader.join();
+    EXPECT_EQ(mixed.load(), 0);
+}
+
+TEST_F(ParallelizationTest, UnavailableBackend) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    for (const ParallelizationBackend backend: {ParallelizationBackend::OMP, ParallelizationBackend::TBB}) {
+        if (!Parallelization::isAvailable(backend)) {
+            EXPECT_THROW(Parallelization::setDefault({backend, 0}), std::invalid_argument);
+            EXPECT_THROW(ParallelizationScope(ParallelizationSettings{backend, 0}), std::invalid_argument);
+        }
+    }
+}
+
+TEST_F(ParallelizationTest, IdenticalResultsOnEveryBackend) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const auto expected = std::get<std::vector<GravityModelResult>>(_evaluable(_points, false));
+    for (const ParallelizationBackend backend: Parallelization::availableBackends()) {
+        for (const size_t threads: {0, 1, 3}) {
+            const ParallelizationScope scope{ParallelizationSettings{backend, threads}};
+            SCOPED_TRACE(testing::Message() << backend << " " << threads);
+            ResultComparison::expectDoubleEq(std::get<std::vector<GravityModelResult>>(_evaluable(_points, true)), expected);
+        }
+    }
+}
+
+TEST_F(ParallelizationTest, OversizedThreadCount) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    EXPECT_EQ(Parallelization::threadLimit(1), 1);
+    EXPECT_GE(Parallelization::threadLimit(size_t{1} << 40), 1);
+    EXPECT_GE(Parallelization::threadLimit(std::numeric_limits<size_t>::max()), 1);
+    EXPECT_EQ(Parallelization::threadLimit(std::numeric_limits<size_t>::max()),
+              Parallelization::threadLimit(static_cast<size_t>(std::numeric_limits<int>::max()) + 1));
+
+    // A number of threads which does not fit into an int must neither reach OpenMP nor TBB unclamped
+    const auto expected = std::get<std::vector<GravityModelResult>>(_evaluable(_points, false));
+    for (const ParallelizationBackend backend: Parallelization::availableBackends()) {
+        const ParallelizationScope scope{ParallelizationSettings{backend, size_t{1} << 40}};
+        SCOPED_TRACE(testing::Message() << backend);
+        ResultComparison::expectDoubleEq(std::get<std::vector<GravityModelResult>>(_evaluable(_points, true)), expected);
+    }
+}
@@ -0,0 +1,112 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <stdexcept>
+#include <vector>
+#include "polyhedralGravity/input/PointSource.h"
+#include "polyhedralGravity/model/GravityEvaluable.h"
+#include "polyhedralGravity/model/Pipeline.h"
+#include "polyhedralGravity/model/Polyhedron.h"
+#include "polyhedralGravity/output/ResultWriter.h"
+#include "CubePolyhedron.h"
+
+/**
+ * Contains Tests for the pipelined evaluation of a stream of computation points
+ */
+class PipelineTest : public ::testing::Test {
+
+protected:
+    /** Collects the written results in memory */
+    class CollectingWriter final : public polyhedralGravity::ResultWriter {
+    public:
+        std::vector<polyhedralGravity::Array3> points{};
+        std::vector<polyhedralGravity::GravityModelResult> results{};
+
+        void write(const std::vector<polyhedralGravity::Array3> &computationPoints,
+                   const std::vector<polyhedralGravity::GravityModelResult> &gravityResults) override {
+            points.insert(points.end(), computationPoints.cbegin(), computationPoints.cend());
+            results.insert(results.end(), gravityResults.cbegin(), gravityResults.cend());
+        }
+    };
+
+    /** Fails after the given number of points */
+    class FailingPointSource final : public polyhedralGravity::PointSource {
+        size_t _remaining;
+    public:
+        explicit FailingPointSource(size_t remaining) : _remaining{remaining} {}
+
+        size_t read(std::vector<polyhedralGravity::Array3> &points, size_t maxCount) override {
+            if (_remaining == 0) {
+                throw std::runtime_error("The point source failed.");
+            }
+            points.assign(std::min(maxCount, _remaining), {3.0, 4.0, 5.0});
+            _remaining -= points.size();
+            return points.size();
+        }
+
+        [[nodiscard]] std::optional<size_t> size() const override {
+            return std::nullopt;
+        }
+    };
+
+    const polyhedralGravity::GravityEvaluable _evaluable{polyhedralGravity::CubePolyhedron::create()};
+
+    static std::vector<polyhedralGravity::Array3> createPoints(size_t count) {
+        std::vector<polyhedralGravity::Array3> points(count);
+        for (size_t i = 0; i < count; ++i) {
+            points[i] = {static_cast<double>(i % 7) - 3.0, static_cast<double>(i % 5) * 0.5, static_cast<double>(i) * 0.01};
+        }
+        return points;
+    }
+
+};
+
+TEST_F(PipelineTest, SameResultsAsSequential) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const std::vector<Array3> points = createPoints(1000);
+    VectorPointSource source{points};
+    CollectingWriter writer{};
+
+    const Pipeline::Statistics statistics = Pipeline::run(source, _evaluable, &writer, 64, 2);
+
+    EXPECT_THAT(writer.points, ContainerEq(points));
+    EXPECT_EQ(writer.results, std::get<std::vector<GravityModelResult>>(_evaluable(points, true)));
+    for (const Pipeline::StageStatistics &stage: {statistics.read, statistics.evaluate, statistics.write}) {
+        EXPECT_EQ(stage.points, 1000);
+        EXPECT_EQ(stage.chunks, 16);
+    }
+    EXPECT_LE(statistics.readQueue.maximum, 2);
+    EXPECT_LE(statistics.writeQueue.maximum, 2);
+}
+
+TEST_F(PipelineTest, EmptySource) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    VectorPointSource source{{}};
+    CollectingWriter writer{};
+
+    const Pipeline::Statistics statistics = Pipeline::run(source, _evaluable, &writer, 64, 2);
+    EXPECT_THAT(writer.points, IsEmpty());
+    EXPECT_EQ(statistics.write.chunks, 0);
+}
+
+TEST_F(PipelineTest, FailingStage) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    FailingPointSource source{500};
+
+    EXPECT_THAT([&]() { Pipeline::run(source, _evaluable, nullptr, 64, 1); },
+                ThrowsMessage<std::runtime_error>(HasSubstr("The point source failed.")));
+}
+
+TEST_F(PipelineTest, ZeroChunkSize) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    VectorPointSource source{{{1.0, 2.0, 3.0}}};
+    CollectingWriter writer{};
+
+    // A chunk size of zero would end the reader immediately and silently skip every point
+    EXPECT_THROW(Pipeline::run(source, _evaluable, &writer, 0, 2), std::invalid_argument);
+    EXPECT_THAT(writer.points, IsEmpty());
+}
@@ -2,6 +2,8 @@
 #include "gmock/gmock.h"
 
 #include <array>
+#include <memory>
+#include "polyhedralGravity/model/GravityEvaluable.h"
 #include "polyhedralGravity/model/Polyhedron.h"
 
 
@@ -345,3 +347,177 @@ TEST_F(PolyhedronTest, FileDoesNotExistPolyhedron) {
             );
 }
 
+
+TEST_F(PolyhedronTest, TopologicalEqualsRayCasting) {
+    using namespace polyhedralGravity;
+    using namespace testing;
+    // Both strategies must agree on the majority orientation and the violating indices
+    for (const auto &faces: {_facesOutwards, _facesInwards, _facesOutwardsMajority, _facesInwardsMajority}) {
+        Polyhedron polyhedron(_cubeVertices, faces, 1.0, NormalOrientation::OUTWARDS, PolyhedronIntegrity::DISABLE);
+        const auto topological = polyhedron.checkPlaneUnitNormalOrientation(OrientationCheckStrategy::TOPOLOGICAL);
+        const auto rayCasting = polyhedron.checkPlaneUnitNormalOrientation(OrientationCheckStrategy::RAY_CASTING);
+        EXPECT_EQ(topological.first, rayCasting.first);
+        EXPECT_THAT(topological.second, ContainerEq(rayCasting.second));
+    }
+    for (const auto &faces: {_prismOutwards, _prismInwards}) {
+        Polyhedron polyhedron(_prismVertices, faces, 1.0, NormalOrientation::OUTWARDS, PolyhedronIntegrity::DISABLE);
+        const auto topological = polyhedron.checkPlaneUnitNormalOrientation(OrientationCheckStrategy::TOPOLOGICAL);
+        const auto rayCasting = polyhedron.checkPlaneUnitNormalOrientation(OrientationCheckStrategy::RAY_CASTING);
+        EXPECT_EQ(topological.first, rayCasting.first);
+        EXPECT_THAT(topological.second, ContainerEq(rayCasting.second));
+    }
+}
+
+TEST_F(PolyhedronTest, TopologyClosedCube) {
+    using namespace polyhedralGravity;
+    using namespace testing;
+    // The cube is closed and orientable, independent of the vertex ordering of its faces
+    Polyhedron polyhedron(_cubeVertices, _facesOutwardsMajority, 1.0, NormalOrientation::OUTWARDS, PolyhedronIntegrity::DISABLE);
+    const MeshTopology topology = polyhedron.checkMeshTopology();
+    EXPECT_TRUE(topology.isClosedManifold());
+    EXPECT_THAT(topology.openEdges, IsEmpty());
+    EXPECT_THAT(topology.nonManifoldEdges, IsEmpty());
+    EXPECT_EQ(topology.componentCount, 1);
+    EXPECT_THAT(topology.faceComponents, Each(Eq(0)));
+}
+
+TEST_F(PolyhedronTest, TopologyOpenCube) {
+    using namespace polyhedralGravity;
+    using namespace testing;
+    // Removing the first two faces (the bottom) opens the cube at the edges of the bottom square
+    const std::vector<IndexArray3> openFaces(_facesOutwards.cbegin() + 2, _facesOutwards.cend());
+    Polyhedron polyhedron(_cubeVertices, openFaces, 1.0, NormalOrientation::OUTWARDS, PolyhedronIntegrity::DISABLE);
+    const MeshTopology topology = polyhedron.checkMeshTopology();
+    EXPECT_FALSE(topology.isClosedManifold());
+    EXPECT_THAT(topology.openEdges, UnorderedElementsAre(Pair(0, 1), Pair(1, 2), Pair(2, 3), Pair(0, 3)));
+    EXPECT_THAT(topology.nonManifoldEdges, IsEmpty());
+    EXPECT_EQ(topology.componentCount, 1);
+
+    // The topological strategy falls back to ray casting for open meshes
+    const auto topological = polyhedron.checkPlaneUnitNormalOrientation(OrientationCheckStrategy::TOPOLOGICAL);
+    const auto rayCasting = polyhedron.checkPlaneUnitNormalOrientation(OrientationCheckStrategy::RAY_CASTING);
+    EXPECT_EQ(topological.first, rayCasting.first);
+    EXPECT_THAT(topological.second, ContainerEq(rayCasting.second));
+}
+
+TEST_F(PolyhedronTest, TopologyTwoComponents) {
+    using namespace polyhedralGravity;
+    using namespace testing;
+    // Two disjoint cubes, the second one with inwards pointing normals
+    std::vector<Array3> vertices{_cubeVertices};
+    for (const auto &vertex: _cubeVertices) {
+        vertices.push_back({vertex[0] + 10.0, vertex[1], vertex[2]});
+    }
+    std::vector<IndexArray3> faces{_facesOutwards};
+    for (const auto &face: _facesInwards) {
+        faces.push_back({face[0] + 8, face[1] + 8, face[2] + 8});
+    }
+    Polyhedron polyhedron(vertices, faces, 1.0, NormalOrientation::OUTWARDS, PolyhedronIntegrity::DISABLE);
+    const MeshTopology topology = polyhedron.checkMeshTopology();
+    EXPECT_TRUE(topology.isClosedManifold());
+    EXPECT_EQ(topology.componentCount, 2);
+
+    const auto &[majorityOrientation, violatingIndices] = polyhedron.checkPlaneUnitNormalOrientation(OrientationCheckStrategy::TOPOLOGICAL);
+    EXPECT_EQ(majorityOrientation, NormalOrientation::OUTWARDS);
+    EXPECT_THAT(violatingIndices, ContainerEq(std::set<size_t>({12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23})));
+}
+
+TEST_F(PolyhedronTest, ZeroBasedIndexing) {
+    using namespace polyhedralGravity;
+    using namespace testing;
+    // The vertex with index zero is unreferenced
+    std::vector<Array3> vertices{{-5.0, -5.0, -5.0}};
+    vertices.insert(vertices.end(), _cubeVertices.cbegin(), _cubeVertices.cend());
+
+    const Polyhedron automatic{vertices, _facesCorrection, 1.0, NormalOrientation::OUTWARDS, PolyhedronIntegrity::DISABLE};
+    EXPECT_THAT(automatic.getFaces(), ContainerEq(_facesOutwards));
+    const Polyhedron zeroBased{vertices, _facesCorrection, 1.0, NormalOrientation::OUTWARDS, PolyhedronIntegrity::DISABLE,
+                               MetricUnit::METER, VertexIndexing::ZERO_BASED};
+    EXPECT_THAT(zeroBased.getFaces(), ContainerEq(_facesCorrection));
+    const Polyhedron shared{std::make_shared<const std::vector<Array3>>(vertices),
+                            std::make_shared<const std::vector<IndexArray3>>(_facesCorrection), 1.0,
+                            NormalOrientation::OUTWARDS, PolyhedronIntegrity::VERIFY, MetricUnit::METER,
+                            VertexIndexing::ZERO_BASED};
+    EXPECT_THAT(shared.getFaces(), ContainerEq(_facesCorrection));
+}
+
+TEST_F(PolyhedronTest, SharedMeshBuffers) {
+    using namespace polyhedralGravity;
+    using namespace testing;
+    const auto vertices = std::make_shared<const std::vector<Array3>>(_cubeVertices);
+    const auto faces = std::make_shared<const std::vector<IndexArray3>>(_facesOutwards);
+    const Polyhedron polyhedron{vertices, faces, 1.0, NormalOrientation::OUTWARDS, PolyhedronIntegrity::DISABLE};
+
+    // Neither the construction nor copies of the polyhedron or an evaluable copy the mesh
+    EXPECT_EQ(polyhedron.getSharedVertices(), vertices);
+    EXPECT_EQ(polyhedron.getSharedFaces(), faces);
+    const Polyhedron copy{polyhedron};
+    EXPECT_EQ(copy.getSharedVertices(), vertices);
+    const GravityEvaluable evaluable{polyhedron};
+    const GravityEvaluable evaluableCopy{evaluable};
+    EXPECT_EQ(evaluableCopy.getPolyhedron().getSharedVertices(), vertices);
+    EXPECT_EQ(evaluableCopy.getPolyhedron().getSharedFaces(), faces);
+}
+
+TEST_F(PolyhedronTest, SharedMeshBuffersCopyOnWrite) {
+    using namespace polyhedralGravity;
+    using namespace testing;
+    const auto vertices = std::make_shared<const std::vector<Array3>>(_cubeVertices);
+    const auto oneBasedFaces = std::make_shared<const std::vector<IndexArray3>>(_facesCorrection);
+    const auto majorityFaces = std::make_shared<const std::vector<IndexArray3>>(_facesOutwardsMajority);
+
+    // Shifting the indexing to start with zero creates a new buffer and leaves the shared one untouched
+    const Polyhedron shifted{vertices, oneBasedFaces, 1.0, NormalOrientation::OUTWARDS, PolyhedronIntegrity::DISABLE};
+    EXPECT_EQ(shifted.getSharedVertices(), vertices);
+    EXPECT_NE(shifted.getSharedFaces(), oneBasedFaces);
+    EXPECT_THAT(shifted.getFaces(), ContainerEq(_facesOutwards));
+    EXPECT_THAT(*oneBasedFaces, ContainerEq(_facesCorrection));
+
+    // Healing the orientation creates a new buffer and leaves the shared one untouched
+    const Polyhedron healed{vertices, majorityFaces, 1.0, NormalOrientation::OUTWARDS, PolyhedronIntegrity::HEAL};
+    EXPECT_NE(healed.getSharedFaces(), majorityFaces);
+    EXPECT_THAT(healed.getFaces(), ContainerEq(_facesOutwards));
+    EXPECT_THAT(*majorityFaces, ContainerEq(_facesOutwardsMajority));
+}
+
+TEST_F(PolyhedronTest, SharedMeshBuffersNull) {
+    using namespace polyhedralGravity;
+    EXPECT_THROW(Polyhedron(nullptr, std::make_shared<const std::vector<IndexArray3>>(_facesOutwards), 1.0),
+                 std::invalid_argument);
+}
+
+TEST_F(PolyhedronTest, ReorderedAlongSpaceFillingCurve) {
+    using namespace polyhedralGravity;
+    using namespace testing;
+    const Polyhedron polyhedron{_cubeVertices, _facesOutwards, 1.0, NormalOrientation::OUTWARDS, PolyhedronIntegrity::DISABLE};
+    for (const SpaceFillingCurve curve: {SpaceFillingCurve::MORTON, SpaceFillingCurve::HILBERT}) {
+        const Polyhedron reordered = polyhedron.reordered(curve);
+        ASSERT_EQ(reordered.countVertices(), polyhedron.countVertices());
+        ASSERT_EQ(reordered.countFaces(), polyhedron.countFaces());
+        EXPECT_NE(reordered.getSharedVertices(), polyhedron.getSharedVertices());
+
+        // Every face consists of the same vertices in the same order as its original face
+        const std::vector<size_t> vertexPermutation = reordered.getVertexPermutation();
+        const std::vector<size_t> facePermutation = reordered.getFacePermutation();
+        EXPECT_THAT(facePermutation, UnorderedElementsAre(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11));
+        for (size_t i = 0; i < reordered.countVertices(); ++i) {
+            EXPECT_EQ(reordered.getVertex(i), polyhedron.getVertex(vertexPermutation[i]));
+        }
+        for (size_t i = 0; i < reordered.countFaces(); ++i) {
+            EXPECT_EQ(reordered.getResolvedFace(i), polyhedron.getResolvedFace(facePermutation[i]));
+        }
+        EXPECT_EQ(reordered.checkPlaneUnitNormalOrientation().second, std::set<size_t>{});
+    }
+    // The first vertex of the Hilbert curve is the one in the corner of the bounding cube
+    EXPECT_EQ(polyhedron.reordered().getVertex(0), (Array3{-1.0, -1.0, -1.0}));
+    // Reordering twice keeps the mapping to the original order
+    const Polyhedron twice = polyhedron.reordered(SpaceFillingCurve::MORTON).reordered(SpaceFillingCurve::HILBERT);
+    const std::vector<size_t> facePermutation = twice.getFacePermutation();
+    for (size_t i = 0; i < twice.countFaces(); ++i) {
+        EXPECT_EQ(twice.getResolvedFace(i), polyhedron.getResolvedFace(facePermutation[i]));
+    }
+    // Only the summation order of the faces changes
+    const auto expected = std::get<GravityModelResult>(GravityEvaluable{polyhedron}(Array3{2.0, 1.0, 0.5}));
+    const auto actual = std::get<GravityModelResult>(GravityEvaluable{twice}(Array3{2.0, 1.0, 0.5}));
+    EXPECT_NEAR(std::get<0>(actual), std::get<0>(expected), 1e-12 * std::abs(std::get<0>(expected)));
+}
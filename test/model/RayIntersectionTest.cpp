@@ -0,0 +1,67 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <vector>
+#include "polyhedralGravity/model/RayIntersection.h"
+#include "CubePolyhedron.h"
+
+/**
+ * Contains Tests for the batched Möller–Trumbore ray-triangle intersection kernel
+ */
+class RayIntersectionTest : public ::testing::Test {
+};
+
+TEST_F(RayIntersectionTest, RayThroughCube) {
+    using namespace polyhedralGravity;
+    using namespace testing;
+    const RayIntersection::TriangleSoA triangles{CubePolyhedron::VERTICES, CubePolyhedron::FACES};
+    ASSERT_EQ(triangles.size(), 12);
+    std::vector<double> hits{};
+
+    // Entering the bottom and leaving the top face
+    EXPECT_EQ(RayIntersection::countIntersections({0.5, 0.25, -5.0}, {0.0, 0.0, 1.0}, triangles, hits), 2);
+    EXPECT_THAT(hits, ElementsAre(DoubleNear(4.0, 1e-12), DoubleNear(6.0, 1e-12)));
+
+    // Pointing away from the cube
+    EXPECT_EQ(RayIntersection::countIntersections({0.5, 0.25, -5.0}, {0.0, 0.0, -1.0}, triangles, hits), 0);
+    EXPECT_THAT(hits, IsEmpty());
+}
+
+TEST_F(RayIntersectionTest, SharedEdgeIsDeduplicated) {
+    using namespace polyhedralGravity;
+    using namespace testing;
+    const RayIntersection::TriangleSoA triangles{CubePolyhedron::VERTICES, CubePolyhedron::FACES};
+    std::vector<double> hits{};
+
+    // The ray leaves through the diagonal shared by the two triangles of the top face
+    EXPECT_EQ(RayIntersection::intersectRay({0.0, 0.0, 0.0}, {0.0, 0.0, 1.0}, triangles, hits), 2);
+    EXPECT_EQ(RayIntersection::countIntersections({0.0, 0.0, 0.0}, {0.0, 0.0, 1.0}, triangles, hits), 1);
+    EXPECT_THAT(hits, ElementsAre(DoubleEq(1.0)));
+}
+
+TEST_F(RayIntersectionTest, BatchesEqualScalar) {
+    using namespace polyhedralGravity;
+    using namespace testing;
+    // Ten triangles, so that the last ones are not part of a full batch
+    const std::vector<IndexArray3> faces(CubePolyhedron::FACES.cbegin(), CubePolyhedron::FACES.cbegin() + 10);
+    const RayIntersection::TriangleSoA triangles{CubePolyhedron::VERTICES, faces};
+    const std::vector<std::pair<Array3, Array3>> rays{
+            {{0.2, 0.3, 0.1}, {0.0, 0.0, 1.0}},
+            {{0.2, 0.3, 0.1}, {0.0, 0.0, -1.0}},
+            {{0.2, 0.3, 0.1}, {1.0, 0.0, 0.0}},
+            {{0.2, 0.3, 0.1}, {0.0, -1.0, 0.0}},
+            {{-3.0, 0.1, -0.4}, {1.0, 0.0, 0.0}}
+    };
+    std::vector<double> hits{};
+    for (const auto &[origin, direction]: rays) {
+        std::vector<double> expected{};
+        for (size_t index = 0; index < triangles.size(); ++index) {
+            const double distance = RayIntersection::intersectTriangle(origin, direction, triangles, index);
+            if (distance > 0.0) {
+                expected.push_back(distance);
+            }
+        }
+        RayIntersection::intersectRay(origin, direction, triangles, hits);
+        EXPECT_THAT(hits, UnorderedElementsAreArray(expected));
+    }
+}
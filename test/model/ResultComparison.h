@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "polyhedralGravity/model/PolyhedronDefinitions.h"
+
+/**
+ * Contains the computation points and the comparison of results, which the tests of the different ways to evaluate
+ * a GravityEvaluable (executors, worker teams, compact storage, ...) share to check them against each other.
+ */
+namespace polyhedralGravity::ResultComparison {
+
+    /** The default relative epsilon, as the faces may be summed up in a different order */
+    constexpr double TEST_EPSILON = 1e-10;
+
+    /** Computation points inside, on the surface, and outside of the cube (see CubePolyhedron.h) */
+    inline const std::vector<Array3> POINTS{
+            {0.0, 0.0, 0.0}, {2.0, 1.0, 0.5}, {-3.0, 4.0, 10.0}, {1.0, 1.0, 1.0}, {0.5, -0.5, 0.25}};
+
+    /**
+     * Returns the shared points followed by additional ones.
+     * @param additionalPoints the points appended to {@link POINTS}
+     * @return the points
+     */
+    inline std::vector<Array3> pointsWith(const std::vector<Array3> &additionalPoints) {
+        std::vector<Array3> points{POINTS};
+        points.insert(points.end(), additionalPoints.cbegin(), additionalPoints.cend());
+        return points;
+    }
+
+    /**
+     * Returns the ten components of a result.
+     * @param result the result
+     * @return the potential, the three acceleration components, and the six tensor components
+     */
+    inline std::vector<double> components(const GravityModelResult &result) {
+        const auto &[potential, acceleration, tensor] = result;
+        std::vector<double> values{potential};
+        values.insert(values.end(), acceleration.cbegin(), acceleration.cend());
+        values.insert(values.end(), tensor.cbegin(), tensor.cend());
+        return values;
+    }
+
+    /**
+     * Compares the results component-wise with a relative epsilon (absolute for components close to zero).
+     * @param actual the actual result
+     * @param expected the expected result
+     * @param epsilon the relative epsilon
+     */
+    inline void expectNear(const GravityModelResult &actual, const GravityModelResult &expected,
+                           double epsilon = TEST_EPSILON) {
+        const std::vector<double> actualValues = components(actual);
+        const std::vector<double> expectedValues = components(expected);
+        for (size_t i = 0; i < actualValues.size(); ++i) {
+            EXPECT_NEAR(actualValues[i], expectedValues[i], epsilon * (1.0 + std::abs(expectedValues[i])))
+                    << "Component " << i;
+        }
+    }
+
+    /**
+     * Compares the results of a batch point by point, see the single result's overload.
+     * @param actual the actual results
+     * @param expected the expected results
+     * @param epsilon the relative epsilon
+     */
+    inline void expectNear(const std::vector<GravityModelResult> &actual, const std::vector<GravityModelResult> &expected,
+                           double epsilon = TEST_EPSILON) {
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t i = 0; i < actual.size(); ++i) {
+            SCOPED_TRACE("Point " + std::to_string(i));
+            expectNear(actual[i], expected[i], epsilon);
+        }
+    }
+
+    /**
+     * Compares the results of a batch component-wise within four ULPs, i.e. for evaluations which sum up the faces
+     * of every point in the same order.
+     * @param actual the actual results
+     * @param expected the expected results
+     */
+    inline void expectDoubleEq(const std::vector<GravityModelResult> &actual, const std::vector<GravityModelResult> &expected) {
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t i = 0; i < actual.size(); ++i) {
+            const std::vector<double> actualValues = components(actual[i]);
+            const std::vector<double> expectedValues = components(expected[i]);
+            for (size_t j = 0; j < actualValues.size(); ++j) {
+                EXPECT_DOUBLE_EQ(actualValues[j], expectedValues[j]) << "Point " << i << " component " << j;
+            }
+        }
+    }
+
+}// namespace polyhedralGravity::ResultComparison
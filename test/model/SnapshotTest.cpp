@@ -0,0 +1,253 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include "polyhedralGravity/model/Snapshot.h"
+#include "polyhedralGravity/model/GravityEvaluable.h"
+#include "polyhedralGravity/model/Polyhedron.h"
+#include "CubePolyhedron.h"
+#include "ResultComparison.h"
+
+/**
+ * Contains Tests for the binary snapshot of a Polyhedron and a GravityEvaluable
+ */
+class SnapshotTest : public ::testing::Test {
+
+protected:
+    const std::filesystem::path _directory{std::filesystem::temp_directory_path() / "polyhedral-gravity-snapshot-test"};
+
+    const polyhedralGravity::Polyhedron _cube{polyhedralGravity::CubePolyhedron::create(42.0, polyhedralGravity::MetricUnit::KILOMETER)};
+
+    const std::vector<polyhedralGravity::Array3> _points{polyhedralGravity::ResultComparison::POINTS};
+
+    void SetUp() override {
+        std::filesystem::remove_all(_directory);
+        std::filesystem::create_directories(_directory);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(_directory);
+    }
+
+    static std::vector<char> readBytes(const std::filesystem::path &path) {
+        std::ifstream file{path, std::ios::binary};
+        return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    }
+
+    static void writeBytes(const std::filesystem::path &path, const std::vector<char> &bytes) {
+        std::ofstream file{path, std::ios::binary};
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    /** Converts a snapshot to the opposite byte order, every value following the first 12 bytes has 8 bytes */
+    static std::vector<char> swapByteOrder(std::vector<char> bytes) {
+        using polyhedralGravity::util::ByteOrder;
+        bytes[8] = static_cast<char>(bytes[8] == static_cast<char>(ByteOrder::LITTLE) ? ByteOrder::BIG : ByteOrder::LITTLE);
+        std::reverse(bytes.begin() + 12, bytes.begin() + 16);
+        for (size_t offset = 16; offset + 8 <= bytes.size(); offset += 8) {
+            std::reverse(bytes.begin() + offset, bytes.begin() + offset + 8);
+        }
+        return bytes;
+    }
+
+};
+
+TEST_F(SnapshotTest, PolyhedronRoundTrip) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const std::string filename = (_directory / "cube.pgsnap").string();
+    Snapshot::write(filename, _cube);
+
+    const Polyhedron actual = Snapshot::readPolyhedron(filename);
+    EXPECT_THAT(actual.getVertices(), ContainerEq(_cube.getVertices()));
+    EXPECT_THAT(actual.getFaces(), ContainerEq(_cube.getFaces()));
+    EXPECT_DOUBLE_EQ(actual.getDensity(), _cube.getDensity());
+    EXPECT_EQ(actual.getOrientation(), _cube.getOrientation());
+    EXPECT_EQ(actual.getMeshUnit(), _cube.getMeshUnit());
+
+    // A snapshot without caches yields a GravityEvaluable computing them
+    const GravityEvaluable evaluable = Snapshot::readGravityEvaluable(filename);
+    EXPECT_EQ(std::get<1>(evaluable.getState()), std::get<1>(GravityEvaluable{_cube}.getState()));
+}
+
+TEST_F(SnapshotTest, GravityEvaluableRoundTrip) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const std::string filename = (_directory / "cube.pgsnap").string();
+    const GravityEvaluable expected{_cube};
+    Snapshot::write(filename, expected);
+
+    const GravityEvaluable actual = Snapshot::readGravityEvaluable(filename);
+    const auto &[expectedPolyhedron, expectedSegmentVectors, expectedPlaneUnitNormals, expectedSegmentUnitNormals] = expected.getState();
+    const auto &[actualPolyhedron, actualSegmentVectors, actualPlaneUnitNormals, actualSegmentUnitNormals] = actual.getState();
+    EXPECT_THAT(actualSegmentVectors, ContainerEq(expectedSegmentVectors));
+    EXPECT_THAT(actualPlaneUnitNormals, ContainerEq(expectedPlaneUnitNormals));
+    EXPECT_THAT(actualSegmentUnitNormals, ContainerEq(expectedSegmentUnitNormals));
+    EXPECT_EQ(std::get<std::vector<GravityModelResult>>(actual(_points)),
+              std::get<std::vector<GravityModelResult>>(expected(_points)));
+}
+
+TEST_F(SnapshotTest, UnreferencedVertexRoundTrip) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const std::string filename = (_directory / "unreferenced.pgsnap").string();
+    // The unreferenced vertex is the first one along the space-filling curve
+    std::vector<Array3> vertices{CubePolyhedron::VERTICES};
+    vertices.push_back({-5.0, -5.0, -5.0});
+    const Polyhedron reordered = Polyhedron{vertices, CubePolyhedron::FACES, 1.0, NormalOrientation::OUTWARDS,
+                                            PolyhedronIntegrity::DISABLE}.reordered();
+    ASSERT_EQ(reordered.getVertex(0), (Array3{-5.0, -5.0, -5.0}));
+    const GravityEvaluable expected{reordered};
+    Snapshot::write(filename, expected);
+
+    // Restoring does not mistake the indexing for one starting with one
+    EXPECT_THAT(Snapshot::readPolyhedron(filename).getFaces(), ContainerEq(reordered.getFaces()));
+    EXPECT_EQ(Snapshot::readGravityEvaluable(filename)(_points, false), expected(_points, false));
+}
+
+TEST_F(SnapshotTest, ForeignByteOrder) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const std::filesystem::path native = _directory / "native.pgsnap";
+    const std::filesystem::path foreign = _directory / "foreign.pgsnap";
+    const GravityEvaluable expected{_cube};
+    Snapshot::write(native.string(), expected);
+    writeBytes(foreign, swapByteOrder(readBytes(native)));
+
+    const GravityEvaluable actual = Snapshot::readGravityEvaluable(foreign.string());
+    EXPECT_THAT(std::get<0>(actual.getState()).getVertices(), ContainerEq(_cube.getVertices()));
+    EXPECT_THAT(std::get<0>(actual.getState()).getFaces(), ContainerEq(_cube.getFaces()));
+    EXPECT_EQ(std::get<std::vector<GravityModelResult>>(actual(_points)),
+              std::get<std::vector<GravityModelResult>>(expected(_points)));
+}
+
+TEST_F(SnapshotTest, InvalidSnapshots) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const std::filesystem::path valid = _directory / "valid.pgsnap";
+    const std::filesystem::path invalid = _directory / "invalid.pgsnap";
+    Snapshot::write(valid.string(), GravityEvaluable{_cube});
+    const std::vector<char> bytes = readBytes(valid);
+
+    // Truncated
+    writeBytes(invalid, std::vector<char>(bytes.begin(), bytes.end() - 8));
+    EXPECT_THROW(Snapshot::readGravityEvaluable(invalid.string()), std::runtime_error);
+
+    // Wrong magic
+    std::vector<char> wrongMagic{bytes};
+    wrongMagic[0] = 'X';
+    writeBytes(invalid, wrongMagic);
+    EXPECT_THROW(Snapshot::readPolyhedron(invalid.string()), std::runtime_error);
+
+    // Unsupported version
+    std::vector<char> wrongVersion{bytes};
+    wrongVersion[12] = static_cast<char>(wrongVersion[12] + 1);
+    wrongVersion[15] = static_cast<char>(wrongVersion[15] + 1);
+    writeBytes(invalid, wrongVersion);
+    EXPECT_THROW(Snapshot::readPolyhedron(invalid.string()), std::runtime_error);
+
+    // A face referring to a non-existing vertex
+    std::vector<char> wrongFace{bytes};
+    const uint64_t nonExistingVertex = _cube.countVertices();
+    std::memcpy(wrongFace.data() + Snapshot::readHeader(MappedFile{valid.string()}, valid.string()).offsets[1],
+                &nonExistingVertex, sizeof(uint64_t));
+    writeBytes(invalid, wrongFace);
+    EXPECT_THROW(Snapshot::readPolyhedron(invalid.string()), std::runtime_error);
+}
+
+TEST_F(SnapshotTest, SharedMemory) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const std::string name = "/polyhedral-gravity-snapshot-test";
+    const GravityEvaluable expected{_cube};
+    Snapshot::writeSharedMemory(name, expected);
+
+    const GravityEvaluable first = Snapshot::readSharedMemory(name);
+    const GravityEvaluable second = Snapshot::readSharedMemory(name);
+    Snapshot::removeSharedMemory(name);
+
+    // Attaching is possible as long as the object exists, attached evaluables remain valid afterward
+    EXPECT_THROW(Snapshot::readSharedMemory(name), std::runtime_error);
+    EXPECT_EQ(std::get<1>(first.getState()), std::get<1>(expected.getState()));
+    EXPECT_EQ(std::get<std::vector<GravityModelResult>>(first(_points)),
+              std::get<std::vector<GravityModelResult>>(expected(_points)));
+    EXPECT_EQ(std::get<std::vector<GravityModelResult>>(second(_points)),
+              std::get<std::vector<GravityModelResult>>(expected(_points)));
+}
+
+TEST_F(SnapshotTest, ReplaceSharedMemory) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const std::string name = "/polyhedral-gravity-snapshot-replace-test";
+    const GravityEvaluable expected{_cube};
+    const GravityEvaluable replacement{CubePolyhedron::create(1.0)};
+    Snapshot::writeSharedMemory(name, expected);
+    const GravityEvaluable attached = Snapshot::readSharedMemory(name);
+
+    // Replacing the object does not alter the memory of attached evaluables
+    Snapshot::writeSharedMemory(name, replacement);
+    const GravityEvaluable reattached = Snapshot::readSharedMemory(name);
+    Snapshot::removeSharedMemory(name);
+    EXPECT_EQ(attached(_points, false), expected(_points, false));
+    EXPECT_EQ(reattached(_points, false), replacement(_points, false));
+    EXPECT_EQ(reattached.getPolyhedron().getDensity(), 1.0);
+}
+
+TEST_F(SnapshotTest, IncompleteSnapshot) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const std::filesystem::path path = _directory / "incomplete.pgsnap";
+    Snapshot::write(path.string(), GravityEvaluable{_cube});
+
+    // A snapshot whose magic is not yet written (like a shared-memory object being written) is rejected
+    std::vector<char> bytes = readBytes(path);
+    std::fill_n(bytes.begin(), sizeof(Snapshot::MAGIC), '\0');
+    writeBytes(path, bytes);
+    EXPECT_THROW(Snapshot::readGravityEvaluable(path.string()), std::runtime_error);
+}
+
+TEST_F(SnapshotTest, CompactStorage) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const std::string filename = (_directory / "compact.pgsnap").string();
+    const GravityEvaluable expected{_cube, MeshStorage::COMPACT_FLOAT32};
+    Snapshot::write(filename, expected);
+
+    // The compact caches are not stored, but recomputed in the same storage
+    const GravityEvaluable actual = Snapshot::readGravityEvaluable(filename);
+    EXPECT_EQ(actual.getStorage(), MeshStorage::COMPACT_FLOAT32);
+    EXPECT_EQ(actual(_points, false), expected(_points, false));
+    EXPECT_FALSE(Snapshot::readHeader(MappedFile{filename}, filename).hasCaches);
+}
+
+TEST_F(SnapshotTest, SourceDigest) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const std::filesystem::path node = _directory / "mesh.node";
+    const std::filesystem::path face = _directory / "mesh.face";
+    writeBytes(node, {'4', ' ', '3', '\n'});
+    writeBytes(face, {'4', ' ', '0', '\n'});
+    const std::vector<std::string> files{node.string(), face.string()};
+    const uint64_t digest = Snapshot::digestSource(files);
+    EXPECT_NE(digest, 0);
+    EXPECT_EQ(Snapshot::digestSource(files), digest);
+    EXPECT_NE(Snapshot::digestSource(files, 1e-6), digest);
+    EXPECT_NE(Snapshot::digestSource({face.string(), node.string()}), digest);
+    EXPECT_NE(Snapshot::digestSource(files, 0.0, PolyhedronIntegrity::HEAL), digest);
+
+    // The snapshot stores the digest, which changes along with the content of the mesh files
+    const std::string filename = (_directory / "cube.pgsnap").string();
+    Snapshot::write(filename, GravityEvaluable{_cube}, digest);
+    EXPECT_EQ(Snapshot::readHeader(MappedFile{filename}, filename).sourceDigest, digest);
+    // The modification time is set explicitly, since the file system's clock may be coarser than the test
+    const auto modified = std::filesystem::last_write_time(face);
+    writeBytes(face, {'4', ' ', '1', '\n'});
+    std::filesystem::last_write_time(face, modified + std::chrono::seconds{1});
+    EXPECT_NE(Snapshot::digestSource(files), digest);
+    EXPECT_THROW(Snapshot::digestSource({(_directory / "missing.node").string()}), std::runtime_error);
+}
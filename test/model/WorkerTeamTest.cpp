@@ -0,0 +1,126 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "polyhedralGravity/model/GravityEvaluable.h"
+#include "polyhedralGravity/model/Polyhedron.h"
+#include "polyhedralGravity/model/WorkerTeam.h"
+#include "ResultComparison.h"
+
+/**
+ * Contains Tests for the persistent worker team and the latency-optimized evaluation of single points
+ */
+class WorkerTeamTest : public ::testing::Test {
+
+protected:
+    const polyhedralGravity::Polyhedron _polyhedron{
+            std::vector<std::string>{"resources/GravityModelBigTest.node", "resources/GravityModelBigTest.face"},
+            1.0, polyhedralGravity::NormalOrientation::OUTWARDS, polyhedralGravity::PolyhedronIntegrity::DISABLE};
+
+    const std::vector<polyhedralGravity::Array3> _points{polyhedralGravity::ResultComparison::POINTS};
+
+};
+
+TEST_F(WorkerTeamTest, RunsEveryThreadOnce) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    // A single spin iteration parks the workers between the jobs, which must not lose a job
+    for (const size_t spinIterations: {size_t{1}, WorkerTeam::DEFAULT_SPIN_ITERATIONS}) {
+        WorkerTeam team{4, spinIterations};
+        ASSERT_EQ(team.countThreads(), 4);
+        std::vector<std::atomic<size_t>> calls(team.countThreads());
+        for (size_t job = 0; job < 1000; ++job) {
+            team.run([&calls](size_t thread) { ++calls[thread]; });
+            if (job % 100 == 0) {
+                std::this_thread::yield();
+            }
+        }
+        for (const auto &count: calls) {
+            EXPECT_EQ(count.load(), 1000);
+        }
+    }
+}
+
+TEST_F(WorkerTeamTest, PropagatesExceptions) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    WorkerTeam team{3};
+    EXPECT_THROW(team.run([](size_t thread) {
+        if (thread == 2) {
+            throw std::runtime_error("failure");
+        }
+    }), std::runtime_error);
+    // The team remains usable
+    std::atomic<size_t> calls{0};
+    team.run([&calls](size_t) { ++calls; });
+    EXPECT_EQ(calls.load(), 3);
+}
+
+TEST_F(WorkerTeamTest, IdenticalToDefault) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const GravityEvaluable expected{_polyhedron};
+    const auto team = std::make_shared<WorkerTeam>(4);
+    const GravityEvaluable latencyEvaluable = expected.withWorkerTeam(team);
+    EXPECT_EQ(latencyEvaluable.getWorkerTeam(), team);
+    EXPECT_EQ(latencyEvaluable.getCaches(), expected.getCaches());
+    for (const auto &point: _points) {
+        const auto actual = std::get<GravityModelResult>(latencyEvaluable(point, true));
+        ResultComparison::expectNear(actual, std::get<GravityModelResult>(expected(point, true)));
+        // The fixed partitioning makes repeated evaluations identical
+        EXPECT_EQ(std::get<GravityModelResult>(latencyEvaluable(point, true)), actual);
+    }
+}
+
+TEST_F(WorkerTeamTest, ConcurrentCallers) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const GravityEvaluable latencyEvaluable = GravityEvaluable{_polyhedron, MeshStorage::COMPACT}
+            .withWorkerTeam(std::make_shared<WorkerTeam>(2));
+    const auto expected = std::get<GravityModelResult>(latencyEvaluable(_points[1], true));
+    std::vector<std::thread> callers{};
+    std::atomic<size_t> mismatches{0};
+    for (size_t caller = 0; caller < 4; ++caller) {
+        callers.emplace_back([&]() {
+            for (size_t i = 0; i < 20; ++i) {
+                if (std::get<GravityModelResult>(latencyEvaluable(_points[1], true)) != expected) {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+    for (auto &caller: callers) {
+        caller.join();
+    }
+    EXPECT_EQ(mismatches.load(), 0);
+}
+
+TEST_F(WorkerTeamTest, NestedRun) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    // A job running a job of its own team would wait for itself, the nested job is run serially instead
+    const auto team = std::make_shared<WorkerTeam>(3);
+    std::vector<std::atomic<size_t>> calls(team->countThreads());
+    team->run([&team, &calls](size_t) {
+        team->run([&calls](size_t thread) { ++calls[thread]; });
+    });
+    for (const auto &count: calls) {
+        EXPECT_EQ(count.load(), team->countThreads());
+    }
+
+    // Evaluating a point with an evaluable bound to the team from within one of its jobs
+    const GravityEvaluable latencyEvaluable = GravityEvaluable{_polyhedron}.withWorkerTeam(team);
+    const auto expected = std::get<GravityModelResult>(latencyEvaluable(_points[1], true));
+    std::atomic<size_t> mismatches{0};
+    team->run([&](size_t) {
+        if (std::get<GravityModelResult>(latencyEvaluable(_points[1], true)) != expected) {
+            ++mismatches;
+        }
+    });
+    EXPECT_EQ(mismatches.load(), 0);
+}
@@ -0,0 +1,122 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "polyhedralGravity/model/GravityEvaluable.h"
+#include "polyhedralGravity/model/Polyhedron.h"
+#include "polyhedralGravity/output/MappedResultFile.h"
+#include "../model/CubePolyhedron.h"
+#include "../model/ResultComparison.h"
+
+/**
+ * Contains Tests for evaluating into caller-provided (memory-mapped) result arrays
+ */
+class MappedResultFileTest : public ::testing::Test {
+
+protected:
+    const std::filesystem::path _directory{std::filesystem::temp_directory_path() / "polyhedral-gravity-mapped-result-test"};
+
+    const polyhedralGravity::GravityEvaluable _evaluable{polyhedralGravity::CubePolyhedron::create()};
+
+    const std::vector<polyhedralGravity::Array3> _points{polyhedralGravity::ResultComparison::POINTS};
+
+    void SetUp() override {
+        std::filesystem::remove_all(_directory);
+        std::filesystem::create_directories(_directory);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(_directory);
+    }
+
+};
+
+TEST_F(MappedResultFileTest, EvaluateIntoSpans) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const auto expected = std::get<std::vector<GravityModelResult>>(_evaluable(_points, true));
+
+    // Only some components are requested, the others are skipped
+    std::vector<double> potential(_points.size()), accelerationZ(_points.size()), tensorXY(_points.size());
+    const GravityModelResultSpans spans{potential.data(), {nullptr, nullptr, accelerationZ.data()},
+                                        {nullptr, nullptr, nullptr, tensorXY.data(), nullptr, nullptr}};
+    // The points are evaluated in two chunks
+    _evaluable.evaluate(_points.data(), 2, spans, false);
+    _evaluable.evaluate(_points.data() + 2, _points.size() - 2, spans.subspan(2), true);
+
+    for (size_t i = 0; i < _points.size(); ++i) {
+        EXPECT_EQ(potential[i], ResultComparison::components(expected[i])[0]);
+        EXPECT_EQ(accelerationZ[i], ResultComparison::components(expected[i])[3]);
+        EXPECT_EQ(tensorXY[i], ResultComparison::components(expected[i])[7]);
+    }
+}
+
+TEST_F(MappedResultFileTest, EvaluateIntoRows) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const auto expected = std::get<std::vector<GravityModelResult>>(_evaluable(_points, true));
+
+    // One row per point, the potentials are skipped
+    std::vector<Array3> acceleration(_points.size());
+    std::vector<Array6> tensor(_points.size());
+    _evaluable.evaluate(_points.data(), _points.size(), nullptr, acceleration.data(), tensor.data());
+
+    for (size_t i = 0; i < _points.size(); ++i) {
+        EXPECT_EQ(acceleration[i], std::get<1>(expected[i]));
+        EXPECT_EQ(tensor[i], std::get<2>(expected[i]));
+    }
+}
+
+TEST_F(MappedResultFileTest, EvaluateSorted) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const auto expected = std::get<std::vector<GravityModelResult>>(_evaluable(_points, false));
+
+    // The points are evaluated along a Morton curve, but the results are scattered back to the points' order
+    EXPECT_EQ(std::get<std::vector<GravityModelResult>>(_evaluable(_points, true, true)), expected);
+    EXPECT_EQ(std::get<std::vector<GravityModelResult>>(_evaluable(_points, false, true)), expected);
+
+    std::vector<double> potential(_points.size());
+    std::vector<Array3> acceleration(_points.size());
+    _evaluable.evaluate(_points.data(), _points.size(), potential.data(), acceleration.data(), nullptr, true, true);
+    std::vector<double> accelerationX(_points.size());
+    const GravityModelResultSpans spans{nullptr, {accelerationX.data(), nullptr, nullptr}, {}};
+    _evaluable.evaluate(_points.data(), _points.size(), spans, false, true);
+
+    for (size_t i = 0; i < _points.size(); ++i) {
+        EXPECT_EQ(potential[i], std::get<0>(expected[i]));
+        EXPECT_EQ(acceleration[i], std::get<1>(expected[i]));
+        EXPECT_EQ(accelerationX[i], std::get<1>(expected[i])[0]);
+    }
+}
+
+TEST_F(MappedResultFileTest, EvaluateIntoMappedFile) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const auto expected = std::get<std::vector<GravityModelResult>>(_evaluable(_points, true));
+    const std::filesystem::path path = _directory / "results.npy";
+    {
+        MappedResultFile file{path.string(), _points.size()};
+        EXPECT_EQ(file.size(), _points.size());
+        _evaluable.evaluate(_points.data(), _points.size(), file.spans());
+        file.flush();
+    }
+
+    std::ifstream file{path, std::ios::binary};
+    const std::string bytes{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    ASSERT_EQ(bytes.size(), 128 + 10 * _points.size() * sizeof(double));
+    EXPECT_EQ(bytes.substr(0, 6), "\x93NUMPY");
+    EXPECT_THAT(bytes.substr(0, 128), HasSubstr("'shape': (10, 5)"));
+    for (size_t row = 0; row < 10; ++row) {
+        for (size_t i = 0; i < _points.size(); ++i) {
+            double value{};
+            std::memcpy(&value, bytes.data() + 128 + (row * _points.size() + i) * sizeof(double), sizeof(double));
+            EXPECT_EQ(value, ResultComparison::components(expected[i])[row]) << "row " << row << " point " << i;
+        }
+    }
+}
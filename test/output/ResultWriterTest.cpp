@@ -0,0 +1,132 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "polyhedralGravity/input/PointSource.h"
+#include "polyhedralGravity/output/ResultWriter.h"
+
+/**
+ * Contains Tests for writing the results in the CSV, raw binary, and .npy format
+ */
+class ResultWriterTest : public ::testing::Test {
+
+protected:
+    const std::filesystem::path _directory{std::filesystem::temp_directory_path() / "polyhedral-gravity-result-writer-test"};
+
+    const std::vector<polyhedralGravity::Array3> _points{{0.0, 0.0, 0.0}, {1.5, -2.0, 1e-300}, {7.0, 8.0, 9.0}};
+
+    const std::vector<polyhedralGravity::GravityModelResult> _results{
+            {1.0, {2.0, 3.0, 4.0}, {5.0, 6.0, 7.0, 8.0, 9.0, 10.0}},
+            {0.1, {-0.2, 1.0 / 3.0, 4e20}, {-5.0, 6.5, 7.25, 8.125, -9.0, 1e-12}},
+            {-1.0, {-2.0, -3.0, -4.0}, {-5.0, -6.0, -7.0, -8.0, -9.0, -10.0}}};
+
+    void SetUp() override {
+        std::filesystem::remove_all(_directory);
+        std::filesystem::create_directories(_directory);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(_directory);
+    }
+
+    static std::string readText(const std::filesystem::path &path) {
+        std::ifstream file{path, std::ios::binary};
+        return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    }
+
+    static std::vector<double> readDoubles(const std::filesystem::path &path, size_t offset) {
+        const std::string bytes = readText(path);
+        std::vector<double> values((bytes.size() - offset) / sizeof(double));
+        std::memcpy(values.data(), bytes.data() + offset, values.size() * sizeof(double));
+        return values;
+    }
+
+    /** The expected values of the given rows, every row consists of a subset of the 13 values */
+    std::vector<double> expectedValues(size_t first, size_t width) const {
+        std::vector<double> values{};
+        for (size_t i = 0; i < _points.size(); ++i) {
+            const auto &[potential, acceleration, secondDerivative] = _results[i];
+            std::vector<double> row{_points[i].cbegin(), _points[i].cend()};
+            row.push_back(potential);
+            row.insert(row.end(), acceleration.cbegin(), acceleration.cend());
+            row.insert(row.end(), secondDerivative.cbegin(), secondDerivative.cend());
+            values.insert(values.end(), row.cbegin() + first, row.cbegin() + first + width);
+        }
+        return values;
+    }
+
+    /** Writes the results in two chunks to test appending */
+    void writeInChunks(polyhedralGravity::ResultWriter &writer) const {
+        using namespace polyhedralGravity;
+        writer.write({_points.cbegin(), _points.cbegin() + 1}, {_results.cbegin(), _results.cbegin() + 1});
+        writer.write({_points.cbegin() + 1, _points.cend()}, {_results.cbegin() + 1, _results.cend()});
+        writer.close();
+    }
+
+};
+
+TEST_F(ResultWriterTest, WriteCSV) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const std::filesystem::path path = _directory / "result.csv";
+    writeInChunks(*ResultWriter::fromFile(path.string()));
+
+    EXPECT_EQ(readText(path), "x,y,z,V,Vx,Vy,Vz,Vxx,Vyy,Vzz,Vxy,Vxz,Vyz\n"
+                              "0,0,0,1,2,3,4,5,6,7,8,9,10\n"
+                              "1.5,-2,1e-300,0.1,-0.2,0.3333333333333333,4e+20,-5,6.5,7.25,8.125,-9,1e-12\n"
+                              "7,8,9,-1,-2,-3,-4,-5,-6,-7,-8,-9,-10\n");
+
+    // The formatted values round-trip, so the points can be read back exactly
+    const auto source = PointSource::fromFile(path.string());
+    std::vector<Array3> points{};
+    source->read(points, 10);
+    EXPECT_THAT(points, ContainerEq(_points));
+}
+
+TEST_F(ResultWriterTest, WriteBinary) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const std::filesystem::path path = _directory / "result.bin";
+    writeInChunks(*ResultWriter::fromFile(path.string()));
+
+    EXPECT_THAT(readDoubles(path, 0), ContainerEq(expectedValues(0, ResultWriter::VALUES_PER_ROW)));
+}
+
+TEST_F(ResultWriterTest, WriteNpyStructured) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    const std::filesystem::path path = _directory / "result.npy";
+    writeInChunks(*ResultWriter::fromFile(path.string()));
+
+    const std::string header = readText(path).substr(0, 256);
+    EXPECT_EQ(header.substr(0, 8), std::string("\x93NUMPY\x01\x00", 8));
+    EXPECT_THAT(header, HasSubstr("('point', '<f8', (3,)), ('potential', '<f8'), "
+                                  "('acceleration', '<f8', (3,)), ('tensor', '<f8', (6,))]"));
+    EXPECT_THAT(header, HasSubstr("'shape': (3,)"));
+    EXPECT_EQ(header.back(), '\n');
+    EXPECT_THAT(readDoubles(path, 256), ContainerEq(expectedValues(0, ResultWriter::VALUES_PER_ROW)));
+}
+
+TEST_F(ResultWriterTest, WriteNpySeparate) {
+    using namespace testing;
+    using namespace polyhedralGravity;
+    writeInChunks(*ResultWriter::fromFile((_directory / "result.npy").string(), true));
+
+    // The points can be read back by the point source
+    const auto source = PointSource::fromFile((_directory / "result_points.npy").string());
+    std::vector<Array3> points{};
+    source->read(points, 10);
+    EXPECT_THAT(points, ContainerEq(_points));
+
+    EXPECT_THAT(readText(_directory / "result_potential.npy"), HasSubstr("'shape': (3,)"));
+    EXPECT_THAT(readDoubles(_directory / "result_potential.npy", 256), ContainerEq(expectedValues(3, 1)));
+    EXPECT_THAT(readText(_directory / "result_acceleration.npy"), HasSubstr("'shape': (3, 3)"));
+    EXPECT_THAT(readDoubles(_directory / "result_acceleration.npy", 256), ContainerEq(expectedValues(4, 3)));
+    EXPECT_THAT(readText(_directory / "result_tensor.npy"), HasSubstr("'shape': (3, 6)"));
+    EXPECT_THAT(readDoubles(_directory / "result_tensor.npy", 256), ContainerEq(expectedValues(7, 6)));
+}
@@ -1,10 +1,16 @@
 from typing import Tuple, List, Union
-from polyhedral_gravity import Polyhedron, GravityEvaluable, evaluate, PolyhedronIntegrity, NormalOrientation, MetricUnit
+from polyhedral_gravity import Polyhedron, GravityEvaluable, evaluate, PolyhedronIntegrity, NormalOrientation, MetricUnit, \
+    MeshStorage, ParallelizationBackend, set_parallelization, get_parallelization, NumaGravityEvaluable, \
+    CoalescingGravityEvaluable
+import polyhedral_gravity
 import numpy as np
 import pickle
 import pytest
 from pathlib import Path
 from functools import lru_cache
+from concurrent.futures import ThreadPoolExecutor
+import os
+import sys
 
 CUBE_VERTICES = np.array([
     [-1, -1, -1],
@@ -173,6 +179,344 @@ def test_polyhedral_evaluable_pickle(
     np.testing.assert_array_almost_equal(acceleration, expected_acceleration)
 
 
+@pytest.mark.parametrize("protocol", [2, 4, 5])
+def test_polyhedral_evaluable_pickle_buffers(protocol: int) -> None:
+    """Tests that the evaluable is pickled with its arrays as contiguous buffers,
+    which are passed out-of-band with protocol 5.
+    """
+    points, expected_potential, expected_acceleration = reference_solution(DENSITY)
+    polyhedron = Polyhedron(
+        polyhedral_source=(CUBE_VERTICES, CUBE_FACES),
+        density=DENSITY,
+        normal_orientation=NormalOrientation.OUTWARDS,
+        integrity_check=PolyhedronIntegrity.DISABLE,
+    )
+    buffers = []
+    data = pickle.dumps(GravityEvaluable(polyhedron=polyhedron), protocol=protocol,
+                        buffer_callback=buffers.append if protocol >= 5 else None)
+    assert len(buffers) == (5 if protocol >= 5 else 0)
+
+    read_evaluable = pickle.loads(data, buffers=buffers)
+    sol = read_evaluable(computation_points=points, parallel=True)
+    np.testing.assert_array_almost_equal(np.array([result[0] for result in sol]), expected_potential)
+    np.testing.assert_array_almost_equal(np.array([result[1] for result in sol]), expected_acceleration)
+
+
+def test_polyhedral_evaluable_pickle_unreferenced_vertex() -> None:
+    """Tests that pickling a reordered polyhedron, whose first vertex is unreferenced, keeps its zero-based indexing."""
+    points, expected_potential, expected_acceleration = reference_solution(DENSITY)
+    polyhedron = Polyhedron(
+        polyhedral_source=(np.vstack([CUBE_VERTICES, [[-5, -5, -5]]]), CUBE_FACES),
+        density=DENSITY,
+        normal_orientation=NormalOrientation.OUTWARDS,
+        integrity_check=PolyhedronIntegrity.DISABLE,
+    ).reordered()
+    np.testing.assert_array_equal(polyhedron.vertices[0], [-5.0, -5.0, -5.0])
+    np.testing.assert_array_equal(pickle.loads(pickle.dumps(polyhedron)).faces, polyhedron.faces)
+
+    read_evaluable = pickle.loads(pickle.dumps(GravityEvaluable(polyhedron=polyhedron), protocol=5))
+    sol = read_evaluable(computation_points=points, parallel=True)
+    np.testing.assert_array_almost_equal(np.array([result[0] for result in sol]), expected_potential)
+    np.testing.assert_array_almost_equal(np.array([result[1] for result in sol]), expected_acceleration)
+
+
+@pytest.mark.parametrize("storage", [MeshStorage.COMPACT, MeshStorage.COMPACT_FLOAT32])
+def test_polyhedral_evaluable_compact_storage(storage: MeshStorage) -> None:
+    """Tests that an evaluable in compact storage yields the (almost) same results and keeps its storage when pickled."""
+    points, expected_potential, expected_acceleration = reference_solution(DENSITY)
+    polyhedron = Polyhedron(
+        polyhedral_source=(CUBE_VERTICES, CUBE_FACES),
+        density=DENSITY,
+        normal_orientation=NormalOrientation.OUTWARDS,
+        integrity_check=PolyhedronIntegrity.DISABLE,
+    )
+    evaluable = GravityEvaluable(polyhedron=polyhedron, storage=storage)
+    assert evaluable.storage == storage
+    sol = evaluable(computation_points=points, parallel=True)
+    np.testing.assert_array_almost_equal(np.array([result[0] for result in sol]), expected_potential)
+    np.testing.assert_array_almost_equal(np.array([result[1] for result in sol]), expected_acceleration)
+
+    # The compact caches are recomputed instead of pickled
+    buffers = []
+    read_evaluable = pickle.loads(pickle.dumps(evaluable, protocol=5, buffer_callback=buffers.append), buffers=buffers)
+    assert len(buffers) == 2
+    assert read_evaluable.storage == storage
+    assert read_evaluable(computation_points=points, parallel=False) == evaluable(computation_points=points, parallel=False)
+
+
+@pytest.mark.skipif(sys.platform == "win32", reason="POSIX shared memory is not available on Windows")
+def test_polyhedral_evaluable_shared_memory() -> None:
+    """Tests that an evaluable can be attached to a shared-memory object, which outlives its removal."""
+    points, expected_potential, expected_acceleration = reference_solution(DENSITY)
+    polyhedron = Polyhedron(
+        polyhedral_source=(CUBE_VERTICES, CUBE_FACES),
+        density=DENSITY,
+        normal_orientation=NormalOrientation.OUTWARDS,
+        integrity_check=PolyhedronIntegrity.DISABLE,
+    )
+    name = f"/polyhedral-gravity-test-{os.getpid()}"
+    GravityEvaluable(polyhedron=polyhedron).share_memory(name)
+    attached = GravityEvaluable(shared_memory=name)
+    GravityEvaluable.remove_shared_memory(name)
+
+    sol = attached(computation_points=points, parallel=True)
+    np.testing.assert_array_almost_equal(np.array([result[0] for result in sol]), expected_potential)
+    np.testing.assert_array_almost_equal(np.array([result[1] for result in sol]), expected_acceleration)
+    with pytest.raises(RuntimeError):
+        GravityEvaluable(shared_memory=name)
+
+
+@pytest.mark.parametrize(
+    "polyhedral_source,normal_orientation", [
+        ((CUBE_VERTICES, CUBE_FACES), NormalOrientation.OUTWARDS),
+        ((CUBE_VERTICES, CUBE_FACES_INVERTED), NormalOrientation.INWARDS),
+    ],
+    ids=["with_arrays_outwards", "with_arrays_inwards"]
+)
+def test_polyhedral_evaluable_snapshot(
+        polyhedral_source: Tuple[np.ndarray, np.ndarray],
+        normal_orientation: NormalOrientation,
+        tmp_path: Path,) -> None:
+    """Tests that the evaluable and the polyhedron can be saved to and loaded from a binary snapshot
+    and that the results are still correct afterward.
+    """
+    points, _, _ = reference_solution(DENSITY)
+    polyhedron = Polyhedron(
+        polyhedral_source=polyhedral_source,
+        density=DENSITY,
+        normal_orientation=normal_orientation,
+        integrity_check=PolyhedronIntegrity.DISABLE,
+        metric_unit=MetricUnit.KILOMETER,
+    )
+    evaluable_snapshot = tmp_path.joinpath("evaluable.pgsnap")
+    polyhedron_snapshot = tmp_path.joinpath("polyhedron.pgsnap")
+    GravityEvaluable(polyhedron=polyhedron).save(str(evaluable_snapshot))
+    polyhedron.save(str(polyhedron_snapshot))
+
+    read_polyhedron = Polyhedron.load(str(polyhedron_snapshot))
+    np.testing.assert_array_equal(read_polyhedron.vertices, polyhedron.vertices)
+    np.testing.assert_array_equal(read_polyhedron.faces, polyhedron.faces)
+    assert read_polyhedron.normal_orientation == normal_orientation
+    assert read_polyhedron.mesh_unit == polyhedron.mesh_unit
+
+    for read_evaluable in (GravityEvaluable.load(str(evaluable_snapshot)),
+                           GravityEvaluable.load(str(polyhedron_snapshot))):
+        sol = read_evaluable(computation_points=points, parallel=True)
+        potential = np.array([result[0] for result in sol])
+        acceleration = np.array([result[1] for result in sol])
+        expected = GravityEvaluable(polyhedron=polyhedron)(computation_points=points, parallel=True)
+        np.testing.assert_array_almost_equal(potential, np.array([result[0] for result in expected]))
+        np.testing.assert_array_almost_equal(acceleration, np.array([result[1] for result in expected]))
+
+    with pytest.raises(RuntimeError):
+        GravityEvaluable.load(str(CUBE_VERTICES_FILE))
+
+
+
+
+def test_polyhedral_gravity_numpy() -> None:
+    """Tests that the NumPy interface returns the same results as the list interface
+    and that the out arrays are reused.
+    """
+    points, expected_potential, expected_acceleration = reference_solution(DENSITY)
+    polyhedron = Polyhedron(
+        polyhedral_source=(CUBE_VERTICES, CUBE_FACES),
+        density=DENSITY,
+        normal_orientation=NormalOrientation.OUTWARDS,
+        integrity_check=PolyhedronIntegrity.DISABLE,
+    )
+    evaluable = GravityEvaluable(polyhedron=polyhedron)
+    expected_tensor = np.array([result[2] for result in evaluable(computation_points=points)])
+
+    for potential, acceleration, tensor in (evaluate(polyhedron, points, as_numpy=True),
+                                            evaluable(points, as_numpy=True),
+                                            evaluable(points.tolist(), parallel=False, as_numpy=True)):
+        assert potential.shape == (len(points),)
+        assert acceleration.shape == (len(points), 3)
+        assert tensor.shape == (len(points), 6)
+        np.testing.assert_array_almost_equal(potential, expected_potential)
+        np.testing.assert_array_almost_equal(acceleration, expected_acceleration)
+        np.testing.assert_array_almost_equal(tensor, expected_tensor)
+
+    out = (np.empty(len(points)), np.empty((len(points), 3)), np.empty((len(points), 6)))
+    result = evaluable(points, out=out)
+    assert all(result_array is out_array for result_array, out_array in zip(result, out))
+    np.testing.assert_array_almost_equal(out[0], expected_potential)
+
+    with pytest.raises(ValueError):
+        evaluable(points, out=(out[0], out[1], np.empty((len(points), 3))))
+    with pytest.raises(ValueError):
+        evaluable(points[:, :2], as_numpy=True)
+
+
+def test_polyhedral_evaluable_concurrent() -> None:
+    """Tests that one evaluable can be called from multiple Python threads concurrently."""
+    points, expected_potential, expected_acceleration = reference_solution(DENSITY)
+    polyhedron = Polyhedron(
+        polyhedral_source=(CUBE_VERTICES, CUBE_FACES),
+        density=DENSITY,
+        normal_orientation=NormalOrientation.OUTWARDS,
+        integrity_check=PolyhedronIntegrity.DISABLE,
+    )
+    evaluable = GravityEvaluable(polyhedron=polyhedron)
+
+    def evaluate_in_thread(index: int):
+        if index % 2 == 0:
+            return evaluable(points, parallel=False, as_numpy=True)
+        sol = evaluable(points, parallel=True)
+        return np.array([result[0] for result in sol]), np.array([result[1] for result in sol])
+
+    with ThreadPoolExecutor(max_workers=8) as executor:
+        for result in executor.map(evaluate_in_thread, range(32)):
+            np.testing.assert_array_almost_equal(result[0], expected_potential)
+            np.testing.assert_array_almost_equal(result[1], expected_acceleration)
+
+def test_polyhedral_evaluable_sort_points() -> None:
+    """Tests that evaluating the points along a Morton curve returns the results in the order of the points."""
+    points, expected_potential, expected_acceleration = reference_solution(DENSITY)
+    polyhedron = Polyhedron(
+        polyhedral_source=(CUBE_VERTICES, CUBE_FACES),
+        density=DENSITY,
+        normal_orientation=NormalOrientation.OUTWARDS,
+        integrity_check=PolyhedronIntegrity.DISABLE,
+    )
+    evaluable = GravityEvaluable(polyhedron=polyhedron)
+
+    for parallel in [True, False]:
+        sol = evaluable(points, parallel, sort_points=True)
+        np.testing.assert_array_almost_equal(np.array([result[0] for result in sol]), expected_potential)
+        np.testing.assert_array_almost_equal(np.array([result[1] for result in sol]), expected_acceleration)
+
+        potential, acceleration, _ = evaluable(points, parallel, as_numpy=True, sort_points=True)
+        np.testing.assert_array_almost_equal(potential, expected_potential)
+        np.testing.assert_array_almost_equal(acceleration, expected_acceleration)
+
+def test_parallelization_backends() -> None:
+    """Tests that every available backend and thread limit yields the same results and that
+    unavailable backends are rejected.
+    """
+    points, expected_potential, expected_acceleration = reference_solution(DENSITY)
+    polyhedron = Polyhedron(
+        polyhedral_source=(CUBE_VERTICES, CUBE_FACES),
+        density=DENSITY,
+        normal_orientation=NormalOrientation.OUTWARDS,
+        integrity_check=PolyhedronIntegrity.DISABLE,
+    )
+    evaluable = GravityEvaluable(polyhedron=polyhedron)
+    assert "CPP" in polyhedral_gravity.__parallelization__
+    default_backend, default_threads = get_parallelization()
+    try:
+        for name in polyhedral_gravity.__parallelization__:
+            set_parallelization(getattr(ParallelizationBackend, name), threads=2)
+            assert get_parallelization() == (getattr(ParallelizationBackend, name), 2)
+            for threads in [None, 1]:
+                potential, acceleration, _ = evaluable(points, as_numpy=True, threads=threads)
+                np.testing.assert_array_almost_equal(potential, expected_potential)
+                np.testing.assert_array_almost_equal(acceleration, expected_acceleration)
+                sol = evaluate(polyhedron, points, threads=threads)
+                np.testing.assert_array_almost_equal(np.array([result[0] for result in sol]), expected_potential)
+        for name in ["OMP", "TBB"]:
+            if name not in polyhedral_gravity.__parallelization__:
+                with pytest.raises(ValueError):
+                    set_parallelization(getattr(ParallelizationBackend, name))
+    finally:
+        set_parallelization(default_backend, default_threads)
+
+def test_numa_evaluable() -> None:
+    """Tests that the NUMA-aware evaluable yields the same results as the GravityEvaluable."""
+    points, expected_potential, expected_acceleration = reference_solution(DENSITY)
+    polyhedron = Polyhedron(
+        polyhedral_source=(CUBE_VERTICES, CUBE_FACES),
+        density=DENSITY,
+        normal_orientation=NormalOrientation.OUTWARDS,
+        integrity_check=PolyhedronIntegrity.DISABLE,
+    )
+    evaluable = NumaGravityEvaluable(polyhedron=polyhedron)
+    assert len(evaluable.nodes) >= 1
+    for sort_points in [False, True]:
+        potential, acceleration, _ = evaluable(points, as_numpy=True, sort_points=sort_points)
+        np.testing.assert_array_almost_equal(potential, expected_potential)
+        np.testing.assert_array_almost_equal(acceleration, expected_acceleration)
+    sol = evaluable(points)
+    np.testing.assert_array_almost_equal(np.array([result[0] for result in sol]), expected_potential)
+    potential, _, _ = evaluable(points[0])
+    np.testing.assert_almost_equal(potential, expected_potential[0])
+
+
+def test_polyhedral_evaluable_worker_team() -> None:
+    """Tests that the latency-optimized evaluation of single points yields the same results."""
+    points, expected_potential, expected_acceleration = reference_solution(DENSITY)
+    polyhedron = Polyhedron(
+        polyhedral_source=(CUBE_VERTICES, CUBE_FACES),
+        density=DENSITY,
+        normal_orientation=NormalOrientation.OUTWARDS,
+        integrity_check=PolyhedronIntegrity.DISABLE,
+    )
+    evaluable = GravityEvaluable(polyhedron=polyhedron).with_worker_team(threads=2)
+    for point, potential, acceleration in zip(points, expected_potential, expected_acceleration):
+        actual_potential, actual_acceleration, _ = evaluable(point)
+        np.testing.assert_almost_equal(actual_potential, potential)
+        np.testing.assert_array_almost_equal(actual_acceleration, acceleration)
+
+
+def test_coalescing_evaluable() -> None:
+    """Tests that concurrent single-point calls are coalesced into batches with the same results."""
+    points, expected_potential, expected_acceleration = reference_solution(DENSITY)
+    polyhedron = Polyhedron(
+        polyhedral_source=(CUBE_VERTICES, CUBE_FACES),
+        density=DENSITY,
+        normal_orientation=NormalOrientation.OUTWARDS,
+        integrity_check=PolyhedronIntegrity.DISABLE,
+    )
+    coalescing = CoalescingGravityEvaluable(GravityEvaluable(polyhedron=polyhedron), max_batch_size=16, max_wait=1e-3)
+    with ThreadPoolExecutor(max_workers=8) as executor:
+        results = list(executor.map(coalescing, points))
+    for (actual_potential, actual_acceleration, _), potential, acceleration in zip(
+            results, expected_potential, expected_acceleration):
+        np.testing.assert_almost_equal(actual_potential, potential)
+        np.testing.assert_array_almost_equal(actual_acceleration, acceleration)
+    requests, batches, maximal_batch_size = coalescing.statistics
+    assert requests == len(points)
+    assert batches <= requests
+    assert maximal_batch_size <= 16
+    with pytest.raises(ValueError):
+        CoalescingGravityEvaluable(GravityEvaluable(polyhedron=polyhedron), max_batch_size=0)
+
+
+def test_polyhedral_evaluable_stream() -> None:
+    """Tests that a generator of computation points is evaluated chunk by chunk with the same results
+    as the batch evaluation and that the callback can stop the evaluation.
+    """
+    points, _, _ = reference_solution(DENSITY)
+    polyhedron = Polyhedron(
+        polyhedral_source=(CUBE_VERTICES, CUBE_FACES),
+        density=DENSITY,
+        normal_orientation=NormalOrientation.OUTWARDS,
+        integrity_check=PolyhedronIntegrity.DISABLE,
+    )
+    evaluable = GravityEvaluable(polyhedron=polyhedron)
+    expected = evaluable(computation_points=points, parallel=True)
+
+    first_indices, streamed = [], []
+
+    def collect(first_index, chunk_points, chunk_results):
+        assert len(chunk_points) == len(chunk_results)
+        first_indices.append(first_index)
+        streamed.extend(chunk_results)
+
+    evaluated = evaluable.stream((point for point in points), collect, chunk_size=10)
+    assert evaluated == len(points)
+    assert first_indices == list(range(0, len(points), 10))
+    np.testing.assert_array_almost_equal(np.array([result[0] for result in streamed]),
+                                         np.array([result[0] for result in expected]))
+    np.testing.assert_array_almost_equal(np.array([result[1] for result in streamed]),
+                                         np.array([result[1] for result in expected]))
+
+    assert evaluable.stream(points, lambda first_index, chunk_points, chunk_results: False, chunk_size=10) == 10
+
+    with pytest.raises(ValueError):
+        evaluable.stream(points, collect, chunk_size=0)
+
 def test_polyhedron_metric() -> None:
     """Tests the metric conversion/ options for a unit cube polyhedron.
     """
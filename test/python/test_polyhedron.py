@@ -1,5 +1,6 @@
 from typing import Tuple, List, Union
-from polyhedral_gravity import Polyhedron, GravityEvaluable, evaluate, PolyhedronIntegrity, NormalOrientation, MetricUnit
+from polyhedral_gravity import Polyhedron, GravityEvaluable, evaluate, PolyhedronIntegrity, NormalOrientation, MetricUnit, \
+    OrientationCheckStrategy, SpaceFillingCurve
 import numpy as np
 import pickle
 import pytest
@@ -121,3 +122,75 @@ def test_failed_polyhedral_construction() -> None:
             polyhedral_source=["test/resources/FileDoesNotExist.node", "test/resources/FileDoesNotExist.face"],
             density=1.0,
         )
+
+
+@pytest.mark.parametrize(
+    "faces,violating_faces", [
+        (CUBE_FACES_OUTWARDS, []),
+        (CUBE_FACES_OUTWARDS_MAJOR, [0]),
+        (CUBE_FACES_INWARDS_MAJOR, [2, 3, 5]),
+    ],
+    ids=["CubeOutwards", "CubeOutwardsMajor", "CubeInwardsMajor"]
+)
+def test_orientation_check_strategy(faces: np.ndarray, violating_faces: List[int]) -> None:
+    """Tests that the topological and the ray casting orientation check agree."""
+    polyhedron = Polyhedron((CUBE_VERTICES, faces), DENSITY, integrity_check=PolyhedronIntegrity.DISABLE)
+    topological = polyhedron.check_normal_orientation(OrientationCheckStrategy.TOPOLOGICAL)
+    ray_casting = polyhedron.check_normal_orientation(strategy=OrientationCheckStrategy.RAY_CASTING)
+    assert topological == ray_casting
+    assert sorted(topological[1]) == violating_faces
+
+
+def test_mesh_topology() -> None:
+    """Tests the reporting of open edges and components."""
+    closed = Polyhedron((CUBE_VERTICES, CUBE_FACES_OUTWARDS), DENSITY, integrity_check=PolyhedronIntegrity.DISABLE)
+    topology = closed.check_mesh_topology()
+    assert topology.is_closed_manifold()
+    assert topology.component_count == 1
+    assert topology.open_edges == []
+
+    opened = Polyhedron((CUBE_VERTICES, CUBE_FACES_OUTWARDS[2:]), DENSITY, integrity_check=PolyhedronIntegrity.DISABLE)
+    topology = opened.check_mesh_topology()
+    assert not topology.is_closed_manifold()
+    assert sorted(topology.open_edges) == [(0, 1), (0, 3), (1, 2), (2, 3)]
+
+
+def test_polyhedron_numpy_views() -> None:
+    """Tests that the vertices and faces are exposed as read-only NumPy views, which keep the polyhedron alive,
+    and that a polyhedron constructed from NumPy arrays or lists is the same.
+    """
+    polyhedron = Polyhedron((CUBE_VERTICES.astype(np.float64), CUBE_FACES_OUTWARDS), DENSITY,
+                            integrity_check=PolyhedronIntegrity.DISABLE)
+    vertices, faces = polyhedron.vertices, polyhedron.faces
+    assert vertices.shape == (8, 3) and vertices.dtype == np.float64
+    assert faces.shape == (12, 3) and np.issubdtype(faces.dtype, np.unsignedinteger)
+    np.testing.assert_array_equal(vertices, CUBE_VERTICES)
+    np.testing.assert_array_equal(faces, CUBE_FACES_OUTWARDS)
+    with pytest.raises(ValueError):
+        vertices[0, 0] = 42.0
+
+    del polyhedron
+    np.testing.assert_array_equal(vertices, CUBE_VERTICES)
+
+    from_lists = Polyhedron((CUBE_VERTICES.tolist(), CUBE_FACES_OUTWARDS.tolist()), DENSITY,
+                            integrity_check=PolyhedronIntegrity.DISABLE)
+    np.testing.assert_array_equal(from_lists.vertices, vertices)
+    np.testing.assert_array_equal(from_lists.faces, faces)
+
+    with pytest.raises(ValueError):
+        Polyhedron((CUBE_VERTICES[:, :2], CUBE_FACES_OUTWARDS), DENSITY, integrity_check=PolyhedronIntegrity.DISABLE)
+
+
+@pytest.mark.parametrize("curve", [SpaceFillingCurve.MORTON, SpaceFillingCurve.HILBERT])
+def test_polyhedron_reordered(curve: SpaceFillingCurve) -> None:
+    """Tests that a reordered polyhedron consists of the same faces and maps them to the original order."""
+    polyhedron = Polyhedron((CUBE_VERTICES, CUBE_FACES_OUTWARDS), DENSITY, integrity_check=PolyhedronIntegrity.DISABLE)
+    np.testing.assert_array_equal(polyhedron.face_permutation, np.arange(12))
+
+    reordered = polyhedron.reordered(curve)
+    vertex_permutation, face_permutation = reordered.vertex_permutation, reordered.face_permutation
+    np.testing.assert_array_equal(reordered.vertices, polyhedron.vertices[vertex_permutation])
+    np.testing.assert_array_equal(vertex_permutation[reordered.faces], polyhedron.faces[face_permutation])
+
+    point = [2.0, 1.0, 0.5]
+    np.testing.assert_array_almost_equal(evaluate(reordered, point)[1], evaluate(polyhedron, point)[1])
@@ -0,0 +1,65 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <thread>
+#include <vector>
+
+#include "polyhedralGravity/util/BoundedQueue.h"
+
+TEST(BoundedQueueTest, ProducerConsumer) {
+    using namespace ::polyhedralGravity::util;
+    BoundedQueue<int> queue{2};
+    std::thread producer{[&queue]() {
+        for (int i = 0; i < 1000; ++i) {
+            ASSERT_TRUE(queue.push(i));
+        }
+        queue.close();
+    }};
+    std::vector<int> consumed{};
+    while (const auto element = queue.pop()) {
+        consumed.push_back(*element);
+    }
+    producer.join();
+
+    ASSERT_EQ(consumed.size(), 1000);
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(consumed[i], i);
+    }
+    const QueueOccupancy occupancy = queue.occupancy();
+    EXPECT_EQ(occupancy.capacity, 2);
+    EXPECT_LE(occupancy.maximum, 2);
+    EXPECT_LE(occupancy.mean, 2.0);
+}
+
+TEST(BoundedQueueTest, Close) {
+    using namespace ::polyhedralGravity::util;
+    BoundedQueue<int> queue{3};
+    ASSERT_TRUE(queue.push(1));
+    ASSERT_TRUE(queue.push(2));
+    queue.close();
+
+    // The remaining elements of a closed queue are still returned, but no new ones accepted
+    EXPECT_FALSE(queue.push(3));
+    EXPECT_EQ(queue.pop(), 1);
+    EXPECT_EQ(queue.pop(), 2);
+    EXPECT_EQ(queue.pop(), std::nullopt);
+    EXPECT_EQ(queue.occupancy().maximum, 2);
+
+    // Discarding drops the remaining elements
+    BoundedQueue<int> discarded{3};
+    ASSERT_TRUE(discarded.push(1));
+    discarded.close(true);
+    EXPECT_EQ(discarded.pop(), std::nullopt);
+}
+
+TEST(BoundedQueueTest, CloseWakesBlockedProducer) {
+    using namespace ::polyhedralGravity::util;
+    BoundedQueue<int> queue{1};
+    ASSERT_TRUE(queue.push(1));
+    std::thread producer{[&queue]() {
+        // Blocks since the queue is full until it is closed
+        EXPECT_FALSE(queue.push(2));
+    }};
+    queue.close(true);
+    producer.join();
+}
@@ -0,0 +1,47 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <vector>
+#include "polyhedralGravity/util/UtilitySpaceFillingCurve.h"
+
+TEST(UtilitySpaceFillingCurveTest, MortonKey) {
+    using namespace polyhedralGravity::util;
+    EXPECT_EQ(mortonKey({0, 0, 0}), 0);
+    EXPECT_EQ(mortonKey({0, 0, 1}), 1);
+    EXPECT_EQ(mortonKey({0, 1, 0}), 2);
+    EXPECT_EQ(mortonKey({1, 0, 0}), 4);
+    EXPECT_EQ(mortonKey({1, 1, 1}), 7);
+    EXPECT_EQ(mortonKey({2, 0, 0}), 32);
+    const uint32_t maximum = (1u << SPACE_FILLING_CURVE_BITS) - 1;
+    EXPECT_EQ(mortonKey({maximum, maximum, maximum}), (uint64_t{1} << 63) - 1);
+}
+
+TEST(UtilitySpaceFillingCurveTest, HilbertKeyVisitsNeighbours) {
+    using namespace polyhedralGravity::util;
+    // The curve starts at the origin, hence the first 4^3 keys cover the cube of 4^3 cells at the origin
+    std::vector<std::pair<uint64_t, std::array<uint32_t, 3>>> cells{};
+    for (uint32_t x = 0; x < 4; ++x) {
+        for (uint32_t y = 0; y < 4; ++y) {
+            for (uint32_t z = 0; z < 4; ++z) {
+                cells.emplace_back(hilbertKey({x, y, z}), std::array<uint32_t, 3>{x, y, z});
+            }
+        }
+    }
+    std::sort(cells.begin(), cells.end());
+    for (size_t i = 0; i < cells.size(); ++i) {
+        EXPECT_EQ(cells[i].first, i);
+    }
+    // Consecutive cells along the curve are neighbours
+    for (size_t i = 1; i < cells.size(); ++i) {
+        const auto &previous = cells[i - 1].second;
+        const auto &current = cells[i].second;
+        int distance = 0;
+        for (size_t axis = 0; axis < 3; ++axis) {
+            distance += std::abs(static_cast<int>(current[axis]) - static_cast<int>(previous[axis]));
+        }
+        EXPECT_EQ(distance, 1) << "between the keys " << i - 1 << " and " << i;
+    }
+}
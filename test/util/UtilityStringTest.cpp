@@ -0,0 +1,56 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "polyhedralGravity/util/UtilityString.h"
+
+TEST(UtilityStringTest, ParseNumber) {
+    using namespace ::polyhedralGravity::util;
+    const std::string_view text{"  -1.5e3\t+42/7 x"};
+    const char *last = text.data() + text.size();
+    double decimal{0.0};
+    const char *first = parseNumber(text.data(), last, decimal);
+    ASSERT_NE(first, nullptr);
+    EXPECT_DOUBLE_EQ(decimal, -1500.0);
+
+    long long integer{0};
+    first = parseNumber(first, last, integer);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(integer, 42);
+    EXPECT_EQ(*first, '/');
+
+    // The remaining token is not a number
+    EXPECT_EQ(parseNumber(skipToken(first, last), last, integer), nullptr);
+}
+
+TEST(UtilityStringTest, SplitIntoLineChunks) {
+    using namespace ::polyhedralGravity::util;
+    using namespace testing;
+    std::string text{};
+    for (int line = 0; line < 100; ++line) {
+        text += "line " + std::to_string(line) + '\n';
+    }
+    text += "last line without line break";
+
+    for (size_t chunkCount: {1, 3, 7, 1000}) {
+        const std::vector<std::string_view> chunks = splitIntoLineChunks(text, chunkCount);
+        ASSERT_LE(chunks.size(), std::min<size_t>(chunkCount, 101));
+        std::string joined{};
+        std::vector<std::string_view> lines{};
+        for (const auto &chunk: chunks) {
+            // Every chunk, except the last one, ends on a line break
+            if (&chunk != &chunks.back()) {
+                EXPECT_EQ(chunk.back(), '\n');
+            }
+            joined += chunk;
+            forEachLine(chunk, [&lines](std::string_view line) { lines.push_back(line); });
+        }
+        EXPECT_EQ(joined, text);
+        ASSERT_EQ(lines.size(), 101);
+        EXPECT_EQ(lines.front(), "line 0");
+        EXPECT_EQ(lines.back(), "last line without line break");
+    }
+}